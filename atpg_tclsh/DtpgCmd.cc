@@ -48,8 +48,14 @@ DtpgCmd::DtpgCmd(AtpgMgr* mgr) :
 				"print statistics");
   mPoptSingle = new TclPopt(this, "single",
 			    "single mode");
+  mPoptFFR = new TclPopt(this, "ffr",
+			 "FFR mode (single fault, incremental SAT per FFR)");
   mPoptMFFC = new TclPopt(this, "mffc",
 			  "MFFC mode");
+  mPoptTd = new TclPopt(this, "td",
+			"transition delay fault mode (broadside, incremental SAT per FFR)");
+  mPoptThreads = new TclPoptUint(this, "threads",
+				 "specify the number of threads for MFFC mode <INT>");
   mPoptX = new TclPoptInt(this, "x",
 			  "X-extract mode [0-2]");
   mPoptDrop = new TclPopt(this, "drop",
@@ -69,7 +75,7 @@ DtpgCmd::DtpgCmd(AtpgMgr* mgr) :
 
   new_popt_group(mPoptSat, mPoptMiniSat, mPoptMiniSat2, mPoptSatRec);
 
-  TclPoptGroup* g0 = new_popt_group(mPoptSingle, mPoptMFFC);
+  TclPoptGroup* g0 = new_popt_group(mPoptSingle, mPoptFFR, mPoptMFFC, mPoptTd);
 
   new_popt_group(mPoptTimer, mPoptNoTimer);
 }
@@ -135,9 +141,24 @@ DtpgCmd::cmd_proc(TclObjVector& objv)
       engine_type = "single";
     }
   }
+  else if ( mPoptFFR->is_specified() ) {
+    engine_type = "ffr";
+  }
   else if ( mPoptMFFC->is_specified() ) {
     engine_type = "mffc";
   }
+  else if ( mPoptTd->is_specified() ) {
+    engine_type = "td";
+  }
+
+  ymuint thread_num = 1;
+  if ( mPoptThreads->is_specified() ) {
+    thread_num = mPoptThreads->val();
+    if ( engine_type == "" || engine_type == "mffc" ) {
+      // MFFC 単位で並列に処理する．
+      engine_type = "mffc_mt";
+    }
+  }
 
   string option_str = mPoptOpt->val();
 
@@ -157,11 +178,14 @@ DtpgCmd::cmd_proc(TclObjVector& objv)
 
   BackTracer bt(_network().node_num());
 
+  // 遷移故障の場合は2時刻分のシミュレーションを行う．
+  Fsim& fsim = (engine_type == "td") ? _tfsim() : _fsim3();
+
   if ( mPoptDrop->is_specified() ) {
-    dop_list.add(new_DopDrop(_fault_mgr(), _fsim3()));
+    dop_list.add(new_DopDrop(_fault_mgr(), fsim));
   }
   if ( mPoptVerify->is_specified() ) {
-    dop_list.add(new_DopVerify(_fsim3()));
+    dop_list.add(new_DopVerify(fsim));
   }
 
   bool timer_enable = true;
@@ -173,9 +197,18 @@ DtpgCmd::cmd_proc(TclObjVector& objv)
   if ( engine_type == "single" ) {
     engine = new_DtpgSatS(sat_type, sat_option, outp, bt, dop_list, uop_list);
   }
+  else if ( engine_type == "ffr" ) {
+    engine = new_DtpgSatF(sat_type, sat_option, outp, bt, dop_list, uop_list);
+  }
   else if ( engine_type == "mffc" ) {
     engine = new_DtpgSatH(sat_type, sat_option, outp, bt, dop_list, uop_list);
   }
+  else if ( engine_type == "td" ) {
+    engine = new_DtpgSatT(sat_type, sat_option, outp, bt, dop_list, uop_list);
+  }
+  else if ( engine_type == "mffc_mt" ) {
+    engine = new_DtpgSatP(thread_num, sat_type, sat_option, outp, bt, dop_list, uop_list);
+  }
   else {
     // デフォルトフォールバック
     engine = new_DtpgSatS(sat_type, sat_option, outp, bt, dop_list, uop_list);
@@ -186,7 +219,10 @@ DtpgCmd::cmd_proc(TclObjVector& objv)
 
   const vector<const TpgFault*>& fault_list = _fault_mgr().remain_list();
   DtpgStats stats;
-  engine->run(_network(), _fault_mgr(), _fsim3(), fault_list, stats);
+  engine->run(_network(), _fault_mgr(), fsim, fault_list, stats);
+
+  // まとめて処理するために溜め込まれているパタンを処理する．
+  dop_list.flush();
 
   delete engine;
 
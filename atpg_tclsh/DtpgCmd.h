@@ -67,9 +67,18 @@ private:
   // single オプションの解析用オブジェクト
   TclPopt* mPoptSingle;
 
+  // ffr オプションの解析用オブジェクト
+  TclPopt* mPoptFFR;
+
   // mffc オプションの解析用オブジェクト
   TclPopt* mPoptMFFC;
 
+  // td オプションの解析用オブジェクト
+  TclPopt* mPoptTd;
+
+  // threads オプションの解析用オブジェクト
+  TclPoptUint* mPoptThreads;
+
   // X抽出オプションの解析用オブジェクト
   TclPoptInt* mPoptX;
 
@@ -0,0 +1,116 @@
+﻿
+/// @file FsimFileCmd.cc
+/// @brief FsimFileCmd の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012, 2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "FsimFileCmd.h"
+#include "FileFsim.h"
+#include "FaultMgr.h"
+#include "Fsim.h"
+#include "ym/TclPopt.h"
+#include "ym/StopWatch.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// パタンファイルで故障シミュレーションを実行するコマンド
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+FsimFileCmd::FsimFileCmd(AtpgMgr* mgr) :
+  AtpgCmd(mgr)
+{
+  mPoptFsim = new TclPoptStr(this, "fsim",
+			     "specify the fault simulator [fsim2|fsim3|tfsim2]");
+  mPoptInterval = new TclPoptUint(this, "interval",
+				  "print coverage every <int> patterns");
+  mPoptPrintStats = new TclPopt(this, "print_stats",
+				"print statistics");
+  set_usage_string("filename");
+}
+
+// @brief デストラクタ
+FsimFileCmd::~FsimFileCmd()
+{
+}
+
+// コマンド処理関数
+int
+FsimFileCmd::cmd_proc(TclObjVector& objv)
+{
+  ymuint objc = objv.size();
+
+  // このコマンドはファイル名を引数としてとる．
+  if ( objc != 2 ) {
+    print_usage();
+    return TCL_ERROR;
+  }
+
+  // 用いる故障シミュレータ
+  // デフォルトは縮退故障用の3値シミュレータ
+  Fsim* fsim_p = &_fsim3();
+  if ( mPoptFsim->is_specified() ) {
+    string fsim_type = mPoptFsim->val();
+    if ( fsim_type == "fsim2" ) {
+      fsim_p = &_fsim();
+    }
+    else if ( fsim_type == "tfsim2" ) {
+      fsim_p = &_tfsim();
+    }
+    else if ( fsim_type != "fsim3" ) {
+      print_usage();
+      return TCL_ERROR;
+    }
+  }
+  Fsim& fsim = *fsim_p;
+
+  ymuint interval = 0;
+  if ( mPoptInterval->is_specified() ) {
+    interval = mPoptInterval->val();
+  }
+
+  string filename = objv[1];
+  // ファイル名の展開を行う．
+  string ex_filename;
+  bool stat1 = tilde_subst(filename, ex_filename);
+  if ( !stat1 ) {
+    // ファイル名の文字列に誤りがあった．
+    return TCL_ERROR;
+  }
+
+  StopWatch timer;
+  timer.start();
+
+  FileFsim file_fsim(_network(), _fault_mgr(), fsim);
+  bool stat2 = file_fsim.run(ex_filename, interval, cout);
+
+  timer.stop();
+
+  // エラーが起きてもそれまでに検出された故障は反映させる．
+  after_update_faults();
+
+  if ( !stat2 ) {
+    TclObj emsg;
+    emsg << ex_filename << " : " << file_fsim.error_msg();
+    set_result(emsg);
+    return TCL_ERROR;
+  }
+
+  if ( mPoptPrintStats->is_specified() ) {
+    cout << "********** fsim_file **********" << endl
+	 << setw(10) << file_fsim.det_num()
+	 << ": # of detected faults" << endl
+	 << setw(10) << file_fsim.pattern_num()
+	 << ": # of simulated patterns" << endl
+	 << timer.time() << endl;
+  }
+
+  return TCL_OK;
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,59 @@
+﻿#ifndef FSIMFILECMD_H
+#define FSIMFILECMD_H
+
+/// @file FsimFileCmd.h
+/// @brief FsimFileCmd のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012, 2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AtpgCmd.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// パタンファイルで故障シミュレーションを実行するコマンド
+//////////////////////////////////////////////////////////////////////
+class FsimFileCmd :
+  public AtpgCmd
+{
+public:
+
+  /// @brief コンストラクタ
+  FsimFileCmd(AtpgMgr* mgr);
+
+  /// @brief デストラクタ
+  virtual
+  ~FsimFileCmd();
+
+
+protected:
+
+  // コマンド処理関数
+  virtual
+  int
+  cmd_proc(TclObjVector& objv);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // fsim オプションの解析用オブジェクト
+  TclPoptStr* mPoptFsim;
+
+  // interval オプションの解析用オブジェクト
+  TclPoptUint* mPoptInterval;
+
+  // print_stats オプションの解析用オブジェクト
+  TclPopt* mPoptPrintStats;
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // FSIMFILECMD_H
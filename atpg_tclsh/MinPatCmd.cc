@@ -51,6 +51,12 @@ MinPatCmd::MinPatCmd(AtpgMgr* mgr) :
 			      "specify threshold value");
   mPoptRepFaults = new TclPopt(this, "rep-faults",
 			       "get representative faults");
+  mPoptThreads = new TclPoptUint(this, "threads",
+				 "specify the number of threads for conflict analysis, group search and mc-compaction <INT>");
+  mPoptMcHeuristic = new TclPopt(this, "mc-heuristic",
+				 "solve mincov of mc-compaction heuristically");
+  mPoptMcTimeLimit = new TclPoptDouble(this, "mc-time-limit",
+				       "specify the time limit of mc-heuristic in seconds <FLOAT>");
 }
 
 // @brief デストラクタ
@@ -103,6 +109,16 @@ MinPatCmd::cmd_proc(TclObjVector& objv)
   }
 
   minpat->set_verbose(verbose);
+  if ( mPoptThreads->is_specified() ) {
+    minpat->set_thread_num(mPoptThreads->val());
+  }
+  if ( mPoptMcHeuristic->is_specified() ) {
+    double time_limit = 0.0;
+    if ( mPoptMcTimeLimit->is_specified() ) {
+      time_limit = mPoptMcTimeLimit->val();
+    }
+    minpat->set_mc_heuristic(true, time_limit);
+  }
 
   USTime time;
   minpat->run(_network(), _fault_mgr(), _tv_mgr(),  _fsim(), _fsim3(),
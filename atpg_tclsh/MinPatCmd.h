@@ -85,6 +85,15 @@ private:
   // rep-faults オプションの解析用オブジェクト
   TclPopt* mPoptRepFaults;
 
+  // threads オプションの解析用オブジェクト
+  TclPoptUint* mPoptThreads;
+
+  // mc-heuristic オプションの解析用オブジェクト
+  TclPopt* mPoptMcHeuristic;
+
+  // mc-time-limit オプションの解析用オブジェクト
+  TclPoptDouble* mPoptMcTimeLimit;
+
 };
 
 END_NAMESPACE_YM_SATPG
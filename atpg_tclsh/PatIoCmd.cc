@@ -0,0 +1,172 @@
+﻿
+/// @file PatIoCmd.cc
+/// @brief テストパタンの入出力関連のコマンド
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012, 2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "PatIoCmd.h"
+#include "AtpgMgr.h"
+#include "TpgNetwork.h"
+#include "TestVector.h"
+#include "TvMgr.h"
+#include "TvWriter.h"
+#include "TvReader.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// テストパタンをバイナリ形式で書き出すコマンド
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+WritePat::WritePat(AtpgMgr* mgr) :
+  AtpgCmd(mgr)
+{
+  set_usage_string("filename");
+}
+
+// @brief デストラクタ
+WritePat::~WritePat()
+{
+}
+
+// コマンド処理関数
+int
+WritePat::cmd_proc(TclObjVector& objv)
+{
+  ymuint objc = objv.size();
+
+  // このコマンドはファイル名を引数としてとる．
+  if ( objc != 2 ) {
+    print_usage();
+    return TCL_ERROR;
+  }
+
+  string filename = objv[1];
+  // ファイル名の展開を行う．
+  string ex_filename;
+  bool stat1 = tilde_subst(filename, ex_filename);
+  if ( !stat1 ) {
+    // ファイル名の文字列に誤りがあった．
+    return TCL_ERROR;
+  }
+
+  ofstream ofs(ex_filename.c_str(), ios::out | ios::binary);
+  if ( !ofs ) {
+    TclObj emsg;
+    emsg << ex_filename << " : Could not open";
+    set_result(emsg);
+    return TCL_ERROR;
+  }
+
+  TvWriter writer(ofs);
+  writer.write_header(_network());
+  const vector<TestVector*>& tv_list = _tv_list();
+  for (ymuint i = 0; i < tv_list.size(); ++ i) {
+    writer.write(tv_list[i]);
+  }
+  writer.write_end();
+
+  if ( !ofs ) {
+    TclObj emsg;
+    emsg << ex_filename << " : Write error";
+    set_result(emsg);
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
+
+//////////////////////////////////////////////////////////////////////
+// バイナリ形式のテストパタンを読み込むコマンド
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+ReadPat::ReadPat(AtpgMgr* mgr) :
+  AtpgCmd(mgr)
+{
+  mPoptAppend = new TclPopt(this, "append",
+			    "append to the current pattern list");
+  set_usage_string("filename");
+}
+
+// @brief デストラクタ
+ReadPat::~ReadPat()
+{
+}
+
+// コマンド処理関数
+int
+ReadPat::cmd_proc(TclObjVector& objv)
+{
+  ymuint objc = objv.size();
+
+  // このコマンドはファイル名を引数としてとる．
+  if ( objc != 2 ) {
+    print_usage();
+    return TCL_ERROR;
+  }
+
+  string filename = objv[1];
+  // ファイル名の展開を行う．
+  string ex_filename;
+  bool stat1 = tilde_subst(filename, ex_filename);
+  if ( !stat1 ) {
+    // ファイル名の文字列に誤りがあった．
+    return TCL_ERROR;
+  }
+
+  ifstream ifs(ex_filename.c_str(), ios::in | ios::binary);
+  if ( !ifs ) {
+    TclObj emsg;
+    emsg << ex_filename << " : No such file";
+    set_result(emsg);
+    return TCL_ERROR;
+  }
+
+  TvReader reader(ifs);
+  if ( !reader.read_header(_network()) ) {
+    TclObj emsg;
+    emsg << ex_filename << " : " << reader.error_msg();
+    set_result(emsg);
+    return TCL_ERROR;
+  }
+
+  // 途中でエラーが起きた時に元に戻せるように一旦別のリストに読み込む．
+  TvMgr& tvmgr = _tv_mgr();
+  vector<TestVector*> new_list;
+  for ( ; ; ) {
+    TestVector* tv = reader.read(tvmgr);
+    if ( tv == nullptr ) {
+      break;
+    }
+    new_list.push_back(tv);
+  }
+  if ( reader.error() ) {
+    for (ymuint i = 0; i < new_list.size(); ++ i) {
+      tvmgr.delete_vector(new_list[i]);
+    }
+    TclObj emsg;
+    emsg << ex_filename << " : " << reader.error_msg();
+    set_result(emsg);
+    return TCL_ERROR;
+  }
+
+  vector<TestVector*>& tv_list = _tv_list();
+  if ( !mPoptAppend->is_specified() ) {
+    for (ymuint i = 0; i < tv_list.size(); ++ i) {
+      tvmgr.delete_vector(tv_list[i]);
+    }
+    tv_list.clear();
+  }
+  tv_list.insert(tv_list.end(), new_list.begin(), new_list.end());
+
+  return TCL_OK;
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,80 @@
+﻿#ifndef PATIOCMD_H
+#define PATIOCMD_H
+
+/// @file PatIoCmd.h
+/// @brief PatIoCmd のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012, 2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "AtpgCmd.h"
+#include "ym/TclPopt.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// テストパタンをバイナリ形式で書き出すコマンド
+//////////////////////////////////////////////////////////////////////
+class WritePat :
+  public AtpgCmd
+{
+public:
+
+  /// @brief コンストラクタ
+  WritePat(AtpgMgr* mgr);
+
+  /// @brief デストラクタ
+  virtual
+  ~WritePat();
+
+
+protected:
+
+  // コマンド処理関数
+  virtual
+  int
+  cmd_proc(TclObjVector& objv);
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// バイナリ形式のテストパタンを読み込むコマンド
+//////////////////////////////////////////////////////////////////////
+class ReadPat :
+  public AtpgCmd
+{
+public:
+
+  /// @brief コンストラクタ
+  ReadPat(AtpgMgr* mgr);
+
+  /// @brief デストラクタ
+  virtual
+  ~ReadPat();
+
+
+protected:
+
+  // コマンド処理関数
+  virtual
+  int
+  cmd_proc(TclObjVector& objv);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // append オプションの解析用オブジェクト
+  TclPopt* mPoptAppend;
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // PATIOCMD_H
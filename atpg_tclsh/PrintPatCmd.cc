@@ -9,6 +9,8 @@
 
 #include "PrintPatCmd.h"
 #include "AtpgMgr.h"
+#include "TpgNetwork.h"
+#include "TpgNode.h"
 #include "TestVector.h"
 #include "ym/TclPopt.h"
 
@@ -27,6 +29,9 @@ PrintPatCmd::PrintPatCmd(AtpgMgr* mgr) :
 			 "print in hex mode");
   mPoptNum = new TclPopt(this, "num",
 			 "print with index numbering");
+  mPoptStil = new TclPopt(this, "stil",
+			  "print in STIL-like format");
+  new_popt_group(mPoptHex, mPoptStil);
   set_usage_string("?filename?");
 }
 
@@ -64,24 +69,88 @@ PrintPatCmd::cmd_proc(TclObjVector& objv)
 
   bool hex_flag = mPoptHex->is_specified();
   bool num_flag = mPoptNum->is_specified();
+  bool stil_flag = mPoptStil->is_specified();
 
+  // パタンごとに文字列を作らずに直接書き出す．
+  // 行末で毎回 flush しないように endl は使わない．
   vector<TestVector*>& tvlist = _tv_list();
   ymuint n = tvlist.size();
+  if ( stil_flag ) {
+    print_stil_header(out);
+  }
   for (ymuint i = 0; i < n; ++ i) {
     TestVector* tv = tvlist[i];
+    if ( stil_flag ) {
+      if ( num_flag ) {
+	out << "  \"" << (i + 1) << "\": ";
+      }
+      else {
+	out << "  ";
+      }
+      out << "V { \"_pi\" = ";
+      tv->print_bin(out);
+      out << "; }\n";
+      continue;
+    }
     if ( num_flag ) {
       out << setw(5) << setfill('0') << (i + 1) << ": ";
     }
     if ( hex_flag ) {
-      out << tv->hex_str();
+      tv->print_hex(out);
     }
     else {
-      out << tv->bin_str();
+      tv->print_bin(out);
     }
-    out << endl;
+    out << '\n';
   }
+  if ( stil_flag ) {
+    out << "}\n";
+  }
+  out.flush();
 
   return TCL_OK;
 }
 
+// @brief STIL 形式のヘッダを出力する．
+// @param[in] s 出力先のストリーム
+//
+// 入力の並びを信号グループ "_pi" として定義する．
+// 名前のない入力には位置番号から作った名前を用いる．
+void
+PrintPatCmd::print_stil_header(ostream& s)
+{
+  const TpgNetwork& network = _network();
+  ymuint ni = network.input_num2();
+  vector<string> name_list(ni);
+  for (ymuint i = 0; i < ni; ++ i) {
+    const char* name = network.input(i)->name();
+    if ( name != nullptr ) {
+      name_list[i] = name;
+    }
+    else {
+      ostringstream buf;
+      buf << "__input" << i;
+      name_list[i] = buf.str();
+    }
+  }
+
+  s << "STIL 1.0;\n"
+    << "Signals {\n";
+  for (ymuint i = 0; i < ni; ++ i) {
+    s << "  \"" << name_list[i] << "\" In;\n";
+  }
+  s << "}\n"
+    << "SignalGroups {\n"
+    << "  \"_pi\" = '";
+  for (ymuint i = 0; i < ni; ++ i) {
+    if ( i > 0 ) {
+      s << " + ";
+    }
+    s << "\"" << name_list[i] << "\"";
+  }
+  s << "';\n"
+    << "}\n"
+    << "Pattern \"satpg\" {\n";
+}
+
 END_NAMESPACE_YM_SATPG
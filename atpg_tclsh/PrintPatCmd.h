@@ -38,6 +38,17 @@ protected:
   cmd_proc(TclObjVector& objv);
 
 
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief STIL 形式のヘッダを出力する．
+  /// @param[in] s 出力先のストリーム
+  void
+  print_stil_header(ostream& s);
+
+
 private:
   //////////////////////////////////////////////////////////////////////
   // データメンバ
@@ -49,6 +60,9 @@ private:
   // num オプションの解析用オブジェクト
   TclPopt* mPoptNum;
 
+  // stil オプションの解析用オブジェクト
+  TclPopt* mPoptStil;
+
 };
 
 END_NAMESPACE_YM_SATPG
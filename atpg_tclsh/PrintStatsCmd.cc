@@ -71,9 +71,9 @@ PrintStatsCmd::cmd_proc(TclObjVector& objv)
   FaultMgr& fmgr = _fault_mgr();
 
   fprintf(stdout, "#A: # of total faults       = %7lu\n", fmgr.rep_list().size());
-  fprintf(stdout, "#B: # of detected faults    = %7lu\n", fmgr.det_list().size());
-  fprintf(stdout, "#C: # of redundant faults   = %7lu\n", fmgr.untest_list().size());
-  fprintf(stdout, "#D: # of undetected faults  = %7lu\n", fmgr.remain_list().size());
+  fprintf(stdout, "#B: # of detected faults    = %7u\n", fmgr.det_num());
+  fprintf(stdout, "#C: # of redundant faults   = %7u\n", fmgr.untest_num());
+  fprintf(stdout, "#D: # of undetected faults  = %7u\n", fmgr.remain_num());
   fprintf(stdout, "#E: # of generated patterns = %7lu\n", _tv_list().size());
   fprintf(stdout, "#F: # of MFFCs              = %7u\n", _network().mffc_num());
   fprintf(stdout, "#G: # of FFRs               = %7u\n", _network().ffr_num());
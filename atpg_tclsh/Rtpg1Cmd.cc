@@ -13,6 +13,7 @@
 #include "FaultMgr.h"
 #include "Fsim.h"
 #include "TvMgr.h"
+#include "PackedValW.h"
 #include "ym/TclPopt.h"
 #include "ym/RandGen.h"
 
@@ -39,6 +40,8 @@ Rtpg1Cmd::Rtpg1Cmd(AtpgMgr* mgr) :
 			       "sepcify the WSA limit (double)");
   mPoptMcmc = new TclPoptUint(this, "mcmc",
 			      "MCMC mode");
+  mPoptFsim = new TclPoptStr(this, "fsim",
+			     "specify the fault simulator [fsim2|fsim3|tfsim2]");
   mPoptFile = new TclPoptStr(this, "file",
 			     "specify the file name containg patterns");
   mPoptPrintStats = new TclPopt(this, "print_stats",
@@ -60,6 +63,24 @@ Rtpg1Cmd::cmd_proc(TclObjVector& objv)
     return TCL_ERROR;
   }
 
+  // 用いる故障シミュレータ
+  // デフォルトは遷移故障用
+  Fsim* fsim_p = &_tfsim();
+  if ( mPoptFsim->is_specified() ) {
+    string fsim_type = mPoptFsim->val();
+    if ( fsim_type == "fsim2" ) {
+      fsim_p = &_fsim();
+    }
+    else if ( fsim_type == "fsim3" ) {
+      fsim_p = &_fsim3();
+    }
+    else if ( fsim_type != "tfsim2" ) {
+      print_usage();
+      return TCL_ERROR;
+    }
+  }
+  Fsim& fsim = *fsim_p;
+
   RtpgTP* rtpg = nullptr;
   if ( mPoptMcmc->is_specified() ) {
     ymuint nbits = mPoptMcmc->val();
@@ -101,22 +122,39 @@ Rtpg1Cmd::cmd_proc(TclObjVector& objv)
     // 平均の WSA を求める．
     RandGen randgen;
     ymuint n_count = 10000;
-    Fsim& fsim = _tfsim();
     TvMgr& tvmgr = _tv_mgr();
-    TestVector* tv = tvmgr.new_vector();
+    vector<TestVector*> tv_array(kPvwBitLen);
+    for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+      tv_array[i] = tvmgr.new_vector();
+    }
+    vector<ymuint> wsa_array;
     ymuint wsa_sum = 0;
     ymuint wsa_max = 0;
     ymuint wsa_min = 0;
-    for (ymuint i = 0; i < n_count; ++ i) {
-      tv->set_from_random(randgen);
-      ymuint wsa1 = fsim.calc_wsa(tv);
-      wsa_sum += wsa1;
-      if ( wsa_max < wsa1 ) {
-	wsa_max = wsa1;
+    for (ymuint base = 0; base < n_count; base += kPvwBitLen) {
+      // kPvwBitLen 個ずつまとめて計算する．
+      ymuint nb = n_count - base;
+      if ( nb > kPvwBitLen ) {
+	nb = kPvwBitLen;
       }
-      if ( wsa_min == 0 || wsa_min > wsa1 ) {
-	wsa_min = wsa1;
+      vector<TestVector*> cur_array(tv_array.begin(), tv_array.begin() + nb);
+      for (ymuint i = 0; i < nb; ++ i) {
+	cur_array[i]->set_from_random(randgen);
       }
+      fsim.calc_wsa(cur_array, wsa_array);
+      for (ymuint i = 0; i < nb; ++ i) {
+	ymuint wsa1 = wsa_array[i];
+	wsa_sum += wsa1;
+	if ( wsa_max < wsa1 ) {
+	  wsa_max = wsa1;
+	}
+	if ( wsa_min == 0 || wsa_min > wsa1 ) {
+	  wsa_min = wsa1;
+	}
+      }
+    }
+    for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+      tvmgr.delete_vector(tv_array[i]);
     }
     double wsa_ave = static_cast<double>(wsa_sum) / static_cast<double>(n_count);
     wsa_limit = static_cast<ymuint>(wsa_ave * wsa_ratio);
@@ -138,15 +176,13 @@ Rtpg1Cmd::cmd_proc(TclObjVector& objv)
   }
 
   FaultMgr& fmgr = _fault_mgr();
-  Fsim& fsim = _tfsim();
   TvMgr& tvmgr = _tv_mgr();
-  const vector<const TpgFault*>& fault_list = fmgr.remain_list();
 
   vector<const TpgFault*> det_fault_list;
   vector<TestVector*>& tv_list = _tv_list();
   RtpgStats stats;
 
-  rtpg->run(fault_list, tvmgr, fsim, min_f, max_i, max_pat, wsa_limit, det_fault_list, tv_list, stats);
+  rtpg->run(fmgr, tvmgr, fsim, min_f, max_i, max_pat, wsa_limit, det_fault_list, tv_list, stats);
 
   for (ymuint i = 0; i < det_fault_list.size(); ++ i) {
     const TpgFault* fault = det_fault_list[i];
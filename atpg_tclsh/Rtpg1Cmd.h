@@ -61,6 +61,9 @@ private:
   // mcmc オプションの解析用オブジェクト
   TclPoptUint* mPoptMcmc;
 
+  // fsim オプションの解析用オブジェクト
+  TclPoptStr* mPoptFsim;
+
   // file オプションの解析用オブジェクト
   TclPoptStr* mPoptFile;
 
@@ -35,6 +35,8 @@ RtpgCmd::RtpgCmd(AtpgMgr* mgr) :
 			      "sepcify the random seed");
   mPoptFile = new TclPoptStr(this, "file",
 			     "specify the file name containg patterns");
+  mPoptThreads = new TclPoptUint(this, "threads",
+				 "specify the number of threads for fault simulation <INT>");
   mPoptPrintStats = new TclPopt(this, "print_stats",
 				"print statistics");
 }
@@ -92,13 +94,19 @@ RtpgCmd::cmd_proc(TclObjVector& objv)
   FaultMgr& fmgr = _fault_mgr();
   Fsim& fsim = _fsim();
   TvMgr& tvmgr = _tv_mgr();
-  const vector<const TpgFault*>& fault_list = fmgr.remain_list();
 
   vector<const TpgFault*> det_fault_list;
   vector<TestVector*>& tv_list = _tv_list();
   RtpgStats stats;
 
-  rtpg->run(fault_list, tvmgr, fsim, min_f, max_i, max_pat, det_fault_list, tv_list, stats);
+  if ( mPoptThreads->is_specified() ) {
+    fsim.set_thread_num(mPoptThreads->val());
+  }
+
+  rtpg->run(fmgr, tvmgr, fsim, min_f, max_i, max_pat, det_fault_list, tv_list, stats);
+
+  // 他のコマンドに影響しないように元に戻しておく．
+  fsim.set_thread_num(1);
 
   for (ymuint i = 0; i < det_fault_list.size(); ++ i) {
     const TpgFault* fault = det_fault_list[i];
@@ -58,6 +58,9 @@ private:
   // file オプションの解析用オブジェクト
   TclPoptStr* mPoptFile;
 
+  // threads オプションの解析用オブジェクト
+  TclPoptUint* mPoptThreads;
+
   // print_stats オプションの解析用オブジェクト
   TclPopt* mPoptPrintStats;
 
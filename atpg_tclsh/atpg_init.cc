@@ -12,8 +12,10 @@
 #include "AtpgMgr.h"
 #include "AtpgCmd.h"
 #include "NtwkIoCmd.h"
+#include "PatIoCmd.h"
 #include "RtpgCmd.h"
 #include "Rtpg1Cmd.h"
+#include "FsimFileCmd.h"
 #include "DtpgCmd.h"
 #include "MinPatCmd.h"
 #include "PrintFaultCmd.h"
@@ -49,8 +51,11 @@ atpg_init(Tcl_Interp* interp)
   TclCmdBinder1<PrintStatsCmd, AtpgMgr*>::reg(interp, mgr, "::atpg::print_stats");
   TclCmdBinder1<PrintPatCmd, AtpgMgr*>::reg(interp, mgr, "::atpg::print_pat");
   TclCmdBinder1<PrintPatStatsCmd, AtpgMgr*>::reg(interp, mgr, "::atpg::print_pat_stats");
+  TclCmdBinder1<WritePat, AtpgMgr*>::reg(interp, mgr, "::atpg::write_pat");
+  TclCmdBinder1<ReadPat, AtpgMgr*>::reg(interp, mgr, "::atpg::read_pat");
   TclCmdBinder1<RtpgCmd, AtpgMgr*>::reg(interp, mgr, "::atpg::rtpg");
   TclCmdBinder1<Rtpg1Cmd, AtpgMgr*>::reg(interp, mgr, "::atpg::rtpg1");
+  TclCmdBinder1<FsimFileCmd, AtpgMgr*>::reg(interp, mgr, "::atpg::fsim_file");
   TclCmdBinder1<DtpgCmd, AtpgMgr*>::reg(interp, mgr, "::atpg::dtpg");
   TclCmdBinder1<MinPatCmd, AtpgMgr*>::reg(interp, mgr, "::atpg::minpat");
   TclCmdBinder<StopwatchCls>::reg(interp, "atpg::stopwatch");
@@ -70,8 +75,11 @@ atpg_init(Tcl_Interp* interp)
       << "proc complete(print_stats) { t s e l p m } { return \"\" }" << endl
       << "proc complete(print_pat) { t s e l p m } { return \"\" }" << endl
       << "proc complete(print_pat_stats) { t s e l p m } { return \"\" }" << endl
+      << "proc complete(write_pat) { t s e l p m } { return \"\" }" << endl
+      << "proc complete(read_pat) { t s e l p m } { return \"\" }" << endl
       << "proc complete(rtpg) { t s e l p m } { return \"\" }" << endl
       << "proc complete(rtpg1) { t s e l p m } { return \"\" }" << endl
+      << "proc complete(fsim_file) { t s e l p m } { return \"\" }" << endl
       << "proc complete(dtpg) { t s e l p m } { return \"\" }" << endl
       << "proc complete(minpat) { t s e l p m } { return \"\" }" << endl
       << "proc complete(stopwatch) { t s e l p m } { return \"\" }" << endl
@@ -0,0 +1,235 @@
+
+/// @file FgMgrTest.cc
+/// @brief FgMgrBase::find_group2() のテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "satpg.h"
+#include "FgMgrBase.h"
+#include "GroupSolver.h"
+#include "FaultAnalyzer.h"
+#include "NodeValList.h"
+#include "TpgNetwork.h"
+#include "TpgNode.h"
+#include "FaultMgr.h"
+#include "TvMgr.h"
+#include "RandNetwork.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+class FgMgrTest :
+public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  FgMgrTest() { }
+
+  /// @brief ランダムな回路を作って故障解析を行う．
+  /// @param[in] ni 入力数
+  /// @param[in] ng ゲート数
+  /// @param[in] no 出力数
+  void
+  make_network(ymuint ni,
+	       ymuint ng,
+	       ymuint no);
+
+  /// @brief find_group2() で故障をグループに分ける．
+  /// @param[in] thread_num スレッド数
+  /// @param[in] fast 高速ヒューリスティック
+  /// @param[out] fid_list_array 各グループの故障番号のリスト
+  /// @param[out] suf_list_array 各グループの十分割当
+  void
+  make_groups(ymuint thread_num,
+	      bool fast,
+	      vector<vector<ymuint> >& fid_list_array,
+	      vector<NodeValList>& suf_list_array);
+
+  /// @brief スレッド数を変えて結果を比較する．
+  /// @param[in] thread_num スレッド数
+  /// @param[in] fast 高速ヒューリスティック
+  void
+  do_test(ymuint thread_num,
+	  bool fast);
+
+
+protected:
+
+  // 乱数生成器
+  RandGen mRandGen;
+
+  // ネットワーク
+  TpgNetwork mNetwork;
+
+  // 故障マネージャ
+  FaultMgr mFaultMgr;
+
+  // テストベクタマネージャ
+  TvMgr mTvMgr;
+
+  // 故障解析器
+  FaultAnalyzer mAnalyzer;
+
+};
+
+// @brief ランダムな回路を作って故障解析を行う．
+// @param[in] ni 入力数
+// @param[in] ng ゲート数
+// @param[in] no 出力数
+void
+FgMgrTest::make_network(ymuint ni,
+			ymuint ng,
+			ymuint no)
+{
+  ASSERT_TRUE( make_rand_network(mRandGen, ni, ng, no, mNetwork) );
+  mFaultMgr.set_faults(mNetwork);
+  mTvMgr.init(mNetwork.input_num2());
+  mAnalyzer.init(mNetwork, mFaultMgr, mTvMgr);
+}
+
+// @brief find_group2() で故障をグループに分ける．
+// @param[in] thread_num スレッド数
+// @param[in] fast 高速ヒューリスティック
+// @param[out] fid_list_array 各グループの故障番号のリスト
+// @param[out] suf_list_array 各グループの十分割当
+void
+FgMgrTest::make_groups(ymuint thread_num,
+		       bool fast,
+		       vector<vector<ymuint> >& fid_list_array,
+		       vector<NodeValList>& suf_list_array)
+{
+  FgMgrBase fgmgr(mAnalyzer.max_node_id(), mAnalyzer);
+  fgmgr.set_thread_num(thread_num);
+
+  // MinPatBase::run() と同様に既存のグループをすべて調べる．
+  vector<ymuint> group_list;
+  const vector<ymuint>& fid_list = mAnalyzer.fid_list();
+  for (ymuint i = 0; i < fid_list.size(); ++ i) {
+    ymuint fid = fid_list[i];
+    ymuint gid = fgmgr.find_group2(fid, group_list, fast);
+    if ( gid == fgmgr.group_num() ) {
+      gid = fgmgr.new_group(fid);
+      group_list.push_back(gid);
+    }
+  }
+
+  ymuint ng = fgmgr.group_num();
+  fid_list_array.clear();
+  fid_list_array.resize(ng);
+  suf_list_array.clear();
+  suf_list_array.resize(ng);
+  for (ymuint gid = 0; gid < ng; ++ gid) {
+    ymuint nf = fgmgr.fault_num(gid);
+    for (ymuint j = 0; j < nf; ++ j) {
+      fid_list_array[gid].push_back(fgmgr.fault_id(gid, j));
+    }
+    suf_list_array[gid] = fgmgr.sufficient_assignment(gid);
+  }
+}
+
+// @brief スレッド数を変えて結果を比較する．
+// @param[in] thread_num スレッド数
+// @param[in] fast 高速ヒューリスティック
+void
+FgMgrTest::do_test(ymuint thread_num,
+		   bool fast)
+{
+  vector<vector<ymuint> > fid_list_array1;
+  vector<NodeValList> suf_list_array1;
+  make_groups(1, fast, fid_list_array1, suf_list_array1);
+
+  // 並列版が使われるだけのグループ数がないと意味がない．
+  ASSERT_LE( 16U, fid_list_array1.size() )
+    << "the test circuit is too small";
+
+  vector<vector<ymuint> > fid_list_array2;
+  vector<NodeValList> suf_list_array2;
+  make_groups(thread_num, fast, fid_list_array2, suf_list_array2);
+
+  ASSERT_EQ( fid_list_array1.size(), fid_list_array2.size() );
+  for (ymuint gid = 0; gid < fid_list_array1.size(); ++ gid) {
+    EXPECT_EQ( fid_list_array1[gid], fid_list_array2[gid] )
+      << "thread_num = " << thread_num << ", group#" << gid;
+
+    if ( !fast ) {
+      // グループのソルバの SAT の解はソルバの履歴で変わるので
+      // 十分割当までは一致しない．
+      continue;
+    }
+    const NodeValList& suf_list1 = suf_list_array1[gid];
+    const NodeValList& suf_list2 = suf_list_array2[gid];
+    ASSERT_EQ( suf_list1.size(), suf_list2.size() )
+      << "thread_num = " << thread_num << ", group#" << gid;
+    for (ymuint j = 0; j < suf_list1.size(); ++ j) {
+      EXPECT_EQ( suf_list1[j].node()->id(), suf_list2[j].node()->id() );
+      EXPECT_EQ( suf_list1[j].val(), suf_list2[j].val() );
+    }
+  }
+}
+
+
+TEST_F(FgMgrTest, threads)
+{
+  make_network(32, 400, 24);
+
+  do_test(2, false);
+  do_test(4, false);
+  do_test(8, false);
+}
+
+TEST_F(FgMgrTest, threads_fast)
+{
+  make_network(32, 400, 24);
+
+  do_test(4, true);
+}
+
+// 故障を追加してもグループのソルバが作り直されないことを調べる．
+TEST_F(FgMgrTest, keep_solver)
+{
+  make_network(16, 120, 8);
+
+  const vector<ymuint>& fid_list = mAnalyzer.fid_list();
+  ASSERT_FALSE( fid_list.empty() );
+
+  FgMgrBase fgmgr(mAnalyzer.max_node_id(), mAnalyzer);
+  ymuint gid = fgmgr.new_group(fid_list[0]);
+  vector<ymuint> group_list(1, gid);
+
+  // 取り消しの回数が少ないうちはソルバを作り直す理由はない．
+  ymuint n = fid_list.size();
+  if ( n > 32 ) {
+    n = 32;
+  }
+  ymuint commit_num = 0;
+  for (ymuint i = 1; i < n; ++ i) {
+    ymuint fid = fid_list[i];
+    const GroupSolver* solver0 = fgmgr.group_solver(gid);
+    ymuint ans_gid = fgmgr.find_group2(fid, group_list, false);
+    const GroupSolver* solver = fgmgr.group_solver(gid);
+    if ( solver0 != nullptr ) {
+      EXPECT_EQ( solver0, solver ) << "fid = " << fid;
+    }
+    if ( solver == nullptr ) {
+      continue;
+    }
+    EXPECT_FALSE( solver->has_pending() );
+
+    // ソルバの故障リストはグループの故障リストの先頭部分になっている．
+    ASSERT_LE( solver->fault_num(), fgmgr.fault_num(gid) );
+    for (ymuint j = 0; j < solver->fault_num(); ++ j) {
+      EXPECT_EQ( fgmgr.fault_id(gid, j), solver->fault_id(j) );
+    }
+    if ( ans_gid == gid && solver0 != nullptr ) {
+      ++ commit_num;
+    }
+  }
+  EXPECT_LT( 0U, commit_num );
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,205 @@
+
+/// @file GroupSolverTest.cc
+/// @brief GroupSolver のテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "satpg.h"
+#include "GroupSolver.h"
+#include "FaultAnalyzer.h"
+#include "FaultInfo.h"
+#include "StructSat.h"
+#include "TpgNetwork.h"
+#include "FaultMgr.h"
+#include "TvMgr.h"
+#include "RandNetwork.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+class GroupSolverTest :
+public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  GroupSolverTest() { }
+
+  /// @brief ランダムな回路を作って故障解析を行う．
+  /// @param[in] ni 入力数
+  /// @param[in] ng ゲート数
+  /// @param[in] no 出力数
+  void
+  make_network(ymuint ni,
+	       ymuint ng,
+	       ymuint no);
+
+  /// @brief 故障が故障のリストと両立するか毎回 CNF を作って調べる．
+  /// @param[in] fid_list 故障番号のリスト
+  /// @param[in] fid 対象の故障番号
+  bool
+  check_compat(const vector<ymuint>& fid_list,
+	       ymuint fid);
+
+
+protected:
+
+  // 乱数生成器
+  RandGen mRandGen;
+
+  // ネットワーク
+  TpgNetwork mNetwork;
+
+  // 故障マネージャ
+  FaultMgr mFaultMgr;
+
+  // テストベクタマネージャ
+  TvMgr mTvMgr;
+
+  // 故障解析器
+  FaultAnalyzer mAnalyzer;
+
+};
+
+// @brief ランダムな回路を作って故障解析を行う．
+// @param[in] ni 入力数
+// @param[in] ng ゲート数
+// @param[in] no 出力数
+void
+GroupSolverTest::make_network(ymuint ni,
+			      ymuint ng,
+			      ymuint no)
+{
+  ASSERT_TRUE( make_rand_network(mRandGen, ni, ng, no, mNetwork) );
+  mFaultMgr.set_faults(mNetwork);
+  mTvMgr.init(mNetwork.input_num2());
+  mAnalyzer.init(mNetwork, mFaultMgr, mTvMgr);
+}
+
+// @brief 故障が故障のリストと両立するか毎回 CNF を作って調べる．
+// @param[in] fid_list 故障番号のリスト
+// @param[in] fid 対象の故障番号
+bool
+GroupSolverTest::check_compat(const vector<ymuint>& fid_list,
+			      ymuint fid)
+{
+  StructSat struct_sat(mAnalyzer.max_node_id());
+  vector<ymuint> fid_list1(fid_list);
+  fid_list1.push_back(fid);
+  for (ymuint i = 0; i < fid_list1.size(); ++ i) {
+    const FaultInfo& fi = mAnalyzer.fault_info(fid_list1[i]);
+    struct_sat.add_assignments(fi.mandatory_assignment());
+    if ( !fi.single_cube() ) {
+      struct_sat.add_focone(fi.fault(), kVal1);
+    }
+  }
+  return struct_sat.check_sat() == kB3True;
+}
+
+
+// 故障を貪欲にグループに分けながら，
+// インクリメンタルな検査の結果を毎回 CNF を作った結果と比較する．
+TEST_F(GroupSolverTest, greedy_grouping)
+{
+  make_network(16, 120, 8);
+
+  const vector<ymuint>& fid_list = mAnalyzer.fid_list();
+  ASSERT_FALSE( fid_list.empty() );
+
+  const ymuint max_group_num = 8;
+  vector<GroupSolver*> solver_list;
+  vector<vector<ymuint> > group_list;
+  for (ymuint i = 0; i < fid_list.size(); ++ i) {
+    ymuint fid = fid_list[i];
+    bool found = false;
+    for (ymuint j = 0; j < solver_list.size(); ++ j) {
+      GroupSolver* solver = solver_list[j];
+      vector<SatBool3> sat_model;
+      bool stat = solver->check_fault(fid, sat_model);
+      EXPECT_TRUE( solver->has_pending() );
+      EXPECT_EQ( check_compat(group_list[j], fid), stat )
+	<< "fid = " << fid << ", group#" << j;
+      if ( stat && !found ) {
+	// 保留中の故障の十分割当は矛盾のない割当になっているはず．
+	NodeValList suf_list;
+	solver->get_suf_list(group_list[j].size(), sat_model, suf_list);
+	StructSat struct_sat(mAnalyzer.max_node_id());
+	EXPECT_EQ( kB3True, struct_sat.check_sat(suf_list) );
+
+	solver->commit_fault();
+	group_list[j].push_back(fid);
+	found = true;
+      }
+      else {
+	solver->retract_fault();
+      }
+      EXPECT_FALSE( solver->has_pending() );
+      ASSERT_EQ( group_list[j].size(), solver->fault_num() );
+    }
+    if ( !found && solver_list.size() < max_group_num ) {
+      GroupSolver* solver = new GroupSolver(mAnalyzer.max_node_id(), mAnalyzer);
+      solver->add_fault(fid);
+      solver_list.push_back(solver);
+      group_list.push_back(vector<ymuint>(1, fid));
+    }
+    if ( HasFailure() ) {
+      break;
+    }
+  }
+
+  for (ymuint j = 0; j < solver_list.size(); ++ j) {
+    GroupSolver* solver = solver_list[j];
+    for (ymuint k = 0; k < group_list[j].size(); ++ k) {
+      EXPECT_EQ( group_list[j][k], solver->fault_id(k) );
+    }
+    delete solver;
+  }
+}
+
+// 取り消しを重ねたソルバと既存の故障から作り直したソルバが
+// 同じ結果を返すか調べる．
+TEST_F(GroupSolverTest, rebuild)
+{
+  make_network(12, 80, 6);
+
+  const vector<ymuint>& fid_list = mAnalyzer.fid_list();
+  ASSERT_FALSE( fid_list.empty() );
+
+  GroupSolver solver1(mAnalyzer.max_node_id(), mAnalyzer);
+  solver1.add_fault(fid_list[0]);
+  vector<ymuint> group(1, fid_list[0]);
+  for (ymuint i = 1; i < fid_list.size(); ++ i) {
+    ymuint fid = fid_list[i];
+    vector<SatBool3> sat_model;
+    if ( solver1.check_fault(fid, sat_model) ) {
+      solver1.commit_fault();
+      group.push_back(fid);
+    }
+    else {
+      solver1.retract_fault();
+    }
+  }
+
+  GroupSolver solver2(mAnalyzer.max_node_id(), mAnalyzer);
+  for (ymuint i = 0; i < group.size(); ++ i) {
+    solver2.add_fault(group[i]);
+  }
+  EXPECT_EQ( 0U, solver2.retract_num() );
+
+  for (ymuint i = 0; i < fid_list.size(); ++ i) {
+    ymuint fid = fid_list[i];
+    vector<SatBool3> sat_model1;
+    bool stat1 = solver1.check_fault(fid, sat_model1);
+    solver1.retract_fault();
+    vector<SatBool3> sat_model2;
+    bool stat2 = solver2.check_fault(fid, sat_model2);
+    solver2.retract_fault();
+    EXPECT_EQ( stat2, stat1 ) << "fid = " << fid;
+  }
+}
+
+END_NAMESPACE_YM_SATPG
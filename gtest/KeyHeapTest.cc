@@ -0,0 +1,177 @@
+
+/// @file KeyHeapTest.cc
+/// @brief KeyHeap のテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "satpg.h"
+#include "KeyHeap.h"
+#include "ym/RandGen.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+class KeyHeapTest :
+public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  KeyHeapTest() { }
+
+  /// @brief ヒープの内容を単純な配列と比較する．
+  /// @param[in] heap 対象のヒープ
+  /// @param[in] key_array 要素番号をキーにしてキーを入れた配列
+  /// @param[in] in_array 要素番号をキーにしてヒープに入っているかを入れた配列
+  ///
+  /// キー最大(同じなら番号最小)の要素が先頭にあるかを調べる．
+  void
+  check_top(const KeyHeap& heap,
+	    const vector<int>& key_array,
+	    const vector<bool>& in_array);
+
+
+protected:
+
+  // 乱数生成器
+  RandGen mRandGen;
+
+};
+
+// @brief ヒープの内容を単純な配列と比較する．
+void
+KeyHeapTest::check_top(const KeyHeap& heap,
+		       const vector<int>& key_array,
+		       const vector<bool>& in_array)
+{
+  ymuint n = key_array.size();
+  ymuint num = 0;
+  ymuint best = n;
+  for (ymuint i = 0; i < n; ++ i) {
+    EXPECT_EQ( in_array[i], heap.in_heap(i) );
+    if ( !in_array[i] ) {
+      continue;
+    }
+    EXPECT_EQ( key_array[i], heap.key(i) );
+    ++ num;
+    if ( best == n || key_array[i] > key_array[best] ) {
+      best = i;
+    }
+  }
+  ASSERT_EQ( num, heap.size() );
+  if ( num > 0 ) {
+    EXPECT_EQ( best, heap.top() );
+  }
+  else {
+    EXPECT_TRUE( heap.empty() );
+  }
+}
+
+
+TEST_F(KeyHeapTest, empty)
+{
+  KeyHeap heap;
+  heap.init(10);
+  EXPECT_TRUE( heap.empty() );
+  EXPECT_EQ( 0U, heap.size() );
+  for (ymuint i = 0; i < 10; ++ i) {
+    EXPECT_FALSE( heap.in_heap(i) );
+  }
+}
+
+TEST_F(KeyHeapTest, pop_order)
+{
+  int keys[] = { 3, -1, 7, 3, 0, 7, -5, 2 };
+  ymuint n = sizeof(keys) / sizeof(int);
+
+  KeyHeap heap;
+  heap.init(n);
+  for (ymuint i = 0; i < n; ++ i) {
+    heap.put(i, keys[i]);
+  }
+
+  // キーの降順，同じキーなら番号の昇順に取り出される．
+  ymuint expected[] = { 2, 5, 0, 3, 7, 4, 1, 6 };
+  for (ymuint i = 0; i < n; ++ i) {
+    EXPECT_EQ( expected[i], heap.pop_top() );
+  }
+  EXPECT_TRUE( heap.empty() );
+}
+
+TEST_F(KeyHeapTest, update_and_remove)
+{
+  KeyHeap heap;
+  heap.init(4);
+  heap.put(0, 1);
+  heap.put(1, 2);
+  heap.put(2, 3);
+  EXPECT_EQ( 2U, heap.top() );
+
+  // キーを下げる
+  heap.put(2, 0);
+  EXPECT_EQ( 1U, heap.top() );
+
+  // キーを上げる
+  heap.put(0, 5);
+  EXPECT_EQ( 0U, heap.top() );
+
+  // 先頭を削除する
+  heap.remove(0);
+  EXPECT_FALSE( heap.in_heap(0) );
+  EXPECT_EQ( 1U, heap.top() );
+
+  // 入っていない要素の削除はなにもしない
+  heap.remove(3);
+  EXPECT_EQ( 2U, heap.size() );
+
+  heap.clear();
+  EXPECT_TRUE( heap.empty() );
+  EXPECT_FALSE( heap.in_heap(1) );
+}
+
+TEST_F(KeyHeapTest, random)
+{
+  const ymuint n = 200;
+  KeyHeap heap;
+  heap.init(n);
+  vector<int> key_array(n, 0);
+  vector<bool> in_array(n, false);
+
+  for (ymuint c = 0; c < 5000; ++ c) {
+    ymuint id = mRandGen.int32() % n;
+    switch ( mRandGen.int32() % 4 ) {
+    case 0:
+    case 1:
+      {
+	// 少ない種類のキーにして同じキーの要素を多くする．
+	int key = static_cast<int>(mRandGen.int32() % 21) - 10;
+	heap.put(id, key);
+	key_array[id] = key;
+	in_array[id] = true;
+      }
+      break;
+
+    case 2:
+      heap.remove(id);
+      in_array[id] = false;
+      break;
+
+    case 3:
+      if ( !heap.empty() ) {
+	ymuint id1 = heap.pop_top();
+	in_array[id1] = false;
+      }
+      break;
+    }
+    check_top(heap, key_array, in_array);
+    if ( HasFailure() ) {
+      break;
+    }
+  }
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,82 @@
+
+/// @file RandNetwork.cc
+/// @brief テスト用のランダムな回路を作る関数の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "RandNetwork.h"
+#include "TpgNetwork.h"
+#include <fstream>
+#include <cstdlib>
+#include <unistd.h>
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+// @brief ランダムな回路を作る．
+// @param[in] rand_gen 乱数生成器
+// @param[in] ni 入力数
+// @param[in] ng ゲート数
+// @param[in] no 出力数
+// @param[out] network 作った回路を格納するネットワーク
+// @return 正しく作れたら true を返す．
+bool
+make_rand_network(RandGen& rand_gen,
+		  ymuint ni,
+		  ymuint ng,
+		  ymuint no,
+		  TpgNetwork& network)
+{
+  const char* gate_names[] = { "AND", "NAND", "OR", "NOR", "XOR" };
+  const ymuint n_gate_names = sizeof(gate_names) / sizeof(const char*);
+
+  // 同時に走るテストとぶつからないように一時ファイルを作る．
+  const char* tmpdir = getenv("TMPDIR");
+  if ( tmpdir == nullptr || tmpdir[0] == '\0' ) {
+    tmpdir = "/tmp";
+  }
+  string tmp_template = string(tmpdir) + "/satpgXXXXXX";
+  vector<char> buff(tmp_template.begin(), tmp_template.end());
+  buff.push_back('\0');
+  int fd = mkstemp(&buff[0]);
+  if ( fd < 0 ) {
+    return false;
+  }
+  close(fd);
+  string filename(&buff[0]);
+
+  {
+    ofstream s(filename.c_str());
+    if ( !s ) {
+      unlink(filename.c_str());
+      return false;
+    }
+    for (ymuint i = 0; i < ni; ++ i) {
+      s << "INPUT(n" << i << ")" << endl;
+    }
+    for (ymuint i = 0; i < no; ++ i) {
+      s << "OUTPUT(n" << (ni + ng - no + i) << ")" << endl;
+    }
+    for (ymuint i = 0; i < ng; ++ i) {
+      // 直前の信号線を優先して選び，段数の深い回路にする．
+      ymuint id = ni + i;
+      ymuint id0 = id - 1 - rand_gen.int32() % (id < 8 ? id : 8);
+      ymuint id1 = rand_gen.int32() % id;
+      if ( id1 == id0 ) {
+	id1 = (id0 == 0) ? 1 : 0;
+      }
+      const char* gname = gate_names[rand_gen.int32() % n_gate_names];
+      s << "n" << id << " = " << gname
+	<< "(n" << id0 << ", n" << id1 << ")" << endl;
+    }
+  }
+
+  bool stat = network.read_iscas89(filename);
+  unlink(filename.c_str());
+  return stat;
+}
+
+END_NAMESPACE_YM_SATPG
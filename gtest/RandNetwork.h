@@ -0,0 +1,37 @@
+#ifndef RANDNETWORK_H
+#define RANDNETWORK_H
+
+/// @file RandNetwork.h
+/// @brief テスト用のランダムな回路を作る関数の定義ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "ym/RandGen.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+/// @brief ランダムな回路を作る．
+/// @param[in] rand_gen 乱数生成器
+/// @param[in] ni 入力数
+/// @param[in] ng ゲート数
+/// @param[in] no 出力数
+/// @param[out] network 作った回路を格納するネットワーク
+/// @return 正しく作れたら true を返す．
+///
+/// 2入力のゲートのみからなる ISCAS89 形式のファイルを一時ファイルに書き出し，
+/// それを読み込む．一時ファイルは読み込んだ後で削除する．
+bool
+make_rand_network(RandGen& rand_gen,
+		  ymuint ni,
+		  ymuint ng,
+		  ymuint no,
+		  TpgNetwork& network);
+
+END_NAMESPACE_YM_SATPG
+
+#endif // RANDNETWORK_H
@@ -0,0 +1,119 @@
+
+/// @file TestVectorTest.cc
+/// @brief TestVector::transpose() のテスト
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "gtest/gtest.h"
+#include "satpg.h"
+#include "TestVector.h"
+#include "TvMgr.h"
+#include "PackedValW.h"
+#include "ym/RandGen.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+class TestVectorTest :
+public ::testing::Test
+{
+public:
+
+  /// @brief コンストラクタ
+  TestVectorTest() { }
+
+  /// @brief transpose() の結果を val3() と比較する．
+  /// @param[in] ni 入力数
+  /// @param[in] nb テストベクタ数
+  void
+  do_test(ymuint ni,
+	  ymuint nb);
+
+
+protected:
+
+  // 乱数生成器
+  RandGen mRandGen;
+
+};
+
+// @brief transpose() の結果を val3() と比較する．
+// @param[in] ni 入力数
+// @param[in] nb テストベクタ数
+void
+TestVectorTest::do_test(ymuint ni,
+			ymuint nb)
+{
+  TvMgr tvmgr;
+  tvmgr.init(ni);
+
+  // X を含むランダムなテストベクタを作る．
+  vector<TestVector*> tv_array(nb);
+  for (ymuint j = 0; j < nb; ++ j) {
+    TestVector* tv = tvmgr.new_vector();
+    for (ymuint i = 0; i < ni; ++ i) {
+      switch ( mRandGen.int32() % 3 ) {
+      case 0: tv->set_val(i, kVal0); break;
+      case 1: tv->set_val(i, kVal1); break;
+      case 2: tv->set_val(i, kValX); break;
+      }
+    }
+    tv_array[j] = tv;
+  }
+
+  vector<PackedValW> val0_array(ni, kPvwAll0);
+  vector<PackedValW> val1_array(ni, kPvwAll0);
+  TestVector::transpose(tv_array, val0_array.data(), val1_array.data());
+
+  // 片方だけを求めた場合も同じ結果になるはず
+  vector<PackedValW> val1_only(ni, kPvwAll0);
+  TestVector::transpose(tv_array, nullptr, val1_only.data());
+
+  for (ymuint i = 0; i < ni; ++ i) {
+    for (ymuint p = 0; p < kPvwBitLen; ++ p) {
+      // 残ったビットは 0 番めのパタンの値
+      const TestVector* tv = tv_array[p < nb ? p : 0];
+      Val3 val = tv->val3(i);
+      EXPECT_EQ( val == kVal0, val0_array[i].check_bit(p) )
+	<< "ni = " << ni << ", nb = " << nb << ", i = " << i << ", p = " << p;
+      EXPECT_EQ( val == kVal1, val1_array[i].check_bit(p) )
+	<< "ni = " << ni << ", nb = " << nb << ", i = " << i << ", p = " << p;
+    }
+    EXPECT_EQ( val1_array[i], val1_only[i] );
+  }
+}
+
+
+TEST_F(TestVectorTest, single)
+{
+  do_test(1, 1);
+}
+
+TEST_F(TestVectorTest, one_word)
+{
+  do_test(64, 64);
+}
+
+TEST_F(TestVectorTest, partial_inputs)
+{
+  do_test(65, kPvwBitLen);
+  do_test(130, kPvwBitLen);
+}
+
+TEST_F(TestVectorTest, partial_block)
+{
+  do_test(100, 1);
+  do_test(100, 63);
+  do_test(100, 65);
+  do_test(100, kPvwBitLen - 1);
+}
+
+TEST_F(TestVectorTest, full_block)
+{
+  do_test(200, kPvwBitLen);
+}
+
+END_NAMESPACE_YM_SATPG
@@ -40,6 +40,14 @@ public:
   operator()(const TpgFault* f,
 	     const NodeValList& assign_list) = 0;
 
+  /// @brief 溜め込んでいる処理を全て実行する．
+  ///
+  /// パタンをまとめて処理するクラスのためのフック．
+  /// デフォルトの実装はなにもしない．
+  virtual
+  void
+  flush();
+
 };
 
 /// @brief 'base' タイプを生成する．
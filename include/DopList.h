@@ -50,6 +50,11 @@ public:
   operator()(const TpgFault* f,
 	     const NodeValList& assign_list);
 
+  /// @brief 溜め込んでいる処理を全て実行する．
+  virtual
+  void
+  flush();
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -61,6 +61,8 @@ public:
   /// @param[in] fsim 故障シミュレータ
   /// @param[in] fault_list 対象の故障リスト
   /// @param[out] stats 結果を格納する構造体
+  ///
+  /// fsim には set_faults(fmgr) で fmgr の未検出の故障がセットされる．
   virtual
   void
   run(TpgNetwork& tgnetwork,
@@ -102,6 +104,23 @@ new_DtpgSatF(const string& sat_type,
 	     DetectOp& dop,
 	     UntestOp& uop);
 
+/// @brief 遷移故障用のエンジンを作る．
+/// @param[in] sat_type SATソルバの種類を表す文字列
+/// @param[in] sat_option SATソルバに渡すオプション文字列
+/// @param[in] sat_outp SATソルバ用の出力ストリーム
+/// @param[in] bt バックトレーサー
+/// @param[in] dop パタンが求められた時に実行されるファンクタ
+/// @param[in] uop 検出不能と判定された時に実行されるファンクタ
+///
+/// 故障シミュレータには TFsim2 を用いること．
+DtpgEngine*
+new_DtpgSatT(const string& sat_type,
+	     const string& sat_option,
+	     ostream* sat_outp,
+	     BackTracer& bt,
+	     DetectOp& dop,
+	     UntestOp& uop);
+
 /// @brief Hierachical エンジンを作る．
 /// @param[in] sat_type SATソルバの種類を表す文字列
 /// @param[in] sat_option SATソルバに渡すオプション文字列
@@ -117,6 +136,23 @@ new_DtpgSatH(const string& sat_type,
 	     DetectOp& dop,
 	     UntestOp& uop);
 
+/// @brief 並列版の Hierachical エンジンを作る．
+/// @param[in] thread_num スレッド数 (0 の場合はハードウェアの並列度)
+/// @param[in] sat_type SATソルバの種類を表す文字列
+/// @param[in] sat_option SATソルバに渡すオプション文字列
+/// @param[in] sat_outp SATソルバ用の出力ストリーム
+/// @param[in] bt バックトレーサー
+/// @param[in] dop パタンが求められた時に実行されるファンクタ
+/// @param[in] uop 検出不能と判定された時に実行されるファンクタ
+DtpgEngine*
+new_DtpgSatP(ymuint thread_num,
+	     const string& sat_type,
+	     const string& sat_option,
+	     ostream* sat_outp,
+	     BackTracer& bt,
+	     DetectOp& dop,
+	     UntestOp& uop);
+
 /// @brief Single2 エンジンを作る．
 /// @param[in] th_val しきい値
 /// @param[in] sat_type SATソルバの種類を表す文字列
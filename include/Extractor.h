@@ -45,6 +45,16 @@ public:
   operator()(const TpgFault* fault,
 	     NodeValList& assign_list);
 
+  /// @brief ノードから外部出力までの伝搬条件の値割当を求める．
+  /// @param[in] root 故障差の生じているノード
+  /// @param[out] assign_list 値の割当リスト
+  ///
+  /// FFR の根に故障差を挿入した場合に用いる．
+  /// 故障の活性化条件と FFR 内の伝搬条件は含まれない．
+  void
+  operator()(const TpgNode* root,
+	     NodeValList& assign_list);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -27,7 +27,13 @@ BEGIN_NAMESPACE_YM_SATPG
 /// 故障の状態変化が FaultMgr::set_status() によって
 /// 通知されるとその内容にしたがって故障リストを変更する．
 ///
-/// ただし故障リストの更新は実際に読み出されるまで遅延される．
+/// 検出済みと検出不能のリストおよび各故障数は定数時間で更新される．
+/// 未検出のリストは順序を保つため，取り除かれた故障の削除を
+/// remain_list() が呼ばれるまで遅延する．
+///
+/// また，未検出の故障リストに出入りした故障は変更ログに記録される．
+/// 変更ログの位置は FaultMgr の生成以来の通し番号で表され，
+/// clear() で破棄された位置は change_log_begin() より前になる．
 //////////////////////////////////////////////////////////////////////
 class FaultMgr
 {
@@ -77,6 +83,19 @@ public:
   ymuint
   untest_num() const;
 
+  /// @brief 変更ログの先頭位置を返す．
+  ymuint
+  change_log_begin() const;
+
+  /// @brief 変更ログの末尾の次の位置を返す．
+  ymuint
+  change_log_end() const;
+
+  /// @brief 変更ログに記録された故障を返す．
+  /// @param[in] pos 位置 ( change_log_begin() <= pos < change_log_end() )
+  const TpgFault*
+  change_log(ymuint pos) const;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -105,10 +124,24 @@ private:
   // 下請け関数
   //////////////////////////////////////////////////////////////////////
 
-  /// @brief 故障リストをスキャンして未検出リストを更新する．
+  /// @brief 未検出リストから取り除かれた故障を削除する．
   void
   update() const;
 
+  /// @brief 検出済みもしくは検出不能のリストに故障を追加する．
+  /// @param[in] fault_list 追加先のリスト
+  /// @param[in] fault 対象の故障
+  void
+  add_to_list(vector<const TpgFault*>& fault_list,
+	      const TpgFault* fault);
+
+  /// @brief 検出済みもしくは検出不能のリストから故障を削除する．
+  /// @param[in] fault_list 削除元のリスト
+  /// @param[in] fault 対象の故障
+  void
+  remove_from_list(vector<const TpgFault*>& fault_list,
+		   const TpgFault* fault);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -122,20 +155,33 @@ private:
   vector<const TpgFault*> mRepList;
 
   // 検出済みの故障を保持しておくリスト
-  mutable
   vector<const TpgFault*> mDetList;
 
   // 未検出の故障を保持しておくリスト
+  // 未検出でなくなった故障も update() が呼ばれるまで残っている．
   mutable
   vector<const TpgFault*> mRemainList;
 
   // 検出不能故障を保持しておくリスト
-  mutable
   vector<const TpgFault*> mUntestList;
 
-  // 故障リストに変化があったことを記録するフラグ
+  // 故障番号をキーにして mDetList か mUntestList 上の位置を保持する配列
+  // どちらにも入っていない故障は -1 となる．
+  vector<int> mListPos;
+
+  // 故障番号をキーにして mRemainList に入っている時 true となる配列
   mutable
-  bool mChanged;
+  vector<bool> mInRemain;
+
+  // mRemainList に残っている未検出でない故障の数
+  mutable
+  ymuint mRemainHole;
+
+  // 未検出のリストに出入りした故障のログ
+  vector<const TpgFault*> mChangeLog;
+
+  // mChangeLog[0] の通し番号
+  ymuint mChangeLogBase;
 
 };
 
@@ -166,7 +212,6 @@ inline
 const vector<const TpgFault*>&
 FaultMgr::det_list() const
 {
-  update();
   return mDetList;
 }
 
@@ -175,7 +220,6 @@ inline
 ymuint
 FaultMgr::det_num() const
 {
-  update();
   return mDetList.size();
 }
 
@@ -193,8 +237,7 @@ inline
 ymuint
 FaultMgr::remain_num() const
 {
-  update();
-  return mRemainList.size();
+  return mRemainList.size() - mRemainHole;
 }
 
 // @brief 検出不能故障のリストを得る．
@@ -202,7 +245,6 @@ inline
 const vector<const TpgFault*>&
 FaultMgr::untest_list() const
 {
-  update();
   return mUntestList;
 }
 
@@ -211,10 +253,35 @@ inline
 ymuint
 FaultMgr::untest_num() const
 {
-  update();
   return mUntestList.size();
 }
 
+// @brief 変更ログの先頭位置を返す．
+inline
+ymuint
+FaultMgr::change_log_begin() const
+{
+  return mChangeLogBase;
+}
+
+// @brief 変更ログの末尾の次の位置を返す．
+inline
+ymuint
+FaultMgr::change_log_end() const
+{
+  return mChangeLogBase + mChangeLog.size();
+}
+
+// @brief 変更ログに記録された故障を返す．
+// @param[in] pos 位置 ( change_log_begin() <= pos < change_log_end() )
+inline
+const TpgFault*
+FaultMgr::change_log(ymuint pos) const
+{
+  ASSERT_COND( pos >= change_log_begin() && pos < change_log_end() );
+  return mChangeLog[pos - mChangeLogBase];
+}
+
 END_NAMESPACE_YM_SATPG
 
 #endif // FAULTMGR_H
@@ -44,6 +44,16 @@ str(FaultStatus fs)
   return "";
 }
 
+/// @brief 未検出の故障リストに入る状態の時 true を返す．
+///
+/// アボートした故障も未検出として扱う．
+inline
+bool
+is_remain(FaultStatus fs)
+{
+  return fs == kFsUndetected || fs == kFsAborted;
+}
+
 END_NAMESPACE_YM_SATPG
 
 #endif // FAULTSTATUS_H
@@ -0,0 +1,147 @@
+﻿#ifndef FILEFSIM_H
+#define FILEFSIM_H
+
+/// @file FileFsim.h
+/// @brief FileFsim のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class FileFsim FileFsim.h "FileFsim.h"
+/// @brief パタンファイルのテストベクタで故障シミュレーションを行うクラス
+///
+/// ファイルは TvWriter の形式で書かれていなければならない．
+/// テストベクタは Fsim::ppsfp() で一度に扱える数ずつ読み込み，
+/// 読み込み用の領域を使いまわすので全てのパタンを保持することはない．
+/// 検出された故障は FaultMgr 上で検出済みとなり，以降のシミュレーション
+/// からは外される．
+//////////////////////////////////////////////////////////////////////
+class FileFsim
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] network 対象のネットワーク
+  /// @param[in] fmgr 故障マネージャ
+  /// @param[in] fsim 故障シミュレータ
+  FileFsim(const TpgNetwork& network,
+	   FaultMgr& fmgr,
+	   Fsim& fsim);
+
+  /// @brief デストラクタ
+  ~FileFsim();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 故障シミュレーションを行う．
+  /// @param[in] filename パタンファイル名
+  /// @param[in] interval 途中経過を出力する間隔(パタン数)
+  /// @param[in] s 途中経過の出力先
+  /// @return エラーが起きたら false を返す．
+  ///
+  /// interval が 0 の時は途中経過を出力しない．
+  /// エラーが起きた時でもそれまでに検出された故障は検出済みのままとなる．
+  bool
+  run(const string& filename,
+      ymuint interval = 0,
+      ostream& s = cout);
+
+  /// @brief 直前の run() で読み込んだパタン数を返す．
+  ymuint
+  pattern_num() const;
+
+  /// @brief 直前の run() で検出された故障数を返す．
+  ymuint
+  det_num() const;
+
+  /// @brief 直前の run() のエラーメッセージを返す．
+  const string&
+  error_msg() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 途中経過を出力する．
+  /// @param[in] s 出力先のストリーム
+  void
+  print_progress(ostream& s) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 対象のネットワーク
+  const TpgNetwork& mNetwork;
+
+  // 故障マネージャ
+  FaultMgr& mFaultMgr;
+
+  // 故障シミュレータ
+  Fsim& mFsim;
+
+  // 読み込んだパタン数
+  ymuint mPatNum;
+
+  // 開始時点の検出済み故障数
+  ymuint mDetBase;
+
+  // 検出された故障数
+  ymuint mDetNum;
+
+  // 代表故障数
+  ymuint mRepNum;
+
+  // エラーメッセージ
+  string mErrorMsg;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief 直前の run() で読み込んだパタン数を返す．
+inline
+ymuint
+FileFsim::pattern_num() const
+{
+  return mPatNum;
+}
+
+// @brief 直前の run() で検出された故障数を返す．
+inline
+ymuint
+FileFsim::det_num() const
+{
+  return mDetNum;
+}
+
+// @brief 直前の run() のエラーメッセージを返す．
+inline
+const string&
+FileFsim::error_msg() const
+{
+  return mErrorMsg;
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // FILEFSIM_H
@@ -31,14 +31,18 @@ private:
   /// @param[in] fnode 故障位置のノード
   /// @param[in] bnode ブロックノード
   /// @param[in] detect 検出条件
+  /// @param[in] cvar 検出条件を制御する変数
   ///
   /// ブロックノードより先のノードは含めない．
   /// 通常 bnode は fnode の dominator
   /// となっているはず．
+  /// detect が kVal1 で cvar が kSatVarIdIllegal でない場合，
+  /// 検出条件は cvar が 1 の時のみ課される．
   FoCone(StructSat& struct_sat,
 	 const TpgNode* fnode,
 	 const TpgNode* bnode,
-	 Val3 detect);
+	 Val3 detect,
+	 SatVarId cvar = kSatVarIdIllegal);
 
   /// @brief デストラクタ
   ~FoCone();
@@ -59,6 +59,24 @@ public:
   void
   set_faults(const vector<const TpgFault*>& fault_list) = 0;
 
+  /// @brief 故障マネージャの未検出故障を対象にする．
+  /// @param[in] fmgr 故障マネージャ
+  ///
+  /// 未検出の故障のスキップマークは消される．
+  /// 前回同じ fmgr でこの関数を呼んだ後に set_faults(fault_list) が
+  /// 呼ばれていなければ，fmgr の変更ログを用いて差分のみを反映する．
+  virtual
+  void
+  set_faults(const FaultMgr& fmgr) = 0;
+
+  /// @brief ppsfp() で用いるスレッド数を設定する．
+  /// @param[in] num スレッド数(0 の場合はハードウェアの並列度)
+  ///
+  /// 並列化に対応していない実装では無視される．
+  virtual
+  void
+  set_thread_num(ymuint num) = 0;
+
   /// @brief SPSFP故障シミュレーションを行う．
   /// @param[in] tv テストベクタ
   /// @param[in] f 対象の故障
@@ -98,17 +116,93 @@ public:
   /// @brief 複数のパタンで故障シミュレーションを行う．
   /// @param[in] tv_array テストベクタの配列
   /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  ///
+  /// tv_array の要素数は kPvwBitLen 以下でなければならない．
+  /// 要素数が kPvBitLen 以下の時は PackedVal 版の op が，
+  /// それを越える時は PackedValW 版の op が呼ばれる．
   virtual
   void
   ppsfp(const vector<TestVector*>& tv_array,
 	FsimOp& op) = 0;
 
+  /// @brief 複数のパタンで故障シミュレーションを行う．
+  /// @param[in] assign_list_array 値の割当リストの配列
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  ///
+  /// 割当のない外部入力の値の扱いは sppfp(const NodeValList&) と同じ．
+  /// assign_list_array の要素数と op の呼ばれ方は
+  /// ppsfp(const vector<TestVector*>&) と同じ．
+  virtual
+  void
+  ppsfp(const vector<NodeValList>& assign_list_array,
+	FsimOp& op) = 0;
+
+  /// @brief 複数のパタンで故障シミュレーションを行う．
+  /// @param[in] tv_store テストベクタを保持するオブジェクト
+  /// @param[in] blk ブロック番号 ( 0 <= blk < tv_store.block_num() )
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  ///
+  /// tv_store の blk 番めのブロックのパタンを用いる．
+  /// ブロック内の値をそのまま外部入力にコピーするので
+  /// ppsfp(const vector<TestVector*>&) よりも入力の設定が速い．
+  /// op の呼ばれ方は ppsfp(const vector<TestVector*>&) と同じ．
+  virtual
+  void
+  ppsfp(const TvStore& tv_store,
+	ymuint blk,
+	FsimOp& op) = 0;
+
   /// @brief WSA を計算する．
   /// @param[in] tv テストベクタ
+  ///
+  /// WSA は tv を与えた時刻と，その次の時刻(フリップフロップの値を
+  /// 更新した後)の間で値の変化したノードのファンアウト数の総和である．
   virtual
   ymuint
   calc_wsa(TestVector* tv) = 0;
 
+  /// @brief 複数のパタンの WSA を計算する．
+  /// @param[in] tv_array テストベクタの配列
+  /// @param[out] wsa_array 各パタンの WSA を格納する配列
+  ///
+  /// tv_array の要素数は kPvwBitLen 以下でなければならない．
+  /// wsa_array[i] が tv_array[i] の WSA となる．
+  virtual
+  void
+  calc_wsa(const vector<TestVector*>& tv_array,
+	   vector<ymuint>& wsa_array) = 0;
+
+  /// @brief 差分 WSA 計算用の状態を初期化する．
+  /// @param[in] tv 基準となるテストベクタ
+  /// @return tv の WSA を返す．
+  ///
+  /// 状態は他のシミュレーションを行うと失われることがあるので，
+  /// その後に delta_wsa() を用いる場合には再びこの関数を呼ぶこと．
+  virtual
+  ymuint
+  init_wsa(TestVector* tv) = 0;
+
+  /// @brief 入力を反転させた時の WSA の差分を計算する．
+  /// @param[in] flip_list 反転させる入力番号のリスト
+  /// @return 現在の状態の WSA からの増分を返す．
+  ///
+  /// 値の変化が伝搬する範囲だけを計算し直す．
+  /// 結果は commit_wsa() で確定させるか rollback_wsa() で取り消す．
+  /// どちらかを呼ぶまで次の delta_wsa() を呼んではいけない．
+  virtual
+  int
+  delta_wsa(const vector<ymuint>& flip_list) = 0;
+
+  /// @brief 直前の delta_wsa() の結果を確定させる．
+  virtual
+  void
+  commit_wsa() = 0;
+
+  /// @brief 直前の delta_wsa() の結果を取り消す．
+  virtual
+  void
+  rollback_wsa() = 0;
+
 };
 
 
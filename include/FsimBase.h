@@ -0,0 +1,123 @@
+﻿#ifndef FSIMBASE_H
+#define FSIMBASE_H
+
+/// @file FsimBase.h
+/// @brief FsimBase のヘッダファイル
+///
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "Fsim.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class FsimBase FsimBase.h "FsimBase.h"
+/// @brief 故障マネージャとの同期を行う Fsim の共通部分
+///
+/// set_faults(fmgr) で故障マネージャの変更ログを用いて
+/// 差分のみを反映する処理を実装する．
+/// 継承クラスは _set_faults(), _set_skip(), _clear_skip() を実装する．
+//////////////////////////////////////////////////////////////////////
+class FsimBase :
+  public Fsim
+{
+public:
+
+  /// @brief コンストラクタ
+  FsimBase();
+
+  /// @brief デストラクタ
+  virtual
+  ~FsimBase();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // Fsim の仮想関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 故障にスキップマークをつける．
+  virtual
+  void
+  set_skip(const TpgFault* f);
+
+  /// @brief 故障リストを設定する．
+  /// @param[in] fault_list 対象の故障リスト
+  ///
+  /// スキップマークは消される．
+  virtual
+  void
+  set_faults(const vector<const TpgFault*>& fault_list);
+
+  /// @brief 故障マネージャの未検出故障を対象にする．
+  /// @param[in] fmgr 故障マネージャ
+  ///
+  /// 未検出の故障のスキップマークは消される．
+  virtual
+  void
+  set_faults(const FaultMgr& fmgr);
+
+
+protected:
+  //////////////////////////////////////////////////////////////////////
+  // 継承クラスから用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 故障マネージャとの同期を解除する．
+  ///
+  /// 故障の構造が作り直された時に呼ぶ．
+  void
+  clear_sync();
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 継承クラスが実装する仮想関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 故障リストを設定する．
+  /// @param[in] fault_list 対象の故障リスト
+  ///
+  /// スキップマークは消される．
+  virtual
+  void
+  _set_faults(const vector<const TpgFault*>& fault_list) = 0;
+
+  /// @brief 故障にスキップマークをつける．
+  virtual
+  void
+  _set_skip(const TpgFault* f) = 0;
+
+  /// @brief 故障リストに含まれる故障のスキップマークを消す．
+  ///
+  /// スキップマークがついていない場合には何もしない．
+  virtual
+  void
+  _clear_skip(const TpgFault* f) = 0;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 前回 set_faults(fmgr) で同期した故障マネージャ
+  // set_faults(fault_list) が呼ばれた時は nullptr となる．
+  const FaultMgr* mSyncMgr;
+
+  // mSyncMgr の変更ログの同期済みの位置
+  ymuint mSyncPos;
+
+  // mSyncMgr と同期してからスキップマークをつけた故障のリスト
+  vector<const TpgFault*> mSkipList;
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // FSIMBASE_H
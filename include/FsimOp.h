@@ -11,6 +11,7 @@
 
 #include "satpg.h"
 #include "PackedVal.h"
+#include "PackedValW.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -36,11 +37,23 @@ public:
   /// @brief 故障を検出したときの処理
   /// @param[in] f 故障
   /// @param[in] dpat 検出したパタンを表すビットベクタ
+  ///
+  /// Fsim::ppsfp() に与えたパタン数が kPvBitLen 以下の時に呼ばれる．
   virtual
   void
   operator()(const TpgFault* f,
 	     PackedVal dpat) = 0;
 
+  /// @brief 故障を検出したときの処理(多ワード版)
+  /// @param[in] f 故障
+  /// @param[in] dpat 検出したパタンを表すビットベクタ
+  ///
+  /// Fsim::ppsfp() に与えたパタン数が kPvBitLen を越える時に呼ばれる．
+  virtual
+  void
+  operator()(const TpgFault* f,
+	     const PackedValW& dpat) = 0;
+
 };
 
 END_NAMESPACE_YM_SATPG
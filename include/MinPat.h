@@ -67,6 +67,24 @@ public:
   void
   set_verbose(int verbose) = 0;
 
+  /// @brief スレッド数を設定する．
+  /// @param[in] num スレッド数 (0 の場合はハードウェアの並列度)
+  ///
+  /// 現在は最小被覆圧縮の被覆行列の生成でのみ用いられる．
+  virtual
+  void
+  set_thread_num(ymuint num) = 0;
+
+  /// @brief 最小被覆圧縮の解法を設定する．
+  /// @param[in] heuristic true の時はヒューリスティックで解く．
+  /// @param[in] time_limit 局所探索の制限時間(秒)
+  ///
+  /// heuristic が false の時は厳密解を求める．
+  virtual
+  void
+  set_mc_heuristic(bool heuristic,
+		   double time_limit) = 0;
+
 };
 
 
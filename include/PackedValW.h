@@ -0,0 +1,518 @@
+﻿#ifndef PACKEDVALW_H
+#define PACKEDVALW_H
+
+/// @file PackedValW.h
+/// @brief 複数ワードにパックしたビットベクタ型の定義ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012, 2014 Yusuke Matsunaga
+/// All rights reserved.
+
+#include "PackedVal.h"
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+//////////////////////////////////////////////////////////////////////
+// PackedValW のワード数
+//
+// コンパイル時に SATPG_PVW_WORD_NUM で指定できる．
+// 指定がない場合は AVX-512 が使える時は 8 (512ビット)，
+// それ以外は 4 (256ビット) となる．
+//////////////////////////////////////////////////////////////////////
+#if !defined(SATPG_PVW_WORD_NUM) || (SATPG_PVW_WORD_NUM == 0)
+#undef SATPG_PVW_WORD_NUM
+#if defined(__AVX512F__)
+#define SATPG_PVW_WORD_NUM 8
+#else
+#define SATPG_PVW_WORD_NUM 4
+#endif
+#endif
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+/// @brief PackedValW のワード数
+const ymuint kPvwWordNum = SATPG_PVW_WORD_NUM;
+
+/// @brief PackedValW のビット長
+const ymuint kPvwBitLen = kPvBitLen * kPvwWordNum;
+
+
+//////////////////////////////////////////////////////////////////////
+/// @class PackedValW PackedValW.h "PackedValW.h"
+/// @brief kPvwWordNum 個の PackedVal をまとめたビットベクタ
+///
+/// pos 番目のビットは (pos / kPvBitLen) 番目のワードの
+/// (pos % kPvBitLen) 番目のビットに対応する．
+/// 論理演算は AVX2/AVX-512 が使える場合にはそれを用いる．
+/// そうでない場合もワード単位のループなのでコンパイラによる
+/// ベクトル化が期待できる．
+//////////////////////////////////////////////////////////////////////
+class PackedValW
+{
+public:
+
+  /// @brief 空のコンストラクタ
+  ///
+  /// 内容は不定
+  PackedValW();
+
+  /// @brief 全てのワードを同じ値で初期化するコンストラクタ
+  /// @param[in] val 値
+  explicit
+  PackedValW(PackedVal val);
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワードを得る．
+  /// @param[in] pos ワード位置 ( 0 <= pos < kPvwWordNum )
+  PackedVal
+  word(ymuint pos) const;
+
+  /// @brief ワードを設定する．
+  /// @param[in] pos ワード位置 ( 0 <= pos < kPvwWordNum )
+  /// @param[in] val 値
+  void
+  set_word(ymuint pos,
+	   PackedVal val);
+
+  /// @brief ビットを調べる．
+  /// @param[in] pos ビット位置 ( 0 <= pos < kPvwBitLen )
+  bool
+  check_bit(ymuint pos) const;
+
+  /// @brief ビットを1にする．
+  /// @param[in] pos ビット位置 ( 0 <= pos < kPvwBitLen )
+  void
+  set_bit(ymuint pos);
+
+  /// @brief 全てのビットが0の時 true を返す．
+  bool
+  is_zero() const;
+
+  /// @brief 否定
+  PackedValW
+  operator~() const;
+
+  /// @brief AND 付き代入
+  const PackedValW&
+  operator&=(const PackedValW& right);
+
+  /// @brief OR 付き代入
+  const PackedValW&
+  operator|=(const PackedValW& right);
+
+  /// @brief XOR 付き代入
+  const PackedValW&
+  operator^=(const PackedValW& right);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 本体
+  PackedVal mWord[kPvwWordNum];
+
+};
+
+/// @brief 全てのビットが0の定数
+const PackedValW kPvwAll0(kPvAll0);
+
+/// @brief 全てのビットが1の定数
+const PackedValW kPvwAll1(kPvAll1);
+
+/// @brief AND
+PackedValW
+operator&(const PackedValW& left,
+	  const PackedValW& right);
+
+/// @brief OR
+PackedValW
+operator|(const PackedValW& left,
+	  const PackedValW& right);
+
+/// @brief XOR
+PackedValW
+operator^(const PackedValW& left,
+	  const PackedValW& right);
+
+/// @brief 等価比較
+bool
+operator==(const PackedValW& left,
+	   const PackedValW& right);
+
+/// @brief 非等価比較
+bool
+operator!=(const PackedValW& left,
+	   const PackedValW& right);
+
+/// @brief 1のビット数を数える．
+/// @param[in] val 対象のビットベクタ
+ymuint
+count_ones(const PackedValW& val);
+
+/// @brief toggle の各ビットに対応するパタンの WSA に weight を加える．
+/// @param[in] toggle 値の変化したパタンを表すビットベクタ
+/// @param[in] weight 加える重み
+/// @param[inout] wsa_array パタンごとの WSA の配列
+///
+/// wsa_array のサイズ以降のビットは無視する．
+void
+add_wsa(const PackedValW& toggle,
+	ymuint weight,
+	vector<ymuint>& wsa_array);
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief 空のコンストラクタ
+inline
+PackedValW::PackedValW()
+{
+}
+
+// @brief 全てのワードを同じ値で初期化するコンストラクタ
+inline
+PackedValW::PackedValW(PackedVal val)
+{
+  for (ymuint i = 0; i < kPvwWordNum; ++ i) {
+    mWord[i] = val;
+  }
+}
+
+// @brief ワードを得る．
+inline
+PackedVal
+PackedValW::word(ymuint pos) const
+{
+  return mWord[pos];
+}
+
+// @brief ワードを設定する．
+inline
+void
+PackedValW::set_word(ymuint pos,
+		     PackedVal val)
+{
+  mWord[pos] = val;
+}
+
+// @brief ビットを調べる．
+inline
+bool
+PackedValW::check_bit(ymuint pos) const
+{
+  return static_cast<bool>((mWord[pos / kPvBitLen] >> (pos % kPvBitLen)) & 1UL);
+}
+
+// @brief ビットを1にする．
+inline
+void
+PackedValW::set_bit(ymuint pos)
+{
+  mWord[pos / kPvBitLen] |= (1UL << (pos % kPvBitLen));
+}
+
+#if defined(__AVX512F__) && (SATPG_PVW_WORD_NUM % 8 == 0)
+
+// AVX-512 版
+
+// @brief 全てのビットが0の時 true を返す．
+inline
+bool
+PackedValW::is_zero() const
+{
+  __m512i acc = _mm512_setzero_si512();
+  for (ymuint i = 0; i < kPvwWordNum; i += 8) {
+    acc = _mm512_or_si512(acc, _mm512_loadu_si512(&mWord[i]));
+  }
+  return _mm512_test_epi64_mask(acc, acc) == 0;
+}
+
+// @brief 否定
+inline
+PackedValW
+PackedValW::operator~() const
+{
+  PackedValW ans;
+  const __m512i all1 = _mm512_set1_epi64(-1LL);
+  for (ymuint i = 0; i < kPvwWordNum; i += 8) {
+    __m512i v = _mm512_loadu_si512(&mWord[i]);
+    _mm512_storeu_si512(&ans.mWord[i], _mm512_xor_si512(v, all1));
+  }
+  return ans;
+}
+
+// @brief AND 付き代入
+inline
+const PackedValW&
+PackedValW::operator&=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; i += 8) {
+    __m512i a = _mm512_loadu_si512(&mWord[i]);
+    __m512i b = _mm512_loadu_si512(&right.mWord[i]);
+    _mm512_storeu_si512(&mWord[i], _mm512_and_si512(a, b));
+  }
+  return *this;
+}
+
+// @brief OR 付き代入
+inline
+const PackedValW&
+PackedValW::operator|=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; i += 8) {
+    __m512i a = _mm512_loadu_si512(&mWord[i]);
+    __m512i b = _mm512_loadu_si512(&right.mWord[i]);
+    _mm512_storeu_si512(&mWord[i], _mm512_or_si512(a, b));
+  }
+  return *this;
+}
+
+// @brief XOR 付き代入
+inline
+const PackedValW&
+PackedValW::operator^=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; i += 8) {
+    __m512i a = _mm512_loadu_si512(&mWord[i]);
+    __m512i b = _mm512_loadu_si512(&right.mWord[i]);
+    _mm512_storeu_si512(&mWord[i], _mm512_xor_si512(a, b));
+  }
+  return *this;
+}
+
+#elif defined(__AVX2__) && (SATPG_PVW_WORD_NUM % 4 == 0)
+
+// AVX2 版
+
+// @brief 全てのビットが0の時 true を返す．
+inline
+bool
+PackedValW::is_zero() const
+{
+  __m256i acc = _mm256_setzero_si256();
+  for (ymuint i = 0; i < kPvwWordNum; i += 4) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mWord[i]));
+    acc = _mm256_or_si256(acc, v);
+  }
+  return _mm256_testz_si256(acc, acc) != 0;
+}
+
+// @brief 否定
+inline
+PackedValW
+PackedValW::operator~() const
+{
+  PackedValW ans;
+  const __m256i all1 = _mm256_set1_epi64x(-1LL);
+  for (ymuint i = 0; i < kPvwWordNum; i += 4) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mWord[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&ans.mWord[i]),
+			_mm256_xor_si256(v, all1));
+  }
+  return ans;
+}
+
+// @brief AND 付き代入
+inline
+const PackedValW&
+PackedValW::operator&=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; i += 4) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mWord[i]));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&right.mWord[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&mWord[i]), _mm256_and_si256(a, b));
+  }
+  return *this;
+}
+
+// @brief OR 付き代入
+inline
+const PackedValW&
+PackedValW::operator|=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; i += 4) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mWord[i]));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&right.mWord[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&mWord[i]), _mm256_or_si256(a, b));
+  }
+  return *this;
+}
+
+// @brief XOR 付き代入
+inline
+const PackedValW&
+PackedValW::operator^=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; i += 4) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&mWord[i]));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&right.mWord[i]));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(&mWord[i]), _mm256_xor_si256(a, b));
+  }
+  return *this;
+}
+
+#else
+
+// 汎用版
+
+// @brief 全てのビットが0の時 true を返す．
+inline
+bool
+PackedValW::is_zero() const
+{
+  PackedVal acc = kPvAll0;
+  for (ymuint i = 0; i < kPvwWordNum; ++ i) {
+    acc |= mWord[i];
+  }
+  return acc == kPvAll0;
+}
+
+// @brief 否定
+inline
+PackedValW
+PackedValW::operator~() const
+{
+  PackedValW ans;
+  for (ymuint i = 0; i < kPvwWordNum; ++ i) {
+    ans.mWord[i] = ~mWord[i];
+  }
+  return ans;
+}
+
+// @brief AND 付き代入
+inline
+const PackedValW&
+PackedValW::operator&=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; ++ i) {
+    mWord[i] &= right.mWord[i];
+  }
+  return *this;
+}
+
+// @brief OR 付き代入
+inline
+const PackedValW&
+PackedValW::operator|=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; ++ i) {
+    mWord[i] |= right.mWord[i];
+  }
+  return *this;
+}
+
+// @brief XOR 付き代入
+inline
+const PackedValW&
+PackedValW::operator^=(const PackedValW& right)
+{
+  for (ymuint i = 0; i < kPvwWordNum; ++ i) {
+    mWord[i] ^= right.mWord[i];
+  }
+  return *this;
+}
+
+#endif
+
+// @brief AND
+inline
+PackedValW
+operator&(const PackedValW& left,
+	  const PackedValW& right)
+{
+  return PackedValW(left) &= right;
+}
+
+// @brief OR
+inline
+PackedValW
+operator|(const PackedValW& left,
+	  const PackedValW& right)
+{
+  return PackedValW(left) |= right;
+}
+
+// @brief XOR
+inline
+PackedValW
+operator^(const PackedValW& left,
+	  const PackedValW& right)
+{
+  return PackedValW(left) ^= right;
+}
+
+// @brief 等価比較
+inline
+bool
+operator==(const PackedValW& left,
+	   const PackedValW& right)
+{
+  return (left ^ right).is_zero();
+}
+
+// @brief 非等価比較
+inline
+bool
+operator!=(const PackedValW& left,
+	   const PackedValW& right)
+{
+  return !operator==(left, right);
+}
+
+// @brief 1のビット数を数える．
+inline
+ymuint
+count_ones(const PackedValW& val)
+{
+  ymuint n = 0;
+  for (ymuint i = 0; i < kPvwWordNum; ++ i) {
+    n += count_ones(val.word(i));
+  }
+  return n;
+}
+
+// @brief toggle の各ビットに対応するパタンの WSA に weight を加える．
+// @param[in] toggle 値の変化したパタンを表すビットベクタ
+// @param[in] weight 加える重み
+// @param[inout] wsa_array パタンごとの WSA の配列
+inline
+void
+add_wsa(const PackedValW& toggle,
+	ymuint weight,
+	vector<ymuint>& wsa_array)
+{
+  if ( weight == 0 ) {
+    return;
+  }
+  ymuint nb = wsa_array.size();
+  for (ymuint w = 0; w < kPvwWordNum; ++ w) {
+    PackedVal bits = toggle.word(w);
+    while ( bits != kPvAll0 ) {
+      // 最下位の1のビット
+      PackedVal lsb = bits & (~bits + 1UL);
+      ymuint pos = w * kPvBitLen + count_ones(lsb - 1UL);
+      if ( pos >= nb ) {
+	return;
+      }
+      wsa_array[pos] += weight;
+      bits ^= lsb;
+    }
+  }
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // PACKEDVALW_H
@@ -101,6 +101,17 @@ public:
 	     const TpgNode* bnode,
 	     Val3 detect);
 
+  /// @brief 検出条件を変数で制御する fault cone を追加する．
+  /// @param[in] fnode 故障のあるノード
+  /// @param[in] cvar 検出条件を制御する変数
+  ///
+  /// cvar が 1 の時に fnode の故障差が外部出力まで伝搬する
+  /// という条件になる．cvar が 0 の時は何も制約しない．
+  /// cvar を仮定として与えることで一つのソルバを使いまわせる．
+  const FoCone*
+  add_focone(const TpgNode* fnode,
+	     SatVarId cvar);
+
   /// @brief fault cone を追加する．
   /// @param[in] fnode 故障のあるノード
   ///
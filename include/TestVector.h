@@ -11,6 +11,7 @@
 #include "satpg.h"
 #include "Val3.h"
 #include "PackedVal.h"
+#include "PackedValW.h"
 #include "ym/RandGen.h"
 
 
@@ -30,6 +31,8 @@ class SaFault;
 class TestVector
 {
   friend class TvMgr;
+  friend class TvWriter;
+  friend class TvReader;
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -58,6 +61,22 @@ public:
   is_conflict(const TestVector& tv1,
 	      const TestVector& tv2);
 
+  /// @brief テストベクタの配列を入力ごとのビット列に変換する．
+  /// @param[in] tv_array テストベクタの配列
+  /// @param[out] val0_array 入力ごとの 0 のビットを入れる配列
+  /// @param[out] val1_array 入力ごとの 1 のビットを入れる配列
+  ///
+  /// tv_array の要素数は 1 以上 kPvwBitLen 以下でなければならない．
+  /// j 番めのテストベクタの値が j 番めのビットになる．
+  /// 残ったビットには 0 番めのパタンの値を詰める．
+  /// val0_array と val1_array は入力数分の大きさを持っていなければならない．
+  /// 必要のない方には nullptr を与えてもよい．
+  static
+  void
+  transpose(const vector<TestVector*>& tv_array,
+	    PackedValW* val0_array,
+	    PackedValW* val1_array);
+
   /// @brief 等価関係の比較を行なう．
   /// @param[in] right オペランド
   /// @return 自分自身と right が等しいとき true を返す．
@@ -88,6 +107,20 @@ public:
   string
   hex_str() const;
 
+  /// @brief 内容を BIN 形式で出力する．
+  /// @param[in] s 出力先のストリーム
+  ///
+  /// bin_str() と同じ内容を文字列を作らずに直接書き出す．
+  void
+  print_bin(ostream& s) const;
+
+  /// @brief 内容を HEX 形式で出力する．
+  /// @param[in] s 出力先のストリーム
+  ///
+  /// hex_str() と同じ内容を文字列を作らずに直接書き出す．
+  void
+  print_hex(ostream& s) const;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -368,7 +401,8 @@ ostream&
 operator<<(ostream& s,
 	   const TestVector& tv)
 {
-  return s << tv.bin_str();
+  tv.print_bin(s);
+  return s;
 }
 
 // @brief 内容を出力する．
@@ -377,7 +411,8 @@ ostream&
 operator<<(ostream& s,
 	   const TestVector* tvp)
 {
-  return s << tvp->bin_str();
+  tvp->print_bin(s);
+  return s;
 }
 
 END_NAMESPACE_YM_SATPG
@@ -328,6 +328,20 @@ public:
   const TpgFault*
   fault(ymuint pos) const;
 
+  /// @brief このノードを根とする FFR に含まれる代表故障を得る．
+  /// @param[out] fault_list 故障を追加するリスト
+  ///
+  /// 自分と同じ FFR に属するファンインを再帰的にたどる．
+  void
+  get_ffr_faults(vector<const TpgFault*>& fault_list) const;
+
+  /// @brief このノードを根とする FFR に含まれる印のついた代表故障を得る．
+  /// @param[in] fault_mark 故障番号をキーにした印の配列
+  /// @param[out] fault_list 故障を追加するリスト
+  void
+  get_ffr_faults(const vector<bool>& fault_mark,
+		 vector<const TpgFault*>& fault_list) const;
+
 
 public:
   //////////////////////////////////////////////////////////////////////
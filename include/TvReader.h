@@ -0,0 +1,151 @@
+﻿#ifndef TVREADER_H
+#define TVREADER_H
+
+/// @file TvReader.h
+/// @brief TvReader のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "PackedVal.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class TvReader TvReader.h "TvReader.h"
+/// @brief TvWriter の書き出したテストベクタを読み込むクラス
+///
+/// ファイルの形式は TvWriter を参照のこと．
+//////////////////////////////////////////////////////////////////////
+class TvReader
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] s 入力元のストリーム
+  ///
+  /// s はバイナリモードで開いておくこと．
+  TvReader(istream& s);
+
+  /// @brief デストラクタ
+  ~TvReader();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ヘッダを読み込む．
+  /// @param[in] network 対象のネットワーク
+  /// @return エラーが起きたら false を返す．
+  ///
+  /// 入力数と入力の名前が network と一致するか調べる．
+  bool
+  read_header(const TpgNetwork& network);
+
+  /// @brief テストベクタを読み込む．
+  /// @param[in] tvmgr テストベクタを生成するオブジェクト
+  /// @return 読み込んだテストベクタを返す．
+  ///
+  /// 終端に達した時とエラーが起きた時には nullptr を返す．
+  /// どちらかは error() で区別する．
+  TestVector*
+  read(TvMgr& tvmgr);
+
+  /// @brief テストベクタを読み込む．
+  /// @param[in] tv 読み込んだ値を設定するテストベクタ
+  /// @return 読み込めたら true を返す．
+  ///
+  /// 既存のテストベクタを使いまわしたい時に用いる．
+  /// 終端に達した時とエラーが起きた時には false を返す．
+  /// どちらかは error() で区別する．
+  bool
+  read(TestVector* tv);
+
+  /// @brief エラーが起きていたら true を返す．
+  bool
+  error() const;
+
+  /// @brief エラーメッセージを返す．
+  const string&
+  error_msg() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 指定されたバイト数をバッファに読み込む．
+  /// @param[in] size バイト数
+  /// @return 読み込めなかったら false を返す．
+  bool
+  fill_buff(ymuint size);
+
+  /// @brief 32ビットの数値を読み込む．
+  /// @param[out] val 読み込んだ値
+  bool
+  get_uint32(ymuint32& val);
+
+  /// @brief バッファの pos バイトめからの1ワードを取り出す．
+  PackedVal
+  buff_word(ymuint pos) const;
+
+  /// @brief エラーを記録する．
+  /// @param[in] msg エラーメッセージ
+  void
+  set_error(const string& msg);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 入力元のストリーム
+  istream& mS;
+
+  // 入力数
+  ymuint mInputNum;
+
+  // 読み込んだパタン数
+  ymuint mCount;
+
+  // 読み込み用のバッファ
+  vector<char> mBuff;
+
+  // エラーメッセージ
+  // エラーが起きていなければ空
+  string mErrorMsg;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief エラーが起きていたら true を返す．
+inline
+bool
+TvReader::error() const
+{
+  return !mErrorMsg.empty();
+}
+
+// @brief エラーメッセージを返す．
+inline
+const string&
+TvReader::error_msg() const
+{
+  return mErrorMsg;
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // TVREADER_H
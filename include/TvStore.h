@@ -0,0 +1,225 @@
+﻿#ifndef TVSTORE_H
+#define TVSTORE_H
+
+/// @file TvStore.h
+/// @brief TvStore のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "PackedValW.h"
+#include "Val3.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class TvStore TvStore.h "TvStore.h"
+/// @brief テストベクタを入力ごとのビット列で保持するクラス
+///
+/// テストベクタを kPvwBitLen 個ずつのブロックに分け，各ブロック内では
+/// 入力ごとに 0 のビットと 1 のビットを別々の PackedValW に詰めて持つ
+/// (どちらも立っていないビットが X)．
+/// 全てのブロックは一つの連続した領域に並べられ，
+/// Fsim::ppsfp() はブロック単位でそのまま外部入力の値として用いる．
+/// ブロック内の使われていないビットには 0 番めのパタンの値を詰めておく．
+///
+/// 個々のテストベクタを削除することはできない．
+/// clear() で全てのテストベクタをまとめて開放する．
+//////////////////////////////////////////////////////////////////////
+class TvStore
+{
+public:
+
+  /// @brief コンストラクタ
+  TvStore();
+
+  /// @brief デストラクタ
+  ~TvStore();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 初期化する．
+  /// @param[in] ni 入力数
+  ///
+  /// 副作用で clear() が呼ばれる．
+  void
+  init(ymuint ni);
+
+  /// @brief 全てのテストベクタを削除する．
+  ///
+  /// 入力数は変わらない．
+  void
+  clear();
+
+  /// @brief テストベクタを追加する．
+  /// @param[in] tv 追加するテストベクタ
+  ///
+  /// tv の内容がコピーされる．
+  void
+  add(const TestVector* tv);
+
+  /// @brief テストベクタのリストを追加する．
+  /// @param[in] tv_list 追加するテストベクタのリスト
+  void
+  add(const vector<TestVector*>& tv_list);
+
+  /// @brief 入力数を返す．
+  ymuint
+  input_num() const;
+
+  /// @brief テストベクタ数を返す．
+  ymuint
+  vector_num() const;
+
+  /// @brief ブロック数を返す．
+  ymuint
+  block_num() const;
+
+  /// @brief ブロック内のテストベクタ数を返す．
+  /// @param[in] blk ブロック番号 ( 0 <= blk < block_num() )
+  ymuint
+  block_size(ymuint blk) const;
+
+  /// @brief ブロック内の入力の 0 のビットを返す．
+  /// @param[in] blk ブロック番号 ( 0 <= blk < block_num() )
+  /// @param[in] ipos 入力番号 ( 0 <= ipos < input_num() )
+  const PackedValW&
+  val0(ymuint blk,
+       ymuint ipos) const;
+
+  /// @brief ブロック内の入力の 1 のビットを返す．
+  /// @param[in] blk ブロック番号 ( 0 <= blk < block_num() )
+  /// @param[in] ipos 入力番号 ( 0 <= ipos < input_num() )
+  const PackedValW&
+  val1(ymuint blk,
+       ymuint ipos) const;
+
+  /// @brief テストベクタの値を返す．
+  /// @param[in] pos テストベクタの番号 ( 0 <= pos < vector_num() )
+  /// @param[in] ipos 入力番号 ( 0 <= ipos < input_num() )
+  Val3
+  val3(ymuint pos,
+       ymuint ipos) const;
+
+  /// @brief テストベクタを取り出す．
+  /// @param[in] pos テストベクタの番号 ( 0 <= pos < vector_num() )
+  /// @param[in] tv 値を設定するテストベクタ
+  void
+  get_vector(ymuint pos,
+	     TestVector* tv) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 入力数
+  ymuint mNi;
+
+  // テストベクタ数
+  ymuint mNum;
+
+  // 0 のビットの配列
+  // ブロック番号 * mNi + 入力番号 の位置に入れる．
+  vector<PackedValW> mVal0Array;
+
+  // 1 のビットの配列
+  // 並び方は mVal0Array と同じ
+  vector<PackedValW> mVal1Array;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief 入力数を返す．
+inline
+ymuint
+TvStore::input_num() const
+{
+  return mNi;
+}
+
+// @brief テストベクタ数を返す．
+inline
+ymuint
+TvStore::vector_num() const
+{
+  return mNum;
+}
+
+// @brief ブロック数を返す．
+inline
+ymuint
+TvStore::block_num() const
+{
+  return (mNum + kPvwBitLen - 1) / kPvwBitLen;
+}
+
+// @brief ブロック内のテストベクタ数を返す．
+// @param[in] blk ブロック番号 ( 0 <= blk < block_num() )
+inline
+ymuint
+TvStore::block_size(ymuint blk) const
+{
+  ASSERT_COND( blk < block_num() );
+  ymuint n = mNum - blk * kPvwBitLen;
+  return n < kPvwBitLen ? n : kPvwBitLen;
+}
+
+// @brief ブロック内の入力の 0 のビットを返す．
+// @param[in] blk ブロック番号 ( 0 <= blk < block_num() )
+// @param[in] ipos 入力番号 ( 0 <= ipos < input_num() )
+inline
+const PackedValW&
+TvStore::val0(ymuint blk,
+	      ymuint ipos) const
+{
+  return mVal0Array[blk * mNi + ipos];
+}
+
+// @brief ブロック内の入力の 1 のビットを返す．
+// @param[in] blk ブロック番号 ( 0 <= blk < block_num() )
+// @param[in] ipos 入力番号 ( 0 <= ipos < input_num() )
+inline
+const PackedValW&
+TvStore::val1(ymuint blk,
+	      ymuint ipos) const
+{
+  return mVal1Array[blk * mNi + ipos];
+}
+
+// @brief テストベクタの値を返す．
+// @param[in] pos テストベクタの番号 ( 0 <= pos < vector_num() )
+// @param[in] ipos 入力番号 ( 0 <= ipos < input_num() )
+inline
+Val3
+TvStore::val3(ymuint pos,
+	      ymuint ipos) const
+{
+  ASSERT_COND( pos < mNum );
+  ymuint blk = pos / kPvwBitLen;
+  ymuint bpos = pos % kPvwBitLen;
+  if ( val0(blk, ipos).check_bit(bpos) ) {
+    return kVal0;
+  }
+  if ( val1(blk, ipos).check_bit(bpos) ) {
+    return kVal1;
+  }
+  return kValX;
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // TVSTORE_H
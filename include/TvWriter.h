@@ -0,0 +1,148 @@
+﻿#ifndef TVWRITER_H
+#define TVWRITER_H
+
+/// @file TvWriter.h
+/// @brief TvWriter のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "PackedVal.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class TvWriter TvWriter.h "TvWriter.h"
+/// @brief テストベクタをバイナリ形式で書き出すクラス
+///
+/// TestVector の内部表現のワードをそのまま書き出す．
+/// ファイルの形式は以下の通り．数値は全てリトルエンディアンで表す．
+/// - マジックナンバー "SATPGTV1" (8バイト)
+/// - 入力数(32ビット)
+/// - 各入力の名前: 長さ(32ビット) + 文字列
+/// - パタン: タグ(1バイト) + 本体
+///   - kTag2Val: X を含まないパタン．値が 1 のビットのワード列
+///   - kTag3Val: X を含むパタン．0 のビットと 1 のビットのワード列
+/// - 終端: kTagEnd + パタン数(32ビット)
+///
+/// パタンは一つずつ書き出すのでパタン数は最後に書く．
+//////////////////////////////////////////////////////////////////////
+class TvWriter
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] s 出力先のストリーム
+  ///
+  /// s はバイナリモードで開いておくこと．
+  TvWriter(ostream& s);
+
+  /// @brief デストラクタ
+  ~TvWriter();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ヘッダを書き出す．
+  /// @param[in] network 対象のネットワーク
+  ///
+  /// 入力数と入力の名前を記録する．
+  void
+  write_header(const TpgNetwork& network);
+
+  /// @brief テストベクタを書き出す．
+  /// @param[in] tv テストベクタ
+  void
+  write(const TestVector* tv);
+
+  /// @brief 終端を書き出す．
+  void
+  write_end();
+
+  /// @brief 書き出したパタン数を返す．
+  ymuint
+  count() const;
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // ファイル形式に関する定数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief マジックナンバー
+  static
+  const char kMagic[8];
+
+  /// @brief 終端を表すタグ
+  static
+  const ymuint8 kTagEnd = 0;
+
+  /// @brief X を含まないパタンを表すタグ
+  static
+  const ymuint8 kTag2Val = 1;
+
+  /// @brief X を含むパタンを表すタグ
+  static
+  const ymuint8 kTag3Val = 2;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 32ビットの数値をバッファに加える．
+  void
+  put_uint32(ymuint32 val);
+
+  /// @brief 1ワードをバッファに加える．
+  void
+  put_word(PackedVal val);
+
+  /// @brief バッファの内容を書き出す．
+  void
+  flush_buff();
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 出力先のストリーム
+  ostream& mS;
+
+  // 入力数
+  ymuint mInputNum;
+
+  // 書き出したパタン数
+  ymuint mCount;
+
+  // 書き出し用のバッファ
+  vector<char> mBuff;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief 書き出したパタン数を返す．
+inline
+ymuint
+TvWriter::count() const
+{
+  return mCount;
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // TVWRITER_H
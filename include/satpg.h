@@ -112,6 +112,7 @@ class DetectOp;
 class UntestOp;
 class TestVector;
 class TvMgr;
+class TvStore;
 class Dtpg;
 class DtpgEngine;
 class DtpgStats;
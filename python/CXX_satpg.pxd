@@ -30,6 +30,43 @@ cdef extern from "TpgNetwork.h" namespace "nsYm::nsSatpg" :
         bool read_iscas89(const string& filename)
 
 
+cdef extern from "FaultMgr.h" namespace "nsYm::nsSatpg" :
+
+    # FaultMgr の cython バージョン
+    cdef cppclass FaultMgr :
+
+        FaultMgr()
+        void clear()
+        void set_faults(const TpgNetwork& network)
+        unsigned int det_num()
+        unsigned int remain_num()
+        unsigned int untest_num()
+
+
+cdef extern from "Fsim.h" namespace "nsYm::nsSatpg" :
+
+    # Fsim の cython バージョン
+    cdef cppclass Fsim :
+
+        void set_network(const TpgNetwork& network)
+
+    Fsim* new_Fsim2()
+    Fsim* new_Fsim3()
+    Fsim* new_TFsim2()
+
+
+cdef extern from "FileFsim.h" namespace "nsYm::nsSatpg" :
+
+    # FileFsim の cython バージョン
+    cdef cppclass FileFsim :
+
+        FileFsim(const TpgNetwork& network, FaultMgr& fmgr, Fsim& fsim)
+        bool run(const string& filename, unsigned int interval)
+        unsigned int pattern_num()
+        unsigned int det_num()
+        const string& error_msg()
+
+
 cdef extern from "TvMgr.h" namespace "nsYm::nsSatpg" :
 
     # TvMgr の cython バージョン
@@ -45,3 +45,35 @@ cdef class TpgNetwork :
     def read_iscas89(TpgNetwork self, str filename) :
         cdef string c_filename = filename.encode('UTF-8')
         return self._this.read_iscas89(c_filename)
+
+    # @brief パタンファイルで故障シミュレーションを行う．
+    # @param[in] filename パタンファイル名(write_pat の形式)
+    # @param[in] fsim 故障シミュレータの種類(fsim2|fsim3|tfsim2)
+    # @param[in] interval 途中経過を出力する間隔(パタン数)
+    # @return (パタン数, 検出故障数, 未検出故障数) のタプルを返す．
+    #
+    # 全ての代表故障を対象とする．
+    # テストベクタはブロック単位で読み込むので全てをメモリ上に持つことはない．
+    def fsim_file(TpgNetwork self, str filename, str fsim = 'fsim3', unsigned int interval = 0) :
+        cdef string c_filename = filename.encode('UTF-8')
+        cdef cxx.FaultMgr fmgr
+        cdef cxx.Fsim* fsim_p
+        cdef cxx.FileFsim* file_fsim
+        if fsim == 'fsim2' :
+            fsim_p = cxx.new_Fsim2()
+        elif fsim == 'fsim3' :
+            fsim_p = cxx.new_Fsim3()
+        elif fsim == 'tfsim2' :
+            fsim_p = cxx.new_TFsim2()
+        else :
+            raise ValueError('illegal fsim type: ' + fsim)
+        fmgr.set_faults(self._this)
+        fsim_p.set_network(self._this)
+        file_fsim = new cxx.FileFsim(self._this, fmgr, fsim_p[0])
+        try :
+            if not file_fsim.run(c_filename, interval) :
+                raise IOError(filename + ' : ' + file_fsim.error_msg().decode('UTF-8'))
+            return (file_fsim.pattern_num(), file_fsim.det_num(), fmgr.remain_num())
+        finally :
+            del file_fsim
+            del fsim_p
@@ -18,7 +18,8 @@ BEGIN_NAMESPACE_YM_SATPG
 // @brief コンストラクタ
 FaultMgr::FaultMgr()
 {
-  mChanged = false;
+  mRemainHole = 0;
+  mChangeLogBase = 0;
 }
 
 // @brief デストラクタ
@@ -32,11 +33,18 @@ FaultMgr::clear()
 {
   mStatusArray.clear();
 
+  mRepList.clear();
   mDetList.clear();
   mRemainList.clear();
   mUntestList.clear();
 
-  mChanged = true;
+  mListPos.clear();
+  mInRemain.clear();
+  mRemainHole = 0;
+
+  // 以前の変更ログの位置は無効になる．
+  mChangeLogBase += mChangeLog.size();
+  mChangeLog.clear();
 }
 
 // @brief network の故障を設定する．
@@ -47,6 +55,8 @@ FaultMgr::set_faults(const TpgNetwork& network)
 
   ymuint max_id = network.max_fault_id();
   mStatusArray.resize(max_id, kFsUndetected);
+  mListPos.resize(max_id, -1);
+  mInRemain.resize(max_id, false);
 
   // 各ノードの故障を mRemainList に入れる．
   // ただし外部出力に到達可能でない故障は mUntestList に入れる．
@@ -59,10 +69,11 @@ FaultMgr::set_faults(const TpgNetwork& network)
       mRepList.push_back(fault);
       if ( fault->tpg_onode()->is_active() ) {
 	mRemainList.push_back(fault);
+	mInRemain[fault->id()] = true;
       }
       else {
-	mUntestList.push_back(fault);
-	set_status(fault, kFsUntestable);
+	mStatusArray[fault->id()] = kFsUntestable;
+	add_to_list(mUntestList, fault);
       }
     }
   }
@@ -73,49 +84,113 @@ void
 FaultMgr::set_status(const TpgFault* fault,
 		     FaultStatus stat)
 {
-  ASSERT_COND( fault->id() < mStatusArray.size() );
-  mStatusArray[fault->id()] = stat;
-  mChanged = true;
+  ymuint id = fault->id();
+  ASSERT_COND( id < mStatusArray.size() );
+  FaultStatus old_stat = mStatusArray[id];
+  mStatusArray[id] = stat;
+
+  if ( !mInRemain[id] && mListPos[id] < 0 ) {
+    // どのリストにも入っていない故障
+    return;
+  }
+
+  bool old_remain = is_remain(old_stat);
+  bool new_remain = is_remain(stat);
+
+  // 元のリストから取り除く．
+  if ( old_remain ) {
+    if ( !new_remain ) {
+      // mRemainList からの削除は update() まで遅延する．
+      ++ mRemainHole;
+    }
+  }
+  else if ( old_stat != stat ) {
+    if ( old_stat == kFsDetected ) {
+      remove_from_list(mDetList, fault);
+    }
+    else {
+      remove_from_list(mUntestList, fault);
+    }
+  }
+
+  // 新しいリストに加える．
+  if ( new_remain ) {
+    if ( !old_remain ) {
+      if ( mInRemain[id] ) {
+	// まだ mRemainList に残っていた．
+	-- mRemainHole;
+      }
+      else {
+	mRemainList.push_back(fault);
+	mInRemain[id] = true;
+      }
+    }
+  }
+  else if ( old_stat != stat ) {
+    if ( stat == kFsDetected ) {
+      add_to_list(mDetList, fault);
+    }
+    else {
+      add_to_list(mUntestList, fault);
+    }
+  }
+
+  if ( old_remain != new_remain ) {
+    mChangeLog.push_back(fault);
+  }
 }
 
-// @brief 故障リストをスキャンして未検出リストを更新する．
+// @brief 未検出リストから取り除かれた故障を削除する．
 void
 FaultMgr::update() const
 {
-  if ( mChanged ) {
+  if ( mRemainHole > 0 ) {
     ymuint n = mRemainList.size();
     ymuint wpos = 0;
     for (ymuint rpos = 0; rpos < n; ++ rpos) {
       const TpgFault* f = mRemainList[rpos];
-      switch ( status(f) ) {
-      case kFsUndetected:
-	if ( wpos != rpos ) {
-	  mRemainList[wpos] = f;
-	}
-	++ wpos;
-	break;
-
-      case kFsDetected:
-	mDetList.push_back(f);
-	break;
-
-      case kFsUntestable:
-	mUntestList.push_back(f);
-	break;
-
-      case kFsAborted:
+      if ( is_remain(status(f)) ) {
 	if ( wpos != rpos ) {
 	  mRemainList[wpos] = f;
 	}
 	++ wpos;
-	break;
+      }
+      else {
+	mInRemain[f->id()] = false;
       }
     }
-    if ( wpos < n ) {
-      mRemainList.erase(mRemainList.begin() + wpos, mRemainList.end());
-    }
-    mChanged = false;
+    mRemainList.erase(mRemainList.begin() + wpos, mRemainList.end());
+    mRemainHole = 0;
   }
 }
 
+// @brief 検出済みもしくは検出不能のリストに故障を追加する．
+// @param[in] fault_list 追加先のリスト
+// @param[in] fault 対象の故障
+void
+FaultMgr::add_to_list(vector<const TpgFault*>& fault_list,
+		      const TpgFault* fault)
+{
+  mListPos[fault->id()] = fault_list.size();
+  fault_list.push_back(fault);
+}
+
+// @brief 検出済みもしくは検出不能のリストから故障を削除する．
+// @param[in] fault_list 削除元のリスト
+// @param[in] fault 対象の故障
+//
+// 末尾の故障を空いた位置に移すのでリストの順序は変わる．
+void
+FaultMgr::remove_from_list(vector<const TpgFault*>& fault_list,
+			   const TpgFault* fault)
+{
+  ymuint pos = mListPos[fault->id()];
+  ASSERT_COND( fault_list[pos] == fault );
+  const TpgFault* last = fault_list.back();
+  fault_list[pos] = last;
+  mListPos[last->id()] = pos;
+  fault_list.pop_back();
+  mListPos[fault->id()] = -1;
+}
+
 END_NAMESPACE_YM_SATPG
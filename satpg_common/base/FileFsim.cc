@@ -0,0 +1,228 @@
+﻿
+/// @file FileFsim.cc
+/// @brief FileFsim の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "FileFsim.h"
+#include "FaultMgr.h"
+#include "Fsim.h"
+#include "FsimOp.h"
+#include "TvMgr.h"
+#include "TvReader.h"
+#include "TvStore.h"
+#include "TpgNetwork.h"
+#include "PackedValW.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+BEGIN_NONAMESPACE
+
+//////////////////////////////////////////////////////////////////////
+// 検出された故障を検出済みにして数える FsimOp
+//////////////////////////////////////////////////////////////////////
+class FopCount :
+  public FsimOp
+{
+public:
+
+  /// @brief コンストラクタ
+  FopCount(FaultMgr& fmgr,
+	   Fsim& fsim) :
+    mMgr(fmgr),
+    mFsim(fsim),
+    mCount(0)
+  {
+  }
+
+  /// @brief 故障を検出したときの処理
+  virtual
+  void
+  operator()(const TpgFault* f,
+	     PackedVal dpat)
+  {
+    drop(f);
+  }
+
+  /// @brief 故障を検出したときの処理(多ワード版)
+  virtual
+  void
+  operator()(const TpgFault* f,
+	     const PackedValW& dpat)
+  {
+    drop(f);
+  }
+
+  /// @brief 検出された故障数を返す．
+  ymuint
+  count() const
+  {
+    return mCount;
+  }
+
+
+private:
+
+  /// @brief 故障を検出済みにしてシミュレーションから外す．
+  void
+  drop(const TpgFault* f)
+  {
+    mMgr.set_status(f, kFsDetected);
+    mFsim.set_skip(f);
+    ++ mCount;
+  }
+
+  // 故障マネージャ
+  FaultMgr& mMgr;
+
+  // 故障シミュレータ
+  Fsim& mFsim;
+
+  // 検出された故障数
+  ymuint mCount;
+
+};
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス FileFsim
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+// @param[in] network 対象のネットワーク
+// @param[in] fmgr 故障マネージャ
+// @param[in] fsim 故障シミュレータ
+FileFsim::FileFsim(const TpgNetwork& network,
+		   FaultMgr& fmgr,
+		   Fsim& fsim) :
+  mNetwork(network),
+  mFaultMgr(fmgr),
+  mFsim(fsim),
+  mPatNum(0),
+  mDetBase(0),
+  mDetNum(0),
+  mRepNum(0)
+{
+}
+
+// @brief デストラクタ
+FileFsim::~FileFsim()
+{
+}
+
+// @brief 故障シミュレーションを行う．
+// @param[in] filename パタンファイル名
+// @param[in] interval 途中経過を出力する間隔(パタン数)
+// @param[in] s 途中経過の出力先
+// @return エラーが起きたら false を返す．
+bool
+FileFsim::run(const string& filename,
+	      ymuint interval,
+	      ostream& s)
+{
+  mPatNum = 0;
+  mDetNum = 0;
+  mErrorMsg = string();
+
+  ifstream ifs(filename.c_str(), ios::in | ios::binary);
+  if ( !ifs ) {
+    mErrorMsg = "No such file";
+    return false;
+  }
+
+  TvReader reader(ifs);
+  if ( !reader.read_header(mNetwork) ) {
+    mErrorMsg = reader.error_msg();
+    return false;
+  }
+
+  mRepNum = mFaultMgr.rep_list().size();
+  mDetBase = mFaultMgr.det_num();
+
+  mFsim.set_faults(mFaultMgr);
+
+  // 読み込み用のテストベクタは1ブロック分だけ確保して使いまわす．
+  // 1ブロック分のパタンを読み込んでから TvStore にまとめて転置して
+  // 詰めてシミュレーションする．
+  ymuint ni = mNetwork.input_num2();
+  TvMgr tvmgr;
+  tvmgr.init(ni);
+  vector<TestVector*> tv_buff(kPvwBitLen);
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+    tv_buff[i] = tvmgr.new_vector();
+  }
+  vector<TestVector*> tv_list;
+  tv_list.reserve(kPvwBitLen);
+  TvStore tv_store;
+  tv_store.init(ni);
+
+  FopCount op(mFaultMgr, mFsim);
+  ymuint next_report = interval;
+  for ( ; ; ) {
+    tv_list.clear();
+    while ( tv_list.size() < kPvwBitLen ) {
+      TestVector* tv = tv_buff[tv_list.size()];
+      if ( !reader.read(tv) ) {
+	break;
+      }
+      tv_list.push_back(tv);
+    }
+    if ( tv_list.empty() ) {
+      break;
+    }
+
+    tv_store.clear();
+    tv_store.add(tv_list);
+
+    mFsim.ppsfp(tv_store, 0, op);
+    mPatNum += tv_store.vector_num();
+    mDetNum = op.count();
+
+    if ( interval > 0 && mPatNum >= next_report ) {
+      print_progress(s);
+      while ( next_report <= mPatNum ) {
+	next_report += interval;
+      }
+    }
+  }
+
+  if ( interval > 0 ) {
+    print_progress(s);
+  }
+
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+    tvmgr.delete_vector(tv_buff[i]);
+  }
+
+  if ( reader.error() ) {
+    mErrorMsg = reader.error_msg();
+    return false;
+  }
+
+  return true;
+}
+
+// @brief 途中経過を出力する．
+// @param[in] s 出力先のストリーム
+void
+FileFsim::print_progress(ostream& s) const
+{
+  ymuint det = mDetBase + mDetNum;
+  double cov = mRepNum > 0 ? (static_cast<double>(det) * 100.0) / mRepNum : 0.0;
+  ios::fmtflags save_flags = s.flags();
+  streamsize save_prec = s.precision();
+  s << setw(10) << mPatNum << " patterns: "
+    << setw(8) << det << " / " << setw(8) << mRepNum
+    << " detected ("
+    << fixed << setprecision(2) << cov << "%)" << endl;
+  s.flags(save_flags);
+  s.precision(save_prec);
+}
+
+END_NAMESPACE_YM_SATPG
@@ -14,6 +14,50 @@
 
 BEGIN_NAMESPACE_YM_SATPG
 
+BEGIN_NONAMESPACE
+
+// 64 x 64 のビット行列を転置する．
+//
+// ビットは最上位を 0 番めとして数える．つまり転置後の a[63 - b] の
+// (63 - j) ビットめは転置前の a[j] の b ビットめになる．
+// 32 x 32 のブロックの入れ替えから始めて 1 x 1 まで 6 段で行う．
+// 各段では添字が j だけ離れた行の対を処理する．
+// j が 4 以上の段は連続した 4 行をまとめて AVX2 で処理できる．
+void
+transpose64(PackedVal a[])
+{
+  ymuint j = 32;
+  PackedVal m = 0x00000000FFFFFFFFUL;
+#if defined(__AVX2__)
+  for ( ; j >= 4; j >>= 1, m ^= (m << j)) {
+    const __m256i vm = _mm256_set1_epi64x(m);
+    const __m128i sh = _mm_cvtsi32_si128(j);
+    for (ymuint base = 0; base < 64; base += j * 2) {
+      for (ymuint k = base; k < base + j; k += 4) {
+	__m256i* p0 = reinterpret_cast<__m256i*>(&a[k]);
+	__m256i* p1 = reinterpret_cast<__m256i*>(&a[k + j]);
+	__m256i x = _mm256_loadu_si256(p0);
+	__m256i y = _mm256_loadu_si256(p1);
+	__m256i t = _mm256_and_si256(_mm256_xor_si256(x, _mm256_srl_epi64(y, sh)), vm);
+	_mm256_storeu_si256(p0, _mm256_xor_si256(x, t));
+	_mm256_storeu_si256(p1, _mm256_xor_si256(y, _mm256_sll_epi64(t, sh)));
+      }
+    }
+  }
+#endif
+  for ( ; j > 0; j >>= 1, m ^= (m << j)) {
+    for (ymuint base = 0; base < 64; base += j * 2) {
+      for (ymuint k = base; k < base + j; ++ k) {
+	PackedVal t = (a[k] ^ (a[k + j] >> j)) & m;
+	a[k] ^= t;
+	a[k + j] ^= (t << j);
+      }
+    }
+  }
+}
+
+END_NONAMESPACE
+
 // @brief コンストラクタ
 // @param[in] 入力数を指定する．
 TestVector::TestVector(ymuint input_num) :
@@ -344,4 +388,131 @@ TestVector::hex_str() const
   return ans;
 }
 
+// @brief 内容を BIN 形式で出力する．
+// @param[in] s 出力先のストリーム
+void
+TestVector::print_bin(ostream& s) const
+{
+  // ブロックごとに文字を作ってまとめて書き出す．
+  static const char val_char[] = { 'X', '0', '1', '-' };
+  char buff[kPvBitLen];
+  ymuint ni = input_num();
+  for (ymuint base = 0; base < ni; base += kPvBitLen) {
+    ymuint blk = block_idx(base);
+    PackedVal v0 = mPat[blk];
+    PackedVal v1 = mPat[blk + 1];
+    ymuint n = ni - base;
+    if ( n > kPvBitLen ) {
+      n = kPvBitLen;
+    }
+    for (ymuint i = 0; i < n; ++ i) {
+      ymuint shift = shift_num(base + i);
+      ymuint v = (((v1 >> shift) & 1UL) << 1) | ((v0 >> shift) & 1UL);
+      buff[i] = val_char[v];
+    }
+    s.write(buff, n);
+  }
+}
+
+// @brief 内容を HEX 形式で出力する．
+// @param[in] s 出力先のストリーム
+void
+TestVector::print_hex(ostream& s) const
+{
+  // 1ブロック分(HPW 文字)ずつ書き出す．
+  // hex_str() と同じく kValX は kVal0 と同じとみなす．
+  char buff[HPW];
+  ymuint ni = input_num();
+  for (ymuint base = 0; base < ni; base += kPvBitLen) {
+    ymuint blk = block_idx(base);
+    PackedVal v1 = mPat[blk + 1] & ~mPat[blk];
+    ymuint n = ni - base;
+    if ( n > kPvBitLen ) {
+      n = kPvBitLen;
+    }
+    ymuint nc = 0;
+    for (ymuint i = 0; i < n; i += 4) {
+      ymuint tmp = 0U;
+      for (ymuint j = 0; j < 4 && i + j < n; ++ j) {
+	ymuint shift = shift_num(base + i + j);
+	tmp |= static_cast<ymuint>((v1 >> shift) & 1UL) << j;
+      }
+      if ( tmp <= 9 ) {
+	buff[nc] = static_cast<char>('0' + tmp);
+      }
+      else {
+	buff[nc] = static_cast<char>('A' + tmp - 10);
+      }
+      ++ nc;
+    }
+    s.write(buff, nc);
+  }
+}
+
+// @brief テストベクタの配列を入力ごとのビット列に変換する．
+// @param[in] tv_array テストベクタの配列
+// @param[out] val0_array 入力ごとの 0 のビットを入れる配列
+// @param[out] val1_array 入力ごとの 1 のビットを入れる配列
+//
+// 入力の 64 ビットとパタンの 64 ビットからなる正方行列ごとに
+// transpose64() で転置する．
+// 1つのテストベクタのブロックでは入力番号の小さい方が上位のビットに
+// 入っているので，パタンを逆順に並べて転置すると i 番めの行が
+// ブロック内の i 番めの入力に対応し，j 番めのパタンが j ビットめになる．
+void
+TestVector::transpose(const vector<TestVector*>& tv_array,
+		      PackedValW* val0_array,
+		      PackedValW* val1_array)
+{
+  ymuint nb = tv_array.size();
+  ASSERT_COND( nb > 0 && nb <= kPvwBitLen );
+
+  const TestVector* tv0 = tv_array[0];
+  ymuint ni = tv0->input_num();
+  PackedValW* dst_array[2] = { val0_array, val1_array };
+  PackedVal a[kPvBitLen];
+  for (ymuint base = 0; base < ni; base += kPvBitLen) {
+    ymuint blk = block_idx(base);
+    ymuint n = ni - base;
+    if ( n > kPvBitLen ) {
+      n = kPvBitLen;
+    }
+    for (ymuint r = 0; r < 2; ++ r) {
+      PackedValW* dst = dst_array[r];
+      if ( dst == nullptr ) {
+	continue;
+      }
+      // 0 と 1 の両方のビットが立っている場合は X とみなす．
+      ymuint pos = blk + r;
+      ymuint npos = blk + 1 - r;
+      PackedVal pat0 = tv0->mPat[pos] & ~tv0->mPat[npos];
+      for (ymuint w = 0; w < kPvwWordNum; ++ w) {
+	ymuint start = w * kPvBitLen;
+	if ( start >= nb ) {
+	  // 全てのビットが 0 番めのパタン
+	  for (ymuint i = 0; i < n; ++ i) {
+	    PackedVal bit = (pat0 >> shift_num(base + i)) & 1UL;
+	    dst[base + i].set_word(w, kPvAll0 - bit);
+	  }
+	  continue;
+	}
+	for (ymuint j = 0; j < kPvBitLen; ++ j) {
+	  ymuint p = start + j;
+	  if ( p < nb ) {
+	    const TestVector* tv = tv_array[p];
+	    a[kPvBitLen - 1 - j] = tv->mPat[pos] & ~tv->mPat[npos];
+	  }
+	  else {
+	    a[kPvBitLen - 1 - j] = pat0;
+	  }
+	}
+	transpose64(a);
+	for (ymuint i = 0; i < n; ++ i) {
+	  dst[base + i].set_word(w, a[i]);
+	}
+      }
+    }
+  }
+}
+
 END_NAMESPACE_YM_SATPG
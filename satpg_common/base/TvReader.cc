@@ -0,0 +1,213 @@
+﻿
+/// @file TvReader.cc
+/// @brief TvReader の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "TvReader.h"
+#include "TvWriter.h"
+#include "TvMgr.h"
+#include "TestVector.h"
+#include "TpgNetwork.h"
+#include "TpgNode.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス TvReader
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+// @param[in] s 入力元のストリーム
+TvReader::TvReader(istream& s) :
+  mS(s),
+  mInputNum(0),
+  mCount(0)
+{
+}
+
+// @brief デストラクタ
+TvReader::~TvReader()
+{
+}
+
+// @brief ヘッダを読み込む．
+// @param[in] network 対象のネットワーク
+// @return エラーが起きたら false を返す．
+bool
+TvReader::read_header(const TpgNetwork& network)
+{
+  mErrorMsg = string();
+  mCount = 0;
+
+  ymuint magic_len = sizeof(TvWriter::kMagic);
+  if ( !fill_buff(magic_len) ) {
+    return false;
+  }
+  for (ymuint i = 0; i < magic_len; ++ i) {
+    if ( mBuff[i] != TvWriter::kMagic[i] ) {
+      set_error("not a pattern file");
+      return false;
+    }
+  }
+
+  ymuint32 ni;
+  if ( !get_uint32(ni) ) {
+    return false;
+  }
+  if ( ni != network.input_num2() ) {
+    ostringstream buf;
+    buf << "input number mismatch: " << ni
+	<< " in the file, " << network.input_num2() << " in the network";
+    set_error(buf.str());
+    return false;
+  }
+  mInputNum = ni;
+
+  // 入力の並びが一致しているか調べる．
+  // どちらかに名前がない場合は調べない．
+  for (ymuint i = 0; i < mInputNum; ++ i) {
+    ymuint32 len;
+    if ( !get_uint32(len) ) {
+      return false;
+    }
+    if ( !fill_buff(len) ) {
+      return false;
+    }
+    const char* name = network.input(i)->name();
+    if ( len > 0 && name != nullptr && string(mBuff.data(), len) != name ) {
+      ostringstream buf;
+      buf << "input #" << i << " mismatch: "
+	  << string(mBuff.data(), len) << " in the file, "
+	  << name << " in the network";
+      set_error(buf.str());
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// @brief テストベクタを読み込む．
+// @param[in] tvmgr テストベクタを生成するオブジェクト
+// @return 読み込んだテストベクタを返す．
+TestVector*
+TvReader::read(TvMgr& tvmgr)
+{
+  TestVector* tv = tvmgr.new_vector();
+  if ( !read(tv) ) {
+    tvmgr.delete_vector(tv);
+    return nullptr;
+  }
+  return tv;
+}
+
+// @brief テストベクタを読み込む．
+// @param[in] tv 読み込んだ値を設定するテストベクタ
+// @return 読み込めたら true を返す．
+bool
+TvReader::read(TestVector* tv)
+{
+  ASSERT_COND( tv->input_num() == mInputNum );
+
+  if ( error() || !fill_buff(1) ) {
+    return false;
+  }
+
+  ymuint8 tag = static_cast<ymuint8>(mBuff[0]);
+  if ( tag == TvWriter::kTagEnd ) {
+    ymuint32 n;
+    if ( get_uint32(n) && n != mCount ) {
+      set_error("pattern number mismatch");
+    }
+    return false;
+  }
+
+  ymuint nb = TestVector::block_num(mInputNum);
+  ymuint wsize = sizeof(PackedVal);
+  if ( tag == TvWriter::kTag2Val ) {
+    if ( !fill_buff((nb / 2) * wsize) ) {
+      return false;
+    }
+    ymuint k = mInputNum % kPvBitLen;
+    for (ymuint i = 0; i < nb; i += 2) {
+      // 最後のブロックは使っているビットだけを 0 にする．
+      PackedVal mask = kPvAll1;
+      if ( i + 2 == nb && k != 0 ) {
+	mask <<= (kPvBitLen - k);
+      }
+      PackedVal v1 = buff_word((i / 2) * wsize);
+      tv->mPat[i] = ~v1 & mask;
+      tv->mPat[i + 1] = v1;
+    }
+    ++ mCount;
+    return true;
+  }
+  else if ( tag == TvWriter::kTag3Val ) {
+    if ( !fill_buff(nb * wsize) ) {
+      return false;
+    }
+    for (ymuint i = 0; i < nb; ++ i) {
+      tv->mPat[i] = buff_word(i * wsize);
+    }
+    ++ mCount;
+    return true;
+  }
+
+  set_error("illegal pattern tag");
+  return false;
+}
+
+// @brief 指定されたバイト数をバッファに読み込む．
+// @param[in] size バイト数
+// @return 読み込めなかったら false を返す．
+bool
+TvReader::fill_buff(ymuint size)
+{
+  mBuff.resize(size);
+  if ( size > 0 && !mS.read(mBuff.data(), size) ) {
+    set_error("unexpected end of file");
+    return false;
+  }
+  return true;
+}
+
+// @brief 32ビットの数値を読み込む．
+// @param[out] val 読み込んだ値
+bool
+TvReader::get_uint32(ymuint32& val)
+{
+  if ( !fill_buff(4) ) {
+    return false;
+  }
+  val = 0;
+  for (ymuint i = 0; i < 4; ++ i) {
+    val |= static_cast<ymuint32>(static_cast<ymuint8>(mBuff[i])) << (i * 8);
+  }
+  return true;
+}
+
+// @brief バッファの pos バイトめからの1ワードを取り出す．
+PackedVal
+TvReader::buff_word(ymuint pos) const
+{
+  PackedVal val = kPvAll0;
+  for (ymuint i = 0; i < sizeof(PackedVal); ++ i) {
+    val |= static_cast<PackedVal>(static_cast<ymuint8>(mBuff[pos + i])) << (i * 8);
+  }
+  return val;
+}
+
+// @brief エラーを記録する．
+// @param[in] msg エラーメッセージ
+void
+TvReader::set_error(const string& msg)
+{
+  mErrorMsg = msg;
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,152 @@
+﻿
+/// @file TvStore.cc
+/// @brief TvStore の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "TvStore.h"
+#include "TestVector.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス TvStore
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+TvStore::TvStore() :
+  mNi(0),
+  mNum(0)
+{
+}
+
+// @brief デストラクタ
+TvStore::~TvStore()
+{
+}
+
+// @brief 初期化する．
+// @param[in] ni 入力数
+void
+TvStore::init(ymuint ni)
+{
+  clear();
+  mNi = ni;
+}
+
+// @brief 全てのテストベクタを削除する．
+void
+TvStore::clear()
+{
+  mNum = 0;
+  mVal0Array.clear();
+  mVal1Array.clear();
+}
+
+// @brief テストベクタを追加する．
+// @param[in] tv 追加するテストベクタ
+void
+TvStore::add(const TestVector* tv)
+{
+  ASSERT_COND( tv->input_num() == mNi );
+
+  ymuint blk = mNum / kPvwBitLen;
+  ymuint bpos = mNum % kPvwBitLen;
+  ymuint base = blk * mNi;
+  if ( bpos == 0 ) {
+    // 新しいブロックを確保して全てのビットにこのパタンの値を詰めておく．
+    mVal0Array.resize(base + mNi, kPvwAll0);
+    mVal1Array.resize(base + mNi, kPvwAll0);
+    for (ymuint i = 0; i < mNi; ++ i) {
+      switch ( tv->val3(i) ) {
+      case kVal0:
+	mVal0Array[base + i] = kPvwAll1;
+	break;
+
+      case kVal1:
+	mVal1Array[base + i] = kPvwAll1;
+	break;
+
+      default:
+	break;
+      }
+    }
+  }
+  else {
+    // 0 番めのパタンの値が詰めてあるビットを上書きする．
+    ymuint wpos = bpos / kPvBitLen;
+    PackedVal bit = 1UL << (bpos % kPvBitLen);
+    for (ymuint i = 0; i < mNi; ++ i) {
+      PackedValW& val0 = mVal0Array[base + i];
+      PackedValW& val1 = mVal1Array[base + i];
+      PackedVal w0 = val0.word(wpos) & ~bit;
+      PackedVal w1 = val1.word(wpos) & ~bit;
+      switch ( tv->val3(i) ) {
+      case kVal0:
+	w0 |= bit;
+	break;
+
+      case kVal1:
+	w1 |= bit;
+	break;
+
+      default:
+	break;
+      }
+      val0.set_word(wpos, w0);
+      val1.set_word(wpos, w1);
+    }
+  }
+  ++ mNum;
+}
+
+// @brief テストベクタのリストを追加する．
+// @param[in] tv_list 追加するテストベクタのリスト
+void
+TvStore::add(const vector<TestVector*>& tv_list)
+{
+  ymuint n = tv_list.size();
+  ymuint nb = (mNum + n + kPvwBitLen - 1) / kPvwBitLen;
+  mVal0Array.reserve(nb * mNi);
+  mVal1Array.reserve(nb * mNi);
+
+  // ブロックの先頭から始まる部分は TestVector::transpose() で
+  // まとめて変換する．
+  ymuint pos = 0;
+  while ( pos < n && mNum % kPvwBitLen == 0 ) {
+    ymuint n1 = n - pos;
+    if ( n1 > kPvwBitLen ) {
+      n1 = kPvwBitLen;
+    }
+    vector<TestVector*> tv_array(tv_list.begin() + pos, tv_list.begin() + pos + n1);
+    ymuint base = (mNum / kPvwBitLen) * mNi;
+    mVal0Array.resize(base + mNi, kPvwAll0);
+    mVal1Array.resize(base + mNi, kPvwAll0);
+    TestVector::transpose(tv_array, mVal0Array.data() + base, mVal1Array.data() + base);
+    mNum += n1;
+    pos += n1;
+  }
+  for ( ; pos < n; ++ pos) {
+    add(tv_list[pos]);
+  }
+}
+
+// @brief テストベクタを取り出す．
+// @param[in] pos テストベクタの番号 ( 0 <= pos < vector_num() )
+// @param[in] tv 値を設定するテストベクタ
+void
+TvStore::get_vector(ymuint pos,
+		    TestVector* tv) const
+{
+  ASSERT_COND( tv->input_num() == mNi );
+
+  for (ymuint i = 0; i < mNi; ++ i) {
+    tv->set_val(i, val3(pos, i));
+  }
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,121 @@
+﻿
+/// @file TvWriter.cc
+/// @brief TvWriter の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "TvWriter.h"
+#include "TestVector.h"
+#include "TpgNetwork.h"
+#include "TpgNode.h"
+#include <cstring>
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス TvWriter
+//////////////////////////////////////////////////////////////////////
+
+// @brief マジックナンバー
+const char TvWriter::kMagic[8] = { 'S', 'A', 'T', 'P', 'G', 'T', 'V', '1' };
+
+// @brief コンストラクタ
+// @param[in] s 出力先のストリーム
+TvWriter::TvWriter(ostream& s) :
+  mS(s),
+  mInputNum(0),
+  mCount(0)
+{
+}
+
+// @brief デストラクタ
+TvWriter::~TvWriter()
+{
+}
+
+// @brief ヘッダを書き出す．
+// @param[in] network 対象のネットワーク
+void
+TvWriter::write_header(const TpgNetwork& network)
+{
+  mInputNum = network.input_num2();
+  mCount = 0;
+
+  mBuff.insert(mBuff.end(), kMagic, kMagic + sizeof(kMagic));
+  put_uint32(mInputNum);
+  for (ymuint i = 0; i < mInputNum; ++ i) {
+    const char* name = network.input(i)->name();
+    ymuint len = (name != nullptr) ? strlen(name) : 0;
+    put_uint32(len);
+    mBuff.insert(mBuff.end(), name, name + len);
+  }
+  flush_buff();
+}
+
+// @brief テストベクタを書き出す．
+// @param[in] tv テストベクタ
+void
+TvWriter::write(const TestVector* tv)
+{
+  ASSERT_COND( tv->input_num() == mInputNum );
+
+  ymuint nb = TestVector::block_num(mInputNum);
+  if ( tv->x_num() == 0 ) {
+    // 0 のビットは 1 のビットから復元できるので
+    // 1 のビットだけを書き出す．
+    mBuff.push_back(kTag2Val);
+    for (ymuint i = 0; i < nb; i += 2) {
+      put_word(tv->mPat[i + 1]);
+    }
+  }
+  else {
+    mBuff.push_back(kTag3Val);
+    for (ymuint i = 0; i < nb; ++ i) {
+      put_word(tv->mPat[i]);
+    }
+  }
+  flush_buff();
+
+  ++ mCount;
+}
+
+// @brief 終端を書き出す．
+void
+TvWriter::write_end()
+{
+  mBuff.push_back(kTagEnd);
+  put_uint32(mCount);
+  flush_buff();
+}
+
+// @brief 32ビットの数値をバッファに加える．
+void
+TvWriter::put_uint32(ymuint32 val)
+{
+  for (ymuint i = 0; i < 4; ++ i) {
+    mBuff.push_back(static_cast<char>((val >> (i * 8)) & 0xFFU));
+  }
+}
+
+// @brief 1ワードをバッファに加える．
+void
+TvWriter::put_word(PackedVal val)
+{
+  for (ymuint i = 0; i < sizeof(PackedVal); ++ i) {
+    mBuff.push_back(static_cast<char>((val >> (i * 8)) & 0xFFUL));
+  }
+}
+
+// @brief バッファの内容を書き出す．
+void
+TvWriter::flush_buff()
+{
+  mS.write(mBuff.data(), mBuff.size());
+  mBuff.clear();
+}
+
+END_NAMESPACE_YM_SATPG
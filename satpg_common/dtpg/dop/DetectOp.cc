@@ -0,0 +1,27 @@
+﻿
+/// @file DetectOp.cc
+/// @brief DetectOp の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "DetectOp.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス DetectOp
+//////////////////////////////////////////////////////////////////////
+
+// @brief 溜め込んでいる処理を全て実行する．
+//
+// デフォルトの実装はなにもしない．
+void
+DetectOp::flush()
+{
+}
+
+END_NAMESPACE_YM_SATPG
@@ -38,6 +38,7 @@ DopDrop::DopDrop(FaultMgr& fmgr,
   mFsim(fsim),
   mOp(fmgr, fsim)
 {
+  mPatList.reserve(kPvBitLen);
 }
 
 // @brief デストラクタ
@@ -52,7 +53,22 @@ void
 DopDrop::operator()(const TpgFault* f,
 		    const NodeValList& assign_list)
 {
-  mFsim.sppfp(assign_list, mOp);
+  mPatList.push_back(assign_list);
+  if ( mPatList.size() == kPvBitLen ) {
+    flush();
+  }
+}
+
+// @brief 溜め込んでいるパタンで故障シミュレーションを行う．
+void
+DopDrop::flush()
+{
+  if ( mPatList.empty() ) {
+    return;
+  }
+
+  mFsim.ppsfp(mPatList, mOp);
+  mPatList.clear();
 }
 
 END_NAMESPACE_YM_SATPG
@@ -11,6 +11,7 @@
 
 #include "DetectOp.h"
 #include "FopDrop.h"
+#include "NodeValList.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -18,6 +19,12 @@ BEGIN_NAMESPACE_YM_SATPG
 //////////////////////////////////////////////////////////////////////
 /// @class DopDrop DopDrop.h "DopDrop.h"
 /// @brief 故障シミュレーションを行なった故障ドロップを行なうクラス
+///
+/// パタンごとに sppfp を呼ぶ代わりに kPvBitLen 個のパタンを溜めてから
+/// ppsfp でまとめてシミュレーションする．
+/// 溜まっているパタンは flush() で処理される．
+/// DTPG エンジンは FFR/MFFC ごとに flush() を呼ぶので，故障ドロップが
+/// 遅れるのは同じ FFR/MFFC 内の故障に対してだけとなる．
 //////////////////////////////////////////////////////////////////////
 class DopDrop :
   public DetectOp
@@ -48,6 +55,11 @@ public:
   operator()(const TpgFault* f,
 	     const NodeValList& assign_list);
 
+  /// @brief 溜め込んでいるパタンで故障シミュレーションを行う．
+  virtual
+  void
+  flush();
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -63,6 +75,9 @@ private:
   // Fsim 用のファンクタ
   FopDrop mOp;
 
+  // まだシミュレーションしていないパタンのリスト
+  vector<NodeValList> mPatList;
+
 };
 
 END_NAMESPACE_YM_SATPG
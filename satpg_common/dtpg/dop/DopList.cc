@@ -51,4 +51,15 @@ DopList::operator()(const TpgFault* f,
   }
 }
 
+// @brief 溜め込んでいる処理を全て実行する．
+void
+DopList::flush()
+{
+  for (vector<DetectOp*>::iterator p = mDopList.begin();
+       p != mDopList.end(); ++ p) {
+    DetectOp& dop = **p;
+    dop.flush();
+  }
+}
+
 END_NAMESPACE_YM_SATPG
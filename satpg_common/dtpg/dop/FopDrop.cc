@@ -44,4 +44,15 @@ FopDrop::operator()(const TpgFault* f,
   mFsim.set_skip(f);
 }
 
+// @brief 故障を検出したときの処理(多ワード版)
+// @param[in] f 故障
+// @param[in] dpat 検出したパタンを表すビットベクタ
+void
+FopDrop::operator()(const TpgFault* f,
+		    const PackedValW& dpat)
+{
+  mMgr.set_status(f, kFsDetected);
+  mFsim.set_skip(f);
+}
+
 END_NAMESPACE_YM_SATPG
@@ -115,8 +115,7 @@ void
 DtpgSat::cnf_end()
 {
   USTime time = timer_stop();
-  mStats.mCnfGenTime += time;
-  ++ mStats.mCnfGenCount;
+  add_cnf_time(time);
 }
 
 // @brief 時間計測を開始する．
@@ -169,12 +168,51 @@ DtpgSat::solve(SatSolver& solver,
   solver.get_stats(sat_stats);
   sat_stats -= prev_stats;
 
+  NodeValList assign_list;
   if ( ans == kB3True ) {
     // パタンが求まった．
     ModelValMap val_map(gvar_map, fvar_map, model);
 
     // バックトレースを行う．
-    mBackTracer(root, output_list, val_map, mLastAssign);
+    mBackTracer(root, output_list, val_map, assign_list);
+  }
+
+  set_result(fault, ans, assign_list, sat_stats, time);
+
+  return ans;
+}
+
+// @brief CNF 作成時間を加える．
+// @param[in] time 加える時間
+void
+DtpgSat::add_cnf_time(const USTime& time)
+{
+  mStats.mCnfGenTime += time;
+  ++ mStats.mCnfGenCount;
+}
+
+// @brief DetectOp に溜め込まれている処理を実行する．
+void
+DtpgSat::flush_dop()
+{
+  mDetectOp.flush();
+}
+
+// @brief SAT問題の結果を反映させる．
+// @param[in] fault 対象の故障
+// @param[in] ans SAT問題の結果
+// @param[in] assign_list 値の割当リスト (ans == kB3True の時のみ意味を持つ)
+// @param[in] sat_stats SATソルバの統計情報
+// @param[in] time SAT に要した時間
+void
+DtpgSat::set_result(const TpgFault* fault,
+		    SatBool3 ans,
+		    const NodeValList& assign_list,
+		    const SatStats& sat_stats,
+		    const USTime& time)
+{
+  if ( ans == kB3True ) {
+    mLastAssign = assign_list;
 
     // パタンの登録などを行う．
     mDetectOp(fault, mLastAssign);
@@ -190,7 +228,6 @@ DtpgSat::solve(SatSolver& solver,
   else { // ans == kB3X つまりアボート
     mStats.update_abort(sat_stats, time);
   }
-  return ans;
 }
 
 // @brief 最後に生成された値割当リストを得る．
@@ -115,6 +115,39 @@ protected:
   USTime
   timer_stop();
 
+  /// @brief 時間計測が有効の時 true を返す．
+  bool
+  timer_enabled() const;
+
+  /// @brief CNF 作成時間を加える．
+  /// @param[in] time 加える時間
+  ///
+  /// cnf_begin()/cnf_end() を用いずに別の場所で計測した時に用いる．
+  void
+  add_cnf_time(const USTime& time);
+
+  /// @brief DetectOp に溜め込まれている処理を実行する．
+  ///
+  /// FFR/MFFC ごとの処理の前に呼ぶことで，それまでに見つかった
+  /// パタンで検出される故障を対象から外せるようにする．
+  void
+  flush_dop();
+
+  /// @brief SAT問題の結果を反映させる．
+  /// @param[in] fault 対象の故障
+  /// @param[in] ans SAT問題の結果
+  /// @param[in] assign_list 値の割当リスト (ans == kB3True の時のみ意味を持つ)
+  /// @param[in] sat_stats SATソルバの統計情報
+  /// @param[in] time SAT に要した時間
+  ///
+  /// DetectOp/UntestOp の呼び出しと統計情報の更新を行う．
+  void
+  set_result(const TpgFault* fault,
+	     SatBool3 ans,
+	     const NodeValList& assign_list,
+	     const SatStats& sat_stats,
+	     const USTime& time);
+
   /// @brief 一つの SAT問題を解く．
   /// @param[in] solver SATソルバ
   SatBool3
@@ -196,6 +229,14 @@ DtpgSat::sat_outp() const
   return mSatOutP;
 }
 
+// @brief 時間計測が有効の時 true を返す．
+inline
+bool
+DtpgSat::timer_enabled() const
+{
+  return mTimerEnable;
+}
+
 END_NAMESPACE_YM_SATPG
 
 #endif // DTPGSAT_H
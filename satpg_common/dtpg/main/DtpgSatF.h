@@ -0,0 +1,79 @@
+﻿#ifndef DTPGSATF_H
+#define DTPGSATF_H
+
+/// @file DtpgSatF.h
+/// @brief DtpgSatF のヘッダファイル
+///
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014, 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "DtpgSat.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class DtpgSatF DtpgSatF.h "DtpgSatF.h"
+/// @brief FFR ごとに1つの SAT ソルバを用いる DtpgSat
+///
+/// FFR の根から先の CNF を一度だけ作り，個々の故障の活性化条件と
+/// FFR 内の伝搬条件は仮定(assumption)として与える．
+/// 学習節は同じ FFR 内の故障の間で共有される．
+//////////////////////////////////////////////////////////////////////
+class DtpgSatF :
+  public DtpgSat
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] sat_type SATソルバの種類を表す文字列
+  /// @param[in] sat_option SATソルバに渡すオプション文字列
+  /// @param[in] sat_outp SATソルバ用の出力ストリーム
+  /// @param[in] bt バックトレーサー
+  /// @param[in] dop パタンが求められた時に実行されるファンクタ
+  /// @param[in] uop 検出不能と判定された時に実行されるファンクタ
+  DtpgSatF(const string& sat_type,
+	   const string& sat_option,
+	   ostream* sat_outp,
+	   BackTracer& bt,
+	   DetectOp& dop,
+	   UntestOp& uop);
+
+  /// @brief デストラクタ
+  virtual
+  ~DtpgSatF();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief テスト生成を行なう．
+  /// @param[in] network 対象のネットワーク
+  /// @param[in] fmgr 故障マネージャ
+  /// @param[in] fsim 故障シミュレータ
+  /// @param[in] fault_list 対象の故障リスト
+  /// @param[out] stats 結果を格納する構造体
+  virtual
+  void
+  run(TpgNetwork& network,
+      FaultMgr& fmgr,
+      Fsim& fsim,
+      const vector<const TpgFault*>& fault_list,
+      DtpgStats& stats);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // DTPGSATF_H
@@ -54,34 +54,6 @@ DtpgSatH::~DtpgSatH()
 {
 }
 
-BEGIN_NONAMESPACE
-
-void
-get_ffr_faults(const TpgNode* node,
-	       const vector<bool>& fault_mark,
-	       vector<const TpgFault*>& fault_list)
-{
-  // node 上のマークされている故障を fault_list に入れる．
-  ymuint nf = node->fault_num();
-  for (ymuint i = 0; i < nf; ++ i) {
-    const TpgFault* f = node->fault(i);
-    if ( fault_mark[f->id()] ) {
-      fault_list.push_back(f);
-    }
-  }
-
-  // ファンインが同じ FFR のノードなら再帰する．
-  ymuint ni = node->fanin_num();
-  for (ymuint i = 0; i < ni; ++ i) {
-    const TpgNode* inode = node->fanin(i);
-    if ( inode->ffr_root() == node->ffr_root() ) {
-      get_ffr_faults(inode, fault_mark, fault_list);
-    }
-  }
-}
-
-END_NONAMESPACE
-
 // @brief テスト生成を行なう．
 // @param[in] network 対象のネットワーク
 // @param[in] fmgr 故障マネージャ
@@ -97,8 +69,8 @@ DtpgSatH::run(TpgNetwork& network,
 {
   clear_stats();
 
-  // 故障シミュレータに故障リストをセットする．
-  fsim.set_faults(fault_list);
+  // 故障シミュレータには未検出の故障をセットする．
+  fsim.set_faults(fmgr);
 
   ymuint max_fault_id = network.max_fault_id();
 
@@ -122,12 +94,15 @@ DtpgSatH::run(TpgNetwork& network,
     if ( ne == 1 ) {
       // node を根とする FFR に含まれる故障を求める．
       vector<const TpgFault*> f_list;
-      get_ffr_faults(node, fault_mark, f_list);
+      node->get_ffr_faults(fault_mark, f_list);
       if ( f_list.empty() ) {
 	// 故障が残っていないのでパス
 	continue;
       }
 
+      // それまでのパタンで検出された故障を対象から外す．
+      flush_dop();
+
       cnf_begin();
 
       StructSat struct_sat(max_id);
@@ -160,7 +135,7 @@ DtpgSatH::run(TpgNetwork& network,
       for (ymuint j = 0; j < ne; ++ j) {
 	const TpgNode* node1 = node->mffc_elem(j);
 	// node1 を根とする FFR に含まれる故障を求める．
-	get_ffr_faults(node1, fault_mark, f_list[j]);
+	node1->get_ffr_faults(fault_mark, f_list[j]);
 	nf += f_list[j].size();
       }
       if ( nf == 0 ) {
@@ -168,6 +143,9 @@ DtpgSatH::run(TpgNetwork& network,
 	continue;
       }
 
+      // それまでのパタンで検出された故障を対象から外す．
+      flush_dop();
+
       cnf_begin();
 
       StructSat struct_sat(max_id);
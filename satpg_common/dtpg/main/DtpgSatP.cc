@@ -0,0 +1,343 @@
+/// @file DtpgSatP.cc
+/// @brief DtpgSatP の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "DtpgSatP.h"
+#include "DtpgStats.h"
+#include "StructSat.h"
+#include "FoCone.h"
+#include "MffcCone.h"
+#include "TpgFault.h"
+#include "TpgNetwork.h"
+#include "FaultMgr.h"
+#include "Fsim.h"
+#include "BackTracer.h"
+#include "ModelValMap.h"
+#include "ym/SatSolver.h"
+#include <thread>
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+// @brief 並列版の Hierachical エンジンを作る．
+// @param[in] thread_num スレッド数 (0 の場合はハードウェアの並列度)
+// @param[in] sat_type SATソルバの種類を表す文字列
+// @param[in] sat_option SATソルバに渡すオプション文字列
+// @param[in] sat_outp SATソルバ用の出力ストリーム
+// @param[in] bt バックトレーサー
+// @param[in] dop パタンが求められた時に実行されるファンクタ
+// @param[in] uop 検出不能と判定された時に実行されるファンクタ
+DtpgEngine*
+new_DtpgSatP(ymuint thread_num,
+	     const string& sat_type,
+	     const string& sat_option,
+	     ostream* sat_outp,
+	     BackTracer& bt,
+	     DetectOp& dop,
+	     UntestOp& uop)
+{
+  return new DtpgSatP(thread_num, sat_type, sat_option, sat_outp, bt, dop, uop);
+}
+
+// @brief コンストラクタ
+DtpgSatP::DtpgSatP(ymuint thread_num,
+		   const string& sat_type,
+		   const string& sat_option,
+		   ostream* sat_outp,
+		   BackTracer& bt,
+		   DetectOp& dop,
+		   UntestOp& uop) :
+  DtpgSat(sat_type, sat_option, sat_outp, bt, dop, uop),
+  mThreadNum(thread_num),
+  mNextJob(0)
+{
+  if ( mThreadNum == 0 ) {
+    mThreadNum = std::thread::hardware_concurrency();
+    if ( mThreadNum == 0 ) {
+      mThreadNum = 1;
+    }
+  }
+}
+
+// @brief デストラクタ
+DtpgSatP::~DtpgSatP()
+{
+}
+
+// @brief テスト生成を行なう．
+// @param[in] network 対象のネットワーク
+// @param[in] fmgr 故障マネージャ
+// @param[in] fsim 故障シミュレータ
+// @param[in] fault_list 対象の故障リスト
+// @param[out] stats 結果を格納する構造体
+//
+// 各スレッドは mJobList の仕事を先頭から順に取り出して処理する．
+// DetectOp/UntestOp は FaultMgr や Fsim を書き換えるので
+// このスレッド(呼び出し側)でのみ MFFC の順に実行する．
+void
+DtpgSatP::run(TpgNetwork& network,
+	      FaultMgr& fmgr,
+	      Fsim& fsim,
+	      const vector<const TpgFault*>& fault_list,
+	      DtpgStats& stats)
+{
+  clear_stats();
+
+  // 故障シミュレータには未検出の故障をセットする．
+  fsim.set_faults(fmgr);
+
+  ymuint max_fault_id = network.max_fault_id();
+
+  // fault_list に含まれる故障に印をつける．
+  vector<bool> fault_mark(max_fault_id, false);
+  for (ymuint i = 0; i < fault_list.size(); ++ i) {
+    const TpgFault* fault = fault_list[i];
+    ymuint fid = fault->id();
+    fault_mark[fid] = true;
+  }
+
+  // MFFC ごとに仕事を作る．
+  mJobList.clear();
+  ymuint nn = network.active_node_num();
+  ymuint max_id = network.node_num();
+  for (ymuint i = 0; i < nn; ++ i) {
+    const TpgNode* node = network.active_node(i);
+    if ( node->imm_dom() != nullptr ) {
+      continue;
+    }
+
+    ymuint ne = node->mffc_elem_num();
+    vector<vector<const TpgFault*> > f_list(ne);
+    ymuint nf = 0;
+    if ( ne == 1 ) {
+      node->get_ffr_faults(fault_mark, f_list[0]);
+      nf = f_list[0].size();
+    }
+    else {
+      for (ymuint j = 0; j < ne; ++ j) {
+	const TpgNode* node1 = node->mffc_elem(j);
+	node1->get_ffr_faults(fault_mark, f_list[j]);
+	nf += f_list[j].size();
+      }
+    }
+    if ( nf == 0 ) {
+      // 故障が残っていないのでパス
+      continue;
+    }
+
+    mJobList.push_back(Job());
+    Job& job = mJobList.back();
+    job.mRoot = node;
+    job.mFaultList.swap(f_list);
+    job.mCnfTime.set(0.0, 0.0, 0.0);
+    job.mDone = false;
+  }
+
+  mNextJob = 0;
+
+  ymuint nj = mJobList.size();
+  ymuint nt = mThreadNum;
+  if ( nt > nj ) {
+    nt = nj;
+  }
+  vector<std::thread> thread_list;
+  thread_list.reserve(nt);
+  for (ymuint i = 0; i < nt; ++ i) {
+    thread_list.push_back(std::thread(&DtpgSatP::worker, this, max_id));
+  }
+
+  // 終わった仕事から順番に結果を反映させる．
+  for (ymuint i = 0; i < nj; ++ i) {
+    Job& job = mJobList[i];
+    {
+      std::unique_lock<std::mutex> lock(mMutex);
+      while ( !job.mDone ) {
+	mCond.wait(lock);
+      }
+    }
+
+    add_cnf_time(job.mCnfTime);
+
+    // それまでのパタンで検出された故障を対象から外す．
+    flush_dop();
+
+    for (ymuint j = 0; j < job.mResultList.size(); ++ j) {
+      const Result& result = job.mResultList[j];
+      if ( fmgr.status(result.mFault) != kFsUndetected ) {
+	// 前の結果によって検出済みとなった．
+	continue;
+      }
+      set_result(result.mFault, result.mAns, result.mAssignList,
+		 result.mSatStats, result.mTime);
+    }
+
+    // メモリを解放しておく
+    vector<Result>().swap(job.mResultList);
+  }
+
+  for (ymuint i = 0; i < nt; ++ i) {
+    thread_list[i].join();
+  }
+
+  mJobList.clear();
+
+  get_stats(stats);
+}
+
+// @brief ワーカースレッドの本体
+// @param[in] max_id ノード番号の最大値 + 1
+void
+DtpgSatP::worker(ymuint max_id)
+{
+  BackTracer bt(max_id);
+
+  ymuint nj = mJobList.size();
+  for ( ; ; ) {
+    ymuint id = mNextJob ++;
+    if ( id >= nj ) {
+      break;
+    }
+
+    Job& job = mJobList[id];
+    do_job(job, max_id, bt);
+
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      job.mDone = true;
+    }
+    mCond.notify_all();
+  }
+}
+
+// @brief 1つの仕事を処理する．
+// @param[in] job 対象の仕事
+// @param[in] max_id ノード番号の最大値 + 1
+// @param[in] bt このスレッド用のバックトレーサー
+//
+// usr/sys 時間はプロセス全体の値で，複数のスレッドで足し合わせると
+// 実際よりも大きくなってしまうので，各スレッドでは経過時間のみを記録する．
+void
+DtpgSatP::do_job(Job& job,
+		 ymuint max_id,
+		 BackTracer& bt)
+{
+  StopWatch timer;
+
+  const TpgNode* node = job.mRoot;
+  ymuint ne = job.mFaultList.size();
+  if ( ne == 1 ) {
+    if ( timer_enabled() ) {
+      timer.start();
+    }
+
+    StructSat struct_sat(max_id, sat_type(), sat_option());
+    const FoCone* focone = struct_sat.add_focone(node, kVal1);
+
+    if ( timer_enabled() ) {
+      timer.stop();
+      job.mCnfTime.set(0.0, 0.0, timer.time().real_time());
+    }
+
+    const vector<const TpgFault*>& f_list = job.mFaultList[0];
+    ymuint nf = f_list.size();
+    for (ymuint i = 0; i < nf; ++ i) {
+      const TpgFault* fault = f_list[i];
+
+      // FFR 内の故障活性化&伝搬条件を求める．
+      NodeValList assignment;
+      struct_sat.add_ffr_condition(node, fault, assignment);
+
+      vector<SatLiteral> assumption;
+      struct_sat.conv_to_assumption(assignment, assumption);
+
+      // 故障に対するテスト生成を行なう．
+      solve_job(struct_sat.solver(), assumption, fault, node, focone->output_list(),
+		focone->gvar_map(), focone->fvar_map(), bt, job);
+    }
+  }
+  else {
+    if ( timer_enabled() ) {
+      timer.start();
+    }
+
+    StructSat struct_sat(max_id, sat_type(), sat_option());
+    const MffcCone* mffc_cone = struct_sat.add_mffccone(node);
+
+    if ( timer_enabled() ) {
+      timer.stop();
+      job.mCnfTime.set(0.0, 0.0, timer.time().real_time());
+    }
+
+    for (ymuint j = 0; j < ne; ++ j) {
+      const TpgNode* node1 = node->mffc_elem(j);
+      const vector<const TpgFault*>& f_list1 = job.mFaultList[j];
+      ymuint nf = f_list1.size();
+      for (ymuint i = 0; i < nf; ++ i) {
+	const TpgFault* fault = f_list1[i];
+
+	// FFR 内の故障活性化&伝搬条件を求める．
+	NodeValList assignment;
+	struct_sat.add_ffr_condition(node1, fault, assignment);
+
+	vector<SatLiteral> assumption;
+	struct_sat.conv_to_assumption(assignment, assumption);
+
+	// node1 の出力に故障を挿入する．
+	mffc_cone->select_fault_node(j, assumption);
+
+	// 故障に対するテスト生成を行なう．
+	solve_job(struct_sat.solver(), assumption, fault, node1, mffc_cone->output_list(),
+		  mffc_cone->gvar_map(), mffc_cone->fvar_map(), bt, job);
+      }
+    }
+  }
+}
+
+// @brief 1つの SAT 問題を解いて結果を記録する．
+void
+DtpgSatP::solve_job(SatSolver& solver,
+		    const vector<SatLiteral>& assumptions,
+		    const TpgFault* fault,
+		    const TpgNode* root,
+		    const vector<const TpgNode*>& output_list,
+		    const VidMap& gvar_map,
+		    const VidMap& fvar_map,
+		    BackTracer& bt,
+		    Job& job)
+{
+  StopWatch timer;
+
+  SatStats prev_stats;
+  solver.get_stats(prev_stats);
+
+  timer.reset();
+  timer.start();
+
+  vector<SatBool3> model;
+  SatBool3 ans = solver.solve(assumptions, model);
+
+  timer.stop();
+
+  job.mResultList.push_back(Result());
+  Result& result = job.mResultList.back();
+  result.mFault = fault;
+  result.mAns = ans;
+  result.mTime.set(0.0, 0.0, timer.time().real_time());
+
+  solver.get_stats(result.mSatStats);
+  result.mSatStats -= prev_stats;
+
+  if ( ans == kB3True ) {
+    // パタンが求まった．
+    ModelValMap val_map(gvar_map, fvar_map, model);
+
+    // バックトレースを行う．
+    bt(root, output_list, val_map, result.mAssignList);
+  }
+}
+
+END_NAMESPACE_YM_SATPG
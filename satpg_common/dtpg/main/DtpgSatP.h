@@ -0,0 +1,178 @@
+﻿#ifndef DTPGSATP_H
+#define DTPGSATP_H
+
+/// @file DtpgSatP.h
+/// @brief DtpgSatP のヘッダファイル
+///
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014, 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "DtpgSat.h"
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class DtpgSatP DtpgSatP.h "DtpgSatP.h"
+/// @brief MFFC 単位で複数のスレッドに処理を分割する DtpgSat
+///
+/// 個々の MFFC(FFR) に対する処理は DtpgSatH と同様．
+/// 各スレッドは自分専用の StructSat と BackTracer を持つ．
+/// 結果(DetectOp/UntestOp の呼び出し)はメインスレッドで
+/// MFFC の順番通りに反映されるので，スレッド数によらず同一の結果となる．
+/// なお，CNF 作成と SAT の時間は経過時間のみを集計する．
+//////////////////////////////////////////////////////////////////////
+class DtpgSatP :
+  public DtpgSat
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] thread_num スレッド数 (0 の場合はハードウェアの並列度)
+  /// @param[in] sat_type SATソルバの種類を表す文字列
+  /// @param[in] sat_option SATソルバに渡すオプション文字列
+  /// @param[in] sat_outp SATソルバ用の出力ストリーム
+  /// @param[in] bt バックトレーサー
+  /// @param[in] dop パタンが求められた時に実行されるファンクタ
+  /// @param[in] uop 検出不能と判定された時に実行されるファンクタ
+  DtpgSatP(ymuint thread_num,
+	   const string& sat_type,
+	   const string& sat_option,
+	   ostream* sat_outp,
+	   BackTracer& bt,
+	   DetectOp& dop,
+	   UntestOp& uop);
+
+  /// @brief デストラクタ
+  virtual
+  ~DtpgSatP();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief テスト生成を行なう．
+  /// @param[in] network 対象のネットワーク
+  /// @param[in] fmgr 故障マネージャ
+  /// @param[in] fsim 故障シミュレータ
+  /// @param[in] fault_list 対象の故障リスト
+  /// @param[out] stats 結果を格納する構造体
+  virtual
+  void
+  run(TpgNetwork& network,
+      FaultMgr& fmgr,
+      Fsim& fsim,
+      const vector<const TpgFault*>& fault_list,
+      DtpgStats& stats);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // 1つの故障に対する結果
+  struct Result
+  {
+    // 対象の故障
+    const TpgFault* mFault;
+
+    // SAT の結果
+    SatBool3 mAns;
+
+    // 値の割当(mAns == kB3True の時のみ意味を持つ)
+    NodeValList mAssignList;
+
+    // SATソルバの統計情報
+    SatStats mSatStats;
+
+    // SAT に要した時間(経過時間のみ)
+    USTime mTime;
+  };
+
+  // 1つの MFFC に対する仕事
+  struct Job
+  {
+    // MFFC の根のノード
+    const TpgNode* mRoot;
+
+    // mffc_elem ごとの故障リスト
+    // ただし FFR の場合は要素数 1
+    vector<vector<const TpgFault*> > mFaultList;
+
+    // 結果のリスト
+    vector<Result> mResultList;
+
+    // CNF 作成に要した時間(経過時間のみ)
+    USTime mCnfTime;
+
+    // 処理が終わったことを示すフラグ
+    bool mDone;
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ワーカースレッドの本体
+  /// @param[in] max_id ノード番号の最大値 + 1
+  void
+  worker(ymuint max_id);
+
+  /// @brief 1つの仕事を処理する．
+  /// @param[in] job 対象の仕事
+  /// @param[in] max_id ノード番号の最大値 + 1
+  /// @param[in] bt このスレッド用のバックトレーサー
+  void
+  do_job(Job& job,
+	 ymuint max_id,
+	 BackTracer& bt);
+
+  /// @brief 1つの SAT 問題を解いて結果を記録する．
+  void
+  solve_job(SatSolver& solver,
+	    const vector<SatLiteral>& assumptions,
+	    const TpgFault* fault,
+	    const TpgNode* root,
+	    const vector<const TpgNode*>& output_list,
+	    const VidMap& gvar_map,
+	    const VidMap& fvar_map,
+	    BackTracer& bt,
+	    Job& job);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // スレッド数
+  ymuint mThreadNum;
+
+  // 仕事のリスト
+  vector<Job> mJobList;
+
+  // 次に取り出す仕事の番号
+  std::atomic<ymuint> mNextJob;
+
+  // mDone を保護する mutex
+  std::mutex mMutex;
+
+  // 仕事の終了を通知する条件変数
+  std::condition_variable mCond;
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // DTPGSATP_H
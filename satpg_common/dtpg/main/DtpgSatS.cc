@@ -68,8 +68,8 @@ DtpgSatS::run(TpgNetwork& network,
 {
   clear_stats();
 
-  // 故障シミュレータに故障リストをセットする．
-  fsim.set_faults(fault_list);
+  // 故障シミュレータには未検出の故障をセットする．
+  fsim.set_faults(fmgr);
 
   ymuint max_fault_id = network.max_fault_id();
 
@@ -86,6 +86,9 @@ DtpgSatS::run(TpgNetwork& network,
   for (ymuint i = 0; i < nn; ++ i) {
     const TpgNode* node = network.active_node(i);
 
+    // それまでのパタンで検出された故障を対象から外す．
+    flush_dop();
+
     ymuint nf = node->fault_num();
     for (ymuint i = 0; i < nf; ++ i) {
       const TpgFault* fault = node->fault(i);
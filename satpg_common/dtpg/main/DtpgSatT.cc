@@ -0,0 +1,293 @@
+﻿
+/// @file DtpgSatT.cc
+/// @brief DtpgSatT の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "DtpgSatT.h"
+#include "DtpgStats.h"
+#include "StructSat.h"
+#include "FoCone.h"
+#include "NodeValList.h"
+#include "VidLitMap.h"
+#include "TpgFault.h"
+#include "TpgNetwork.h"
+#include "FaultMgr.h"
+#include "Fsim.h"
+#include "ym/SatStats.h"
+#include "ym/StopWatch.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+// @brief 遷移故障用のエンジンを作る．
+// @param[in] sat_type SATソルバの種類を表す文字列
+// @param[in] sat_option SATソルバに渡すオプション文字列
+// @param[in] sat_outp SATソルバ用の出力ストリーム
+// @param[in] bt バックトレーサー
+// @param[in] dop パタンが求められた時に実行されるファンクタ
+// @param[in] uop 検出不能と判定された時に実行されるファンクタ
+DtpgEngine*
+new_DtpgSatT(const string& sat_type,
+	     const string& sat_option,
+	     ostream* sat_outp,
+	     BackTracer& bt,
+	     DetectOp& dop,
+	     UntestOp& uop)
+{
+  return new DtpgSatT(sat_type, sat_option, sat_outp, bt, dop, uop);
+}
+
+// @brief コンストラクタ
+DtpgSatT::DtpgSatT(const string& sat_type,
+		   const string& sat_option,
+		   ostream* sat_outp,
+		   BackTracer& bt,
+		   DetectOp& dop,
+		   UntestOp& uop) :
+  DtpgSat(sat_type, sat_option, sat_outp, bt, dop, uop),
+  mNetwork(nullptr)
+{
+}
+
+// @brief デストラクタ
+DtpgSatT::~DtpgSatT()
+{
+}
+
+// @brief テスト生成を行なう．
+// @param[in] network 対象のネットワーク
+// @param[in] fmgr 故障マネージャ
+// @param[in] fsim 故障シミュレータ
+// @param[in] fault_list 対象の故障リスト
+// @param[out] stats 結果を格納する構造体
+void
+DtpgSatT::run(TpgNetwork& network,
+	      FaultMgr& fmgr,
+	      Fsim& fsim,
+	      const vector<const TpgFault*>& fault_list,
+	      DtpgStats& stats)
+{
+  clear_stats();
+
+  mNetwork = &network;
+
+  // 故障シミュレータには未検出の故障をセットする．
+  fsim.set_faults(fmgr);
+
+  ymuint max_fault_id = network.max_fault_id();
+
+  // fault_list に含まれる故障に印をつける．
+  vector<bool> fault_mark(max_fault_id, false);
+  for (ymuint i = 0; i < fault_list.size(); ++ i) {
+    const TpgFault* fault = fault_list[i];
+    ymuint fid = fault->id();
+    fault_mark[fid] = true;
+  }
+
+  ymuint nn = network.active_node_num();
+  ymuint max_id = network.node_num();
+  for (ymuint i = 0; i < nn; ++ i) {
+    const TpgNode* node = network.active_node(i);
+    if ( node->ffr_root() != node ) {
+      continue;
+    }
+
+    // node を根とする FFR に含まれる故障を求める．
+    vector<const TpgFault*> f_list;
+    node->get_ffr_faults(fault_mark, f_list);
+    if ( f_list.empty() ) {
+      // 故障が残っていないのでパス
+      continue;
+    }
+
+    // それまでのパタンで検出された故障を対象から外す．
+    flush_dop();
+
+    // 2時刻分の CNF はこの FFR に対して一度だけ作る．
+    cnf_begin();
+
+    StructSat struct_sat(max_id, sat_type(), sat_option(), sat_outp());
+    const FoCone* focone = struct_sat.add_focone(node, kVal1);
+
+    mHvarMap.init(max_id);
+    mHmark.clear();
+    mHmark.resize(max_id, false);
+    mInputList.clear();
+    connect_ppi(struct_sat, focone->output_list());
+
+    cnf_end();
+
+    ymuint nf = f_list.size();
+    for (ymuint i = 0; i < nf; ++ i) {
+      const TpgFault* fault = f_list[i];
+      if ( fmgr.status(fault) != kFsUndetected ) {
+	continue;
+      }
+
+      // 2時刻目の故障の活性化条件と FFR 内の伝搬条件を仮定に変換する．
+      NodeValList assignment;
+      struct_sat.add_ffr_condition(node, fault, assignment);
+
+      vector<SatLiteral> assumption;
+      struct_sat.conv_to_assumption(assignment, assumption);
+
+      // 1時刻目の故障箇所の値を故障値にする初期化条件を加える．
+      const TpgNode* inode = fault->tpg_inode();
+      make_prev_cnf(struct_sat, inode);
+      SatLiteral hlit(mHvarMap(inode), false);
+      if ( fault->val() == 1 ) {
+	assumption.push_back(hlit);
+      }
+      else {
+	assumption.push_back(~hlit);
+      }
+
+      // 故障に対するテスト生成を行なう．
+      solve_td(struct_sat.solver(), assumption, fault);
+    }
+  }
+
+  mNetwork = nullptr;
+
+  get_stats(stats);
+}
+
+// @brief 2時刻目の擬似外部入力を1時刻目の回路につなぐ．
+// @param[in] struct_sat 2時刻目の CNF を持つソルバ
+// @param[in] output_list 2時刻目の fault cone の出力のリスト
+void
+DtpgSatT::connect_ppi(StructSat& struct_sat,
+		      const vector<const TpgNode*>& output_list)
+{
+  SatSolver& solver = struct_sat.solver();
+  ymuint npi1 = mNetwork->input_num();
+
+  // output_list の TFI を求める．
+  // FoCone がすでに2時刻目の CNF を作っている範囲と同じになる．
+  vector<bool> mark(struct_sat.max_node_id(), false);
+  vector<const TpgNode*> node_list(output_list.begin(), output_list.end());
+  for (ymuint i = 0; i < node_list.size(); ++ i) {
+    mark[node_list[i]->id()] = true;
+  }
+  for (ymuint rpos = 0; rpos < node_list.size(); ++ rpos) {
+    const TpgNode* node = node_list[rpos];
+    if ( node->is_input() ) {
+      ymuint iid = node->input_id();
+      if ( iid < npi1 ) {
+	// 外部入力は2時刻目と共通の変数を用いる．
+	make_prev_cnf(struct_sat, node);
+      }
+      else {
+	// 擬似外部入力は1時刻目の擬似外部出力と等しい．
+	const TpgNode* onode = mNetwork->dff_input(iid - npi1);
+	make_prev_cnf(struct_sat, onode);
+	SatLiteral glit(struct_sat.var(node), false);
+	SatLiteral hlit(mHvarMap(onode), false);
+	solver.add_clause(~glit,  hlit);
+	solver.add_clause( glit, ~hlit);
+      }
+      continue;
+    }
+    ymuint ni = node->fanin_num();
+    for (ymuint i = 0; i < ni; ++ i) {
+      const TpgNode* inode = node->fanin(i);
+      if ( !mark[inode->id()] ) {
+	mark[inode->id()] = true;
+	node_list.push_back(inode);
+      }
+    }
+  }
+}
+
+// @brief 1時刻目の node の TFI の CNF を作る．
+// @param[in] struct_sat 2時刻目の CNF を持つソルバ
+// @param[in] node 対象のノード
+void
+DtpgSatT::make_prev_cnf(StructSat& struct_sat,
+			const TpgNode* node)
+{
+  if ( mHmark[node->id()] ) {
+    return;
+  }
+  mHmark[node->id()] = true;
+
+  if ( node->is_input() ) {
+    SatVarId hvar;
+    if ( node->input_id() < mNetwork->input_num() ) {
+      // 外部入力は2時刻目も同じ値を保持する．
+      struct_sat.make_tfi_cnf(node);
+      hvar = struct_sat.var(node);
+    }
+    else {
+      hvar = struct_sat.solver().new_var();
+    }
+    mHvarMap.set_vid(node, hvar);
+    mInputList.push_back(node);
+    return;
+  }
+
+  // 先に TFI のノードの節を作る．
+  ymuint ni = node->fanin_num();
+  for (ymuint i = 0; i < ni; ++ i) {
+    const TpgNode* inode = node->fanin(i);
+    make_prev_cnf(struct_sat, inode);
+  }
+
+  SatVarId hvar = struct_sat.solver().new_var();
+  mHvarMap.set_vid(node, hvar);
+
+  // node の入出力の関係を表す節を作る．
+  node->make_cnf(struct_sat.solver(), VidLitMap(node, mHvarMap));
+}
+
+// @brief 一つの SAT問題を解く．
+// @param[in] solver SATソルバ
+// @param[in] assumptions 仮定
+// @param[in] fault 対象の故障
+//
+// 2時刻目の値は1時刻目の入力の値から一意に決まるので
+// バックトレースは行わずに1時刻目の入力の値をそのまま用いる．
+SatBool3
+DtpgSatT::solve_td(SatSolver& solver,
+		   const vector<SatLiteral>& assumptions,
+		   const TpgFault* fault)
+{
+  StopWatch timer;
+
+  SatStats prev_stats;
+  solver.get_stats(prev_stats);
+
+  timer.reset();
+  timer.start();
+
+  vector<SatBool3> model;
+  SatBool3 ans = solver.solve(assumptions, model);
+
+  timer.stop();
+  USTime time = timer.time();
+
+  SatStats sat_stats;
+  solver.get_stats(sat_stats);
+  sat_stats -= prev_stats;
+
+  NodeValList assign_list;
+  if ( ans == kB3True ) {
+    // パタンが求まった．
+    for (ymuint i = 0; i < mInputList.size(); ++ i) {
+      const TpgNode* node = mInputList[i];
+      SatVarId hvar = mHvarMap(node);
+      assign_list.add(node, model[hvar.val()] == kB3True);
+    }
+    assign_list.sort();
+  }
+
+  set_result(fault, ans, assign_list, sat_stats, time);
+
+  return ans;
+}
+
+END_NAMESPACE_YM_SATPG
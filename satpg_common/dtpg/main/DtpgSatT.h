@@ -0,0 +1,139 @@
+﻿#ifndef DTPGSATT_H
+#define DTPGSATT_H
+
+/// @file DtpgSatT.h
+/// @brief DtpgSatT のヘッダファイル
+///
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014, 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "DtpgSat.h"
+#include "GenVidMap.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+class StructSat;
+
+//////////////////////////////////////////////////////////////////////
+/// @class DtpgSatT DtpgSatT.h "DtpgSatT.h"
+/// @brief 遷移故障用の DtpgSat
+///
+/// broadside 方式の2時刻展開を用いる．
+/// 2時刻目の外部入力は1時刻目の値を保持し，擬似外部入力には
+/// 1時刻目の擬似外部出力の値が入る．
+/// 故障値が 0 の故障を 0 -> 1 の遷移故障(slow-to-rise)，
+/// 故障値が 1 の故障を 1 -> 0 の遷移故障(slow-to-fall)とみなす．
+///
+/// DtpgSatF と同様に FFR ごとに1つの SAT ソルバを用いる．
+/// 2時刻目の故障伝搬の CNF と，擬似外部入力の値を決める1時刻目の
+/// 正常値の CNF は FFR ごとに一度だけ作り，同じ FFR 内の故障で共有する．
+/// 個々の故障の1時刻目の初期化条件は仮定として与える．
+//////////////////////////////////////////////////////////////////////
+class DtpgSatT :
+  public DtpgSat
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] sat_type SATソルバの種類を表す文字列
+  /// @param[in] sat_option SATソルバに渡すオプション文字列
+  /// @param[in] sat_outp SATソルバ用の出力ストリーム
+  /// @param[in] bt バックトレーサー
+  /// @param[in] dop パタンが求められた時に実行されるファンクタ
+  /// @param[in] uop 検出不能と判定された時に実行されるファンクタ
+  DtpgSatT(const string& sat_type,
+	   const string& sat_option,
+	   ostream* sat_outp,
+	   BackTracer& bt,
+	   DetectOp& dop,
+	   UntestOp& uop);
+
+  /// @brief デストラクタ
+  virtual
+  ~DtpgSatT();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief テスト生成を行なう．
+  /// @param[in] network 対象のネットワーク
+  /// @param[in] fmgr 故障マネージャ
+  /// @param[in] fsim 故障シミュレータ
+  /// @param[in] fault_list 対象の故障リスト
+  /// @param[out] stats 結果を格納する構造体
+  ///
+  /// fsim は2時刻分のシミュレーションを行うもの(TFsim2)でなければならない．
+  virtual
+  void
+  run(TpgNetwork& network,
+      FaultMgr& fmgr,
+      Fsim& fsim,
+      const vector<const TpgFault*>& fault_list,
+      DtpgStats& stats);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 2時刻目の擬似外部入力を1時刻目の回路につなぐ．
+  /// @param[in] struct_sat 2時刻目の CNF を持つソルバ
+  /// @param[in] output_list 2時刻目の fault cone の出力のリスト
+  ///
+  /// output_list の TFI に含まれる擬似外部入力の変数と
+  /// 対応する1時刻目の擬似外部出力の変数を等しくする．
+  void
+  connect_ppi(StructSat& struct_sat,
+	      const vector<const TpgNode*>& output_list);
+
+  /// @brief 1時刻目の node の TFI の CNF を作る．
+  /// @param[in] struct_sat 2時刻目の CNF を持つソルバ
+  /// @param[in] node 対象のノード
+  ///
+  /// 外部入力の変数は2時刻目と共通にする．
+  void
+  make_prev_cnf(StructSat& struct_sat,
+		const TpgNode* node);
+
+  /// @brief 一つの SAT問題を解く．
+  /// @param[in] solver SATソルバ
+  /// @param[in] assumptions 仮定
+  /// @param[in] fault 対象の故障
+  ///
+  /// パタンは1時刻目の入力の値割当として求める．
+  SatBool3
+  solve_td(SatSolver& solver,
+	   const vector<SatLiteral>& assumptions,
+	   const TpgFault* fault);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 対象のネットワーク
+  const TpgNetwork* mNetwork;
+
+  // 1時刻目の正常値の変数マップ
+  GenVidMap mHvarMap;
+
+  // 1時刻目の CNF を作ったノードの印
+  vector<bool> mHmark;
+
+  // 1時刻目の変数を持つ入力ノードのリスト
+  vector<const TpgNode*> mInputList;
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // DTPGSATT_H
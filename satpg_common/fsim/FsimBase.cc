@@ -0,0 +1,103 @@
+﻿
+/// @file FsimBase.cc
+/// @brief FsimBase の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2016 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "FsimBase.h"
+#include "FaultMgr.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス FsimBase
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+FsimBase::FsimBase() :
+  mSyncMgr(nullptr),
+  mSyncPos(0)
+{
+}
+
+// @brief デストラクタ
+FsimBase::~FsimBase()
+{
+}
+
+// @brief 故障にスキップマークをつける．
+void
+FsimBase::set_skip(const TpgFault* f)
+{
+  _set_skip(f);
+  if ( mSyncMgr != nullptr ) {
+    mSkipList.push_back(f);
+  }
+}
+
+// @brief 故障リストを設定する．
+// @param[in] fault_list 対象の故障リスト
+//
+// スキップマークは消される．
+void
+FsimBase::set_faults(const vector<const TpgFault*>& fault_list)
+{
+  clear_sync();
+  _set_faults(fault_list);
+}
+
+// @brief 故障マネージャの未検出故障を対象にする．
+// @param[in] fmgr 故障マネージャ
+//
+// 前回の同期以降に未検出でなくなった故障にだけスキップマークをつけ，
+// その間にスキップマークをつけた故障のうち未検出のものは元に戻す．
+// 未検出に戻った故障があった場合は故障リストを作り直す．
+void
+FsimBase::set_faults(const FaultMgr& fmgr)
+{
+  if ( mSyncMgr == &fmgr && mSyncPos >= fmgr.change_log_begin() ) {
+    ymuint end = fmgr.change_log_end();
+    bool ok = true;
+    for (ymuint pos = mSyncPos; pos < end; ++ pos) {
+      const TpgFault* f = fmgr.change_log(pos);
+      if ( is_remain(fmgr.status(f)) ) {
+	// 故障リストに入っていない可能性がある．
+	ok = false;
+	break;
+      }
+      _set_skip(f);
+    }
+    if ( ok ) {
+      // 未検出の故障は変更ログに現れていないので
+      // 前回の同期の時から故障リストに入っている．
+      for (ymuint i = 0; i < mSkipList.size(); ++ i) {
+	const TpgFault* f = mSkipList[i];
+	if ( is_remain(fmgr.status(f)) ) {
+	  _clear_skip(f);
+	}
+      }
+      mSkipList.clear();
+      mSyncPos = end;
+      return;
+    }
+  }
+
+  _set_faults(fmgr.remain_list());
+  mSkipList.clear();
+  mSyncMgr = &fmgr;
+  mSyncPos = fmgr.change_log_end();
+}
+
+// @brief 故障マネージャとの同期を解除する．
+void
+FsimBase::clear_sync()
+{
+  mSyncMgr = nullptr;
+  mSkipList.clear();
+}
+
+END_NAMESPACE_YM_SATPG
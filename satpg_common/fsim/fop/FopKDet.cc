@@ -58,6 +58,28 @@ FopKDet::operator()(const TpgFault* f,
   }
 }
 
+// @brief 故障を検出したときの処理(多ワード版)
+// @param[in] f 故障
+// @param[in] dpat 検出したパタンを表すビットベクタ
+void
+FopKDet::operator()(const TpgFault* f,
+		    const PackedValW& dpat)
+{
+  ymuint f_id = f->id();
+  vector<TestVector*>& pat_list = mPatListArray[f_id];
+  ymuint np = mCurPatList.size();
+  for (ymuint i = 0; i < np; ++ i) {
+    if ( dpat.check_bit(i) ) {
+      pat_list.push_back(mCurPatList[i]);
+      if ( pat_list.size() >= mLimit ) {
+	// 規定回数以上検出されたので以後のシミュレーションではスキップする．
+	mFsim.set_skip(f);
+	break;
+      }
+    }
+  }
+}
+
 // @brief 検出回数をクリアする．
 void
 FopKDet::clear_count()
@@ -0,0 +1,122 @@
+﻿/// @file FaultProp.cc
+/// @brief FaultProp の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "FaultProp.h"
+#include "GvalKernel.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_SATPG_FSIM2
+
+//////////////////////////////////////////////////////////////////////
+// クラス FaultProp
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+// @param[in] kernel 回路構造と正常値を持つカーネル
+//
+// kernel は初期化済みでなければならない．
+FaultProp::FaultProp(const GvalKernel& kernel) :
+  mKernel(kernel),
+  mFvalArray(kernel.node_num(), kPvwAll0),
+  mQueueArray(kernel.max_level() + 1),
+  mMarkArray(kernel.node_num(), 0),
+  mMaxLevel(0)
+{
+}
+
+// @brief デストラクタ
+FaultProp::~FaultProp()
+{
+}
+
+// @brief 故障値を正常値に揃える．
+//
+// 正常値の計算後，simulate() の前に呼ぶ必要がある．
+void
+FaultProp::init_fval()
+{
+  const PackedValW* gval = mKernel.gval_array();
+  std::copy(gval, gval + mKernel.node_num(), mFvalArray.begin());
+}
+
+// @brief 故障伝搬を行う．
+// @param[in] root_id 故障値を設定するノード番号
+// @param[in] root_fval root_id の故障値
+// @return 外部出力で観測されたビットを返す．
+PackedValW
+FaultProp::simulate(ymuint root_id,
+		    const PackedValW& root_fval)
+{
+  const PackedValW* gval = mKernel.gval_array();
+  PackedValW* fval = mFvalArray.data();
+
+  fval[root_id] = root_fval;
+  mClearList.push_back(root_id);
+  put_fanouts(root_id);
+
+  // どこかの外部出力で検出されたことを表すビット
+  PackedValW obs = kPvwAll0;
+  // ファンアウトのレベルは必ず大きいのでレベル順に処理すればよい．
+  for (ymuint level = mKernel.level(root_id) + 1; level <= mMaxLevel; ++ level) {
+    vector<ymuint32>& queue = mQueueArray[level];
+    for (ymuint i = 0; i < queue.size(); ++ i) {
+      ymuint id = queue[i];
+      mMarkArray[id] = 0;
+      // すでに検出済みのビットはマスクしておく
+      PackedValW val = mKernel.calc_val(id, fval);
+      PackedValW diff = (gval[id] ^ val) & ~obs;
+      if ( diff.is_zero() ) {
+	continue;
+      }
+      fval[id] = gval[id] ^ diff;
+      mClearList.push_back(id);
+      if ( mKernel.is_output(id) ) {
+	obs |= diff;
+      }
+      else {
+	put_fanouts(id);
+      }
+    }
+    queue.clear();
+  }
+  mMaxLevel = 0;
+
+  // 値の変わったノードを元にもどしておく
+  for (vector<ymuint32>::iterator p = mClearList.begin();
+       p != mClearList.end(); ++ p) {
+    ymuint id = *p;
+    fval[id] = gval[id];
+  }
+  mClearList.clear();
+
+  return obs;
+}
+
+// @brief ファンアウトをキューに積む．
+// @param[in] id ノード番号
+void
+FaultProp::put_fanouts(ymuint id)
+{
+  ymuint no = mKernel.fanout_num(id);
+  const ymuint32* fo_list = mKernel.fanout_list(id);
+  for (ymuint i = 0; i < no; ++ i) {
+    ymuint oid = fo_list[i];
+    if ( mMarkArray[oid] ) {
+      continue;
+    }
+    mMarkArray[oid] = 1;
+    ymuint level = mKernel.level(oid);
+    mQueueArray[level].push_back(oid);
+    if ( mMaxLevel < level ) {
+      mMaxLevel = level;
+    }
+  }
+}
+
+END_NAMESPACE_YM_SATPG_FSIM2
@@ -0,0 +1,98 @@
+﻿#ifndef FSIM2_FAULTPROP_H
+#define FSIM2_FAULTPROP_H
+
+/// @file FaultProp.h
+/// @brief FaultProp のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "fsim2_nsdef.h"
+#include "PackedValW.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG_FSIM2
+
+class GvalKernel;
+
+//////////////////////////////////////////////////////////////////////
+/// @class FaultProp FaultProp.h "FaultProp.h"
+/// @brief FFR の根からの故障伝搬を行うクラス
+///
+/// 回路構造と正常値は GvalKernel のものを参照し，故障値と
+/// イベントキューは自前で持つ．
+/// そのため，スレッドごとにこのクラスのオブジェクトを用意すれば
+/// 同時に複数の故障伝搬を行うことができる．
+//////////////////////////////////////////////////////////////////////
+class FaultProp
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] kernel 回路構造と正常値を持つカーネル
+  ///
+  /// kernel は初期化済みでなければならない．
+  FaultProp(const GvalKernel& kernel);
+
+  /// @brief デストラクタ
+  ~FaultProp();
+
+
+public:
+
+  /// @brief 故障値を正常値に揃える．
+  ///
+  /// 正常値の計算後，simulate() の前に呼ぶ必要がある．
+  void
+  init_fval();
+
+  /// @brief 故障伝搬を行う．
+  /// @param[in] root_id 故障値を設定するノード番号
+  /// @param[in] root_fval root_id の故障値
+  /// @return 外部出力で観測されたビットを返す．
+  PackedValW
+  simulate(ymuint root_id,
+	   const PackedValW& root_fval);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief ファンアウトをキューに積む．
+  /// @param[in] id ノード番号
+  void
+  put_fanouts(ymuint id);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 回路構造と正常値を持つカーネル
+  const GvalKernel& mKernel;
+
+  // 故障値の配列(ID番号順)
+  vector<PackedValW> mFvalArray;
+
+  // レベルごとのイベントキュー
+  vector<vector<ymuint32> > mQueueArray;
+
+  // キューに積まれている印(ID番号順)
+  vector<ymuint8> mMarkArray;
+
+  // キューに積まれているノードの最大レベル
+  ymuint mMaxLevel;
+
+  // 値を元に戻す必要のあるノード番号のリスト
+  vector<ymuint32> mClearList;
+
+};
+
+END_NAMESPACE_YM_SATPG_FSIM2
+
+#endif // FSIM2_FAULTPROP_H
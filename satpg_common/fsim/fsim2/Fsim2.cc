@@ -13,12 +13,15 @@
 #include "TpgNode.h"
 #include "TpgFault.h"
 #include "TestVector.h"
+#include "TvStore.h"
 #include "NodeValList.h"
 #include "DetectOp.h"
 #include "SimNode.h"
 #include "SimFFR.h"
+#include "FaultProp.h"
 #include "ym/HashSet.h"
 #include "ym/StopWatch.h"
+#include <thread>
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -36,6 +39,9 @@ BEGIN_NAMESPACE_YM_SATPG_FSIM2
 
 BEGIN_NONAMESPACE
 
+// 並列版の ppsfp で1つのスレッドが一度に取り出す FFR 数
+const ymuint kFFRChunkSize = 64;
+
 void
 clear_lobs(SimNode* node)
 {
@@ -45,6 +51,23 @@ clear_lobs(SimNode* node)
   }
 }
 
+// パタン数に応じた op を呼び出す．
+inline
+void
+invoke_op(FsimOp& op,
+	  const TpgFault* f,
+	  const PackedValW& dpat,
+	  ymuint nb)
+{
+  if ( nb <= kPvBitLen ) {
+    // 残りのワードは 0 番めのパタンの複製なので先頭のワードだけでよい．
+    op(f, dpat.word(0));
+  }
+  else {
+    op(f, dpat);
+  }
+}
+
 END_NONAMESPACE
 
 
@@ -53,7 +76,9 @@ END_NONAMESPACE
 //////////////////////////////////////////////////////////////////////
 
 // @brief コンストラクタ
-Fsim2::Fsim2()
+Fsim2::Fsim2() :
+  mThreadNum(1),
+  mNextChunk(0)
 {
 }
 
@@ -70,6 +95,8 @@ Fsim2::set_network(const TpgNetwork& network)
 {
   clear();
 
+  clear_sync();
+
   mNetwork = &network;
 
   ymuint nn = mNetwork->node_num();
@@ -147,6 +174,23 @@ Fsim2::set_network(const TpgNetwork& network)
     }
   }
 
+  // 正常値計算用のカーネルを作る．
+  mKernel.init(mNodeArray, mLogicArray);
+
+  // 擬似外部出力から擬似外部入力への対応表を作る．
+  {
+    ymuint npi1 = mNetwork->input_num();
+    ymuint npo1 = mNetwork->output_num();
+    ymuint nff = mNetwork->dff_num();
+    mPpiMap.clear();
+    mPpiMap.resize(node_num, nullptr);
+    for (ymuint i = 0; i < nff; ++ i) {
+      SimNode* onode = mOutputArray[i + npo1];
+      SimNode* inode = mInputArray[i + npi1];
+      mPpiMap[onode->id()] = inode;
+    }
+  }
+
   // FFR の設定
   ymuint ffr_num = 0;
   for (ymuint i = node_num; i > 0; ) {
@@ -176,6 +220,14 @@ Fsim2::set_network(const TpgNetwork& network)
   // 消去用の配列の大きさはノード数を越えない．
   mClearArray.reserve(mNodeArray.size());
 
+  mWsaVal1.clear();
+  mWsaVal1.resize(node_num, kPvwAll0);
+  mWsaVal2.clear();
+  mWsaVal2.resize(node_num, kPvwAll0);
+  mWsaUndoList.clear();
+  mWsaMark.clear();
+  mWsaMark.resize(node_num, false);
+
   // 最大レベルを求め，イベントキューを初期化する．
   ymuint max_level = 0;
   for (ymuint i = 0; i < no; ++ i) {
@@ -218,19 +270,40 @@ Fsim2::set_network(const TpgNetwork& network)
   }
 }
 
+// @brief ppsfp() で用いるスレッド数を設定する．
+// @param[in] num スレッド数(0 の場合はハードウェアの並列度)
+void
+Fsim2::set_thread_num(ymuint num)
+{
+  if ( num == 0 ) {
+    num = std::thread::hardware_concurrency();
+    if ( num == 0 ) {
+      num = 1;
+    }
+  }
+  mThreadNum = num;
+}
+
 // @brief 故障にスキップマークをつける．
 void
-Fsim2::set_skip(const TpgFault* f)
+Fsim2::_set_skip(const TpgFault* f)
 {
   mFaultArray[f->id()]->mSkip = true;
 }
 
+// @brief 故障リストに含まれる故障のスキップマークを消す．
+void
+Fsim2::_clear_skip(const TpgFault* f)
+{
+  mFaultArray[f->id()]->mSkip = false;
+}
+
 // @brief 故障リストを設定する．
 // @param[in] fault_list 対象の故障リスト
 //
 // スキップマークは消される．
 void
-Fsim2::set_faults(const vector<const TpgFault*>& fault_list)
+Fsim2::_set_faults(const vector<const TpgFault*>& fault_list)
 {
   HashSet<ymuint> fault_set;
   for (ymuint i = 0; i < fault_list.size(); ++ i) {
@@ -269,7 +342,7 @@ Fsim2::sppfp(TestVector* tv,
   // tv を全ビットにセットしていく．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    PackedVal val = (tv->val3(i) == kVal1) ? kPvAll1 : kPvAll0;
+    PackedValW val = (tv->val3(i) == kVal1) ? kPvwAll1 : kPvwAll0;
     simnode->set_gval(val);
   }
 
@@ -288,7 +361,7 @@ Fsim2::sppfp(const NodeValList& assign_list,
   // デフォルトで 0 にする．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    simnode->set_gval(kPvAll0);
+    simnode->set_gval(kPvwAll0);
   }
 
   ymuint n = assign_list.size();
@@ -296,7 +369,7 @@ Fsim2::sppfp(const NodeValList& assign_list,
     NodeVal nv = assign_list[i];
     if ( nv.val() ) {
       SimNode* simnode = mInputArray[nv.node()->input_id()];
-      simnode->set_gval(kPvAll1);
+      simnode->set_gval(kPvwAll1);
     }
   }
 
@@ -309,14 +382,10 @@ void
 Fsim2::_sppfp(FsimOp& op)
 {
   // 正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval2();
-  }
+  mKernel.calc_gval();
 
   ymuint bitpos = 0;
-  SimFFR* ffr_buff[kPvBitLen];
+  SimFFR* ffr_buff[kPvwBitLen];
   // FFR ごとに処理を行う．
   for (vector<SimFFR>::iterator p = mFFRArray.begin();
        p != mFFRArray.end(); ++ p) {
@@ -327,10 +396,10 @@ Fsim2::_sppfp(FsimOp& op)
     // 結果は SimFault.mObsMask に保存される．
     // FFR 内の全ての obs マスクを ffr_req に入れる．
     // 検出済みの故障は ffr->fault_list() から取り除かれる．
-    PackedVal ffr_req = ffr_simulate(ffr);
+    PackedValW ffr_req = ffr_simulate(ffr);
 
     // ffr_req が 0 ならその後のシミュレーションを行う必要はない．
-    if ( ffr_req == kPvAll0 ) {
+    if ( ffr_req == kPvwAll0 ) {
       continue;
     }
 
@@ -342,8 +411,9 @@ Fsim2::_sppfp(FsimOp& op)
     }
 
     // キューに積んでおく
-    PackedVal bitmask = 1UL << bitpos;
-    PackedVal pat = root->gval() ^ bitmask;
+    PackedValW bitmask = kPvwAll0;
+    bitmask.set_bit(bitpos);
+    PackedValW pat = root->gval() ^ bitmask;
     root->set_fval(pat);
     root->set_fmask(~bitmask);
 
@@ -355,10 +425,10 @@ Fsim2::_sppfp(FsimOp& op)
     ffr_buff[bitpos] = ffr;
 
     ++ bitpos;
-    if ( bitpos == kPvBitLen ) {
-      PackedVal obs = eventq_simulate();
-      for (ymuint i = 0; i < kPvBitLen; ++ i, obs >>= 1) {
-	if ( obs & 1UL ) {
+    if ( bitpos == kPvwBitLen ) {
+      PackedValW obs = eventq_simulate();
+      for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+	if ( obs.check_bit(i) ) {
 	  fault_sweep(ffr_buff[i], op);
 	}
       }
@@ -366,9 +436,9 @@ Fsim2::_sppfp(FsimOp& op)
     }
   }
   if ( bitpos > 0 ) {
-    PackedVal obs = eventq_simulate();
-    for (ymuint i = 0; i < bitpos; ++ i, obs >>= 1) {
-      if ( obs & 1UL ) {
+    PackedValW obs = eventq_simulate();
+    for (ymuint i = 0; i < bitpos; ++ i) {
+      if ( obs.check_bit(i) ) {
 	fault_sweep(ffr_buff[i], op);
       }
     }
@@ -382,33 +452,104 @@ void
 Fsim2::ppsfp(const vector<TestVector*>& tv_array,
 	     FsimOp& op)
 {
-  ymuint npi = mNetwork->input_num2();
   ymuint nb = tv_array.size();
 
   // tv_array を入力ごとに固めてセットしていく．
-  for (ymuint i = 0; i < npi; ++ i) {
-    PackedVal val = kPvAll0;
-    PackedVal bit = 1UL;
-    for (ymuint j = 0; j < nb; ++ j, bit <<= 1) {
-      if ( tv_array[j]->val3(i) == kVal1 ) {
-	val |= bit;
+  set_tv_array(tv_array);
+
+  _ppsfp(nb, op);
+}
+
+// @brief 複数のパタンで故障シミュレーションを行う．
+// @param[in] assign_list_array 値の割当リストの配列
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+Fsim2::ppsfp(const vector<NodeValList>& assign_list_array,
+	     FsimOp& op)
+{
+  ymuint npi = mNetwork->input_num2();
+  ymuint nb = assign_list_array.size();
+
+  ASSERT_COND( nb > 0 && nb <= kPvwBitLen );
+
+  // 割当のない入力の値は 0 にしておく．
+  vector<PackedValW> val_array(npi, kPvwAll0);
+  for (ymuint j = 0; j < nb; ++ j) {
+    const NodeValList& assign_list = assign_list_array[j];
+    ymuint n = assign_list.size();
+    for (ymuint i = 0; i < n; ++ i) {
+      NodeVal nv = assign_list[i];
+      if ( nv.val() ) {
+	val_array[nv.node()->input_id()].set_bit(j);
       }
     }
-    // 残ったビットには 0 番めのパタンを詰めておく．
-    if ( tv_array[0]->val3(i) == kVal1 ) {
-      for (ymuint j = nb; j < kPvBitLen; ++ j, bit <<= 1) {
-	val |= bit;
-      }
+  }
+
+  // 残ったビットには 0 番めのパタンを詰めておく．
+  PackedValW rest_mask = kPvwAll0;
+  {
+    ymuint wpos = nb / kPvBitLen;
+    ymuint bpos = nb % kPvBitLen;
+    if ( bpos > 0 ) {
+      rest_mask.set_word(wpos, kPvAll1 << bpos);
+      ++ wpos;
+    }
+    for ( ; wpos < kPvwWordNum; ++ wpos) {
+      rest_mask.set_word(wpos, kPvAll1);
+    }
+  }
+  const NodeValList& assign_list0 = assign_list_array[0];
+  ymuint n0 = assign_list0.size();
+  for (ymuint i = 0; i < n0; ++ i) {
+    NodeVal nv = assign_list0[i];
+    if ( nv.val() ) {
+      val_array[nv.node()->input_id()] |= rest_mask;
     }
+  }
+
+  for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    simnode->set_gval(val);
+    simnode->set_gval(val_array[i]);
   }
 
+  _ppsfp(nb, op);
+}
+
+// @brief 複数のパタンで故障シミュレーションを行う．
+// @param[in] tv_store テストベクタを保持するオブジェクト
+// @param[in] blk ブロック番号
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+Fsim2::ppsfp(const TvStore& tv_store,
+	     ymuint blk,
+	     FsimOp& op)
+{
+  ymuint npi = mNetwork->input_num2();
+  ASSERT_COND( tv_store.input_num() == npi );
+
+  // ブロック内の値をそのまま外部入力にセットする．
+  // X は 0 として扱う．
+  for (ymuint i = 0; i < npi; ++ i) {
+    mInputArray[i]->set_gval(tv_store.val1(blk, i));
+  }
+
+  _ppsfp(tv_store.block_size(blk), op);
+}
+
+// @brief PPSFP故障シミュレーションの本体
+// @param[in] nb パタン数
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+Fsim2::_ppsfp(ymuint nb,
+	      FsimOp& op)
+{
   // 正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval2();
+  mKernel.calc_gval();
+
+  if ( mThreadNum > 1 && mFFRArray.size() > kFFRChunkSize ) {
+    // FFR を複数のスレッドで分担する．
+    _ppsfp_mt(nb, op);
+    return;
   }
 
   // FFR ごとに処理を行う．
@@ -421,21 +562,21 @@ Fsim2::ppsfp(const vector<TestVector*>& tv_array,
     // 結果は SimFault.mObsMask に保存される．
     // FFR 内の全ての obs マスクを ffr_req に入れる．
     // 検出済みの故障は ffr->fault_list() から取り除かれる．
-    PackedVal ffr_req = ffr_simulate(ffr);
+    PackedValW ffr_req = ffr_simulate(ffr);
 
     // ffr_req が 0 ならその後のシミュレーションを行う必要はない．
-    if ( ffr_req == kPvAll0 ) {
+    if ( ffr_req == kPvwAll0 ) {
       continue;
     }
 
     // FFR の出力の故障伝搬を行う．
     SimNode* root = ffr->root();
-    PackedVal obs = kPvAll0;
+    PackedValW obs = kPvwAll0;
     if ( root->is_output() ) {
-      obs = kPvAll1;
+      obs = kPvwAll1;
     }
     else {
-      PackedVal pat = root->gval() ^ ffr_req;
+      PackedValW pat = root->gval() ^ ffr_req;
       root->set_fval(pat);
       mClearArray.clear();
       mClearArray.push_back(root);
@@ -455,10 +596,119 @@ Fsim2::ppsfp(const vector<TestVector*>& tv_array,
       if ( ff->mSkip ) {
 	continue;
       }
-      PackedVal dpat = obs & ff->mObsMask;
-      if ( dpat ) {
-	const TpgFault* f = ff->mOrigF;
-	op(f, dpat);
+      PackedValW dpat = obs & ff->mObsMask;
+      if ( dpat.is_zero() ) {
+	continue;
+      }
+      invoke_op(op, ff->mOrigF, dpat, nb);
+    }
+  }
+}
+
+// @brief ppsfp() の並列版の本体
+// @param[in] nb パタン数
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+//
+// 正常値は計算済みであると仮定している．
+// FFR 内の処理は FFR ごとに独立なのでそのまま並列に行い，
+// FFR の根からの故障伝搬はスレッドごとの FaultProp で行う．
+// op の呼び出しはすべてのスレッドの終了後に FFR の順番通りに行うので
+// スレッド数によらず結果は直列版と同一になる．
+void
+Fsim2::_ppsfp_mt(ymuint nb,
+		 FsimOp& op)
+{
+  // スレッドごとの作業領域を用意する．
+  if ( mPropArray.size() < mThreadNum ) {
+    ymuint n0 = mPropArray.size();
+    mPropArray.resize(mThreadNum);
+    for (ymuint i = n0; i < mThreadNum; ++ i) {
+      mPropArray[i] = new FaultProp(mKernel);
+    }
+  }
+
+  ymuint nffr = mFFRArray.size();
+  ymuint nchunk = (nffr + kFFRChunkSize - 1) / kFFRChunkSize;
+  mChunkArray.resize(nchunk);
+  mNextChunk = 0;
+
+  ymuint nt = mThreadNum;
+  if ( nt > nchunk ) {
+    nt = nchunk;
+  }
+  vector<std::thread> thread_list;
+  thread_list.reserve(nt);
+  for (ymuint i = 0; i < nt; ++ i) {
+    thread_list.push_back(std::thread(&Fsim2::ppsfp_worker, this, mPropArray[i]));
+  }
+  for (ymuint i = 0; i < nt; ++ i) {
+    thread_list[i].join();
+  }
+
+  // 結果を FFR の順に反映させる．
+  for (ymuint c = 0; c < nchunk; ++ c) {
+    const vector<DetInfo>& det_list = mChunkArray[c];
+    for (vector<DetInfo>::const_iterator p = det_list.begin();
+	 p != det_list.end(); ++ p) {
+      invoke_op(op, p->mFault, p->mPat, nb);
+    }
+  }
+}
+
+// @brief _ppsfp_mt() のワーカースレッドの本体
+// @param[in] prop このスレッド用の故障伝搬オブジェクト
+void
+Fsim2::ppsfp_worker(FaultProp* prop)
+{
+  prop->init_fval();
+
+  ymuint nffr = mFFRArray.size();
+  ymuint nchunk = mChunkArray.size();
+  for ( ; ; ) {
+    ymuint c = mNextChunk ++;
+    if ( c >= nchunk ) {
+      break;
+    }
+
+    vector<DetInfo>& det_list = mChunkArray[c];
+    det_list.clear();
+
+    ymuint end = (c + 1) * kFFRChunkSize;
+    if ( end > nffr ) {
+      end = nffr;
+    }
+    for (ymuint i = c * kFFRChunkSize; i < end; ++ i) {
+      SimFFR* ffr = &mFFRArray[i];
+      if ( ffr->fault_list().empty() ) continue;
+
+      // FFR 内の故障伝搬を行う．
+      PackedValW ffr_req = ffr_simulate(ffr);
+      if ( ffr_req == kPvwAll0 ) {
+	continue;
+      }
+
+      // FFR の出力の故障伝搬を行う．
+      SimNode* root = ffr->root();
+      PackedValW obs = kPvwAll1;
+      if ( !root->is_output() ) {
+	obs = prop->simulate(root->id(), root->gval() ^ ffr_req);
+      }
+
+      const vector<SimFault*>& flist = ffr->fault_list();
+      for (vector<SimFault*>::const_iterator p = flist.begin();
+	   p != flist.end(); ++ p) {
+	SimFault* ff = *p;
+	if ( ff->mSkip ) {
+	  continue;
+	}
+	PackedValW dpat = obs & ff->mObsMask;
+	if ( dpat.is_zero() ) {
+	  continue;
+	}
+	DetInfo det;
+	det.mFault = ff->mOrigF;
+	det.mPat = dpat;
+	det_list.push_back(det);
       }
     }
   }
@@ -478,7 +728,7 @@ Fsim2::spsfp(TestVector* tv,
   // tv を全ビットにセットしていく．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    PackedVal val = (tv->val3(i) == kVal1) ? kPvAll1 : kPvAll0;
+    PackedValW val = (tv->val3(i) == kVal1) ? kPvwAll1 : kPvwAll0;
     simnode->set_gval(val);
   }
 
@@ -499,7 +749,7 @@ Fsim2::spsfp(const NodeValList& assign_list,
   // assign_list にないノードの値は 0 にしておく．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    simnode->set_gval(kPvAll0);
+    simnode->set_gval(kPvwAll0);
   }
 
   ymuint n = assign_list.size();
@@ -507,7 +757,7 @@ Fsim2::spsfp(const NodeValList& assign_list,
     NodeVal nv = assign_list[i];
     if ( nv.val() ) {
       SimNode* simnode = mInputArray[nv.node()->input_id()];
-      simnode->set_gval(kPvAll1);
+      simnode->set_gval(kPvwAll1);
     }
   }
 
@@ -522,14 +772,10 @@ bool
 Fsim2::_spsfp(const TpgFault* f)
 {
   // 正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval2();
-  }
+  mKernel.calc_gval();
 
   // FFR 内の故障伝搬を行う．
-  PackedVal lobs;
+  PackedValW lobs;
   if ( f->is_branch_fault() ) {
     SimNode* simnode = find_simnode(f->tpg_onode());
     ymuint ipos = f->tpg_pos();
@@ -543,20 +789,20 @@ Fsim2::_spsfp(const TpgFault* f)
   }
 
   SimNode* isimnode = find_simnode(f->tpg_inode());
-  PackedVal valdiff = isimnode->gval();
+  PackedValW valdiff = isimnode->gval();
   if ( f->val() == 1 ) {
     valdiff = ~valdiff;
   }
   lobs &= valdiff;
 
   // lobs が 0 ならその後のシミュレーションを行う必要はない．
-  if ( lobs == kPvAll0 ) {
+  if ( lobs == kPvwAll0 ) {
     return false;
   }
 
   SimNode* root = isimnode->ffr()->root();
   if ( root->is_output() ) {
-    return (lobs != kPvAll0);
+    return (lobs != kPvwAll0);
   }
 
   root->set_fval(~root->gval());
@@ -567,8 +813,8 @@ Fsim2::_spsfp(const TpgFault* f)
     mEventQ.put(root->fanout(i));
   }
 
-  PackedVal obs = eventq_simulate() & lobs;
-  return (obs != kPvAll0);
+  PackedValW obs = eventq_simulate() & lobs;
+  return (obs != kPvwAll0);
 }
 
 // @brief 現在保持している SimNode のネットワークを破棄する．
@@ -586,6 +832,16 @@ Fsim2::clear()
   mInputArray.clear();
   mOutputArray.clear();
   mLogicArray.clear();
+  mPpiMap.clear();
+
+  for (vector<FaultProp*>::iterator p = mPropArray.begin();
+       p != mPropArray.end(); ++ p) {
+    delete *p;
+  }
+  mPropArray.clear();
+  mChunkArray.clear();
+
+  mKernel.clear();
 
   mFFRArray.clear();
 
@@ -599,15 +855,20 @@ Fsim2::clear()
   mSimFaults.clear();
   mFaultArray.clear();
 
+  mWsaVal1.clear();
+  mWsaVal2.clear();
+  mWsaUndoList.clear();
+  mWsaMark.clear();
+
   // 念のため
   mNetwork = nullptr;
 }
 
 // @brief FFR 内の故障シミュレーションを行う．
-PackedVal
+PackedValW
 Fsim2::ffr_simulate(SimFFR* ffr)
 {
-  PackedVal ffr_req = kPvAll0;
+  PackedValW ffr_req = kPvwAll0;
   const vector<SimFault*>& flist = ffr->fault_list();
   for (vector<SimFault*>::const_iterator p = flist.begin();
        p != flist.end(); ++ p) {
@@ -618,8 +879,8 @@ Fsim2::ffr_simulate(SimFFR* ffr)
 
     // ff の故障伝搬を行う．
     SimNode* simnode = ff->mNode;
-    PackedVal lobs = simnode->calc_lobs();
-    PackedVal valdiff = ff->mInode->gval();
+    PackedValW lobs = simnode->calc_lobs();
+    PackedValW valdiff = ff->mInode->gval();
     const TpgFault* f = ff->mOrigF;
     if ( f->is_branch_fault() ) {
       // 入力の故障
@@ -648,18 +909,18 @@ Fsim2::ffr_simulate(SimFFR* ffr)
 }
 
 // @brief イベントキューを用いてシミュレーションを行う．
-PackedVal
+PackedValW
 Fsim2::eventq_simulate()
 {
   // どこかの外部出力で検出されたことを表すビット
-  PackedVal obs = kPvAll0;
+  PackedValW obs = kPvwAll0;
   for ( ; ; ) {
     SimNode* node = mEventQ.get();
     if ( node == nullptr ) break;
     // すでに検出済みのビットはマスクしておく
     // これは無駄なイベントの発生を抑える．
-    PackedVal diff = node->calc_fval2(~obs);
-    if ( diff != kPvAll0 ) {
+    PackedValW diff = node->calc_fval2(~obs);
+    if ( diff != kPvwAll0 ) {
       mClearArray.push_back(node);
       if ( node->is_output() ) {
 	obs |= diff;
@@ -690,7 +951,7 @@ Fsim2::fault_sweep(SimFFR* ffr,
   for (vector<SimFault*>::const_iterator p = flist.begin();
        p != flist.end(); ++ p) {
     SimFault* ff = *p;
-    if ( !ff->mSkip && ff->mObsMask != kPvAll0 ) {
+    if ( !ff->mSkip && ff->mObsMask != kPvwAll0 ) {
       const TpgFault* f = ff->mOrigF;
       op(f, kPvAll1);
     }
@@ -726,12 +987,283 @@ Fsim2::find_simnode(const TpgNode* node) const
   return mSimMap[node->id()];
 }
 
+// @brief tv_array の値を外部入力にセットする．
+// @param[in] tv_array テストベクタの配列
+//
+// 残ったビットには 0 番めのパタンを詰めておく．
+void
+Fsim2::set_tv_array(const vector<TestVector*>& tv_array)
+{
+  ymuint npi = mNetwork->input_num2();
+  ymuint nb = tv_array.size();
+
+  ASSERT_COND( nb > 0 && nb <= kPvwBitLen );
+
+  // tv_array を入力ごとのビット列に変換する．
+  // X は 0 として扱う．
+  vector<PackedValW> val_array(npi, kPvwAll0);
+  TestVector::transpose(tv_array, nullptr, val_array.data());
+  for (ymuint i = 0; i < npi; ++ i) {
+    SimNode* simnode = mInputArray[i];
+    simnode->set_gval(val_array[i]);
+  }
+}
+
 // @brief WSA を計算する．
 // @param[in] tv テストベクタ
 ymuint
 Fsim2::calc_wsa(TestVector* tv)
 {
-  return 0;
+  vector<TestVector*> tv_array(1, tv);
+  vector<ymuint> wsa_array;
+  calc_wsa(tv_array, wsa_array);
+  return wsa_array[0];
+}
+
+// @brief 複数のパタンの WSA を計算する．
+// @param[in] tv_array テストベクタの配列
+// @param[out] wsa_array 各パタンの WSA を格納する配列
+void
+Fsim2::calc_wsa(const vector<TestVector*>& tv_array,
+		vector<ymuint>& wsa_array)
+{
+  ymuint nb = tv_array.size();
+
+  // 1時刻目の正常値の計算を行う．
+  set_tv_array(tv_array);
+  mKernel.calc_gval();
+
+  // 1時刻目の値を保存しておく．
+  const PackedValW* gval_array = mKernel.gval_array();
+  vector<PackedValW> gval1_array(gval_array, gval_array + mKernel.node_num());
+
+  // 2時刻目のフリップフロップの値を設定する．
+  ymuint npi1 = mNetwork->input_num();
+  ymuint npo1 = mNetwork->output_num();
+  ymuint nff = mNetwork->dff_num();
+  for (ymuint i = 0; i < nff; ++ i) {
+    SimNode* onode = mOutputArray[i + npo1];
+    SimNode* inode = mInputArray[i + npi1];
+    inode->set_gval(onode->gval());
+  }
+
+  // 2時刻目の正常値の計算を行う．
+  mKernel.calc_gval();
+
+  // 値の変化したノードのファンアウト数を加える．
+  wsa_array.clear();
+  wsa_array.resize(nb, 0);
+  for (vector<SimNode*>::iterator q = mLogicArray.begin();
+       q != mLogicArray.end(); ++ q) {
+    SimNode* node = *q;
+    PackedValW toggle = gval1_array[node->id()] ^ node->gval();
+    add_wsa(toggle, node->nfo(), wsa_array);
+  }
+}
+
+// @brief 差分 WSA 計算用の状態を初期化する．
+// @param[in] tv 基準となるテストベクタ
+// @return tv の WSA を返す．
+//
+// 各時刻の値は故障シミュレーションで書き換えられないように
+// mWsaVal1, mWsaVal2 に保持しておく．
+ymuint
+Fsim2::init_wsa(TestVector* tv)
+{
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    mWsaMark[mWsaUndoList[i].mId] = false;
+  }
+  mWsaUndoList.clear();
+
+  // 1時刻目の正常値の計算を行う．
+  vector<TestVector*> tv_array(1, tv);
+  set_tv_array(tv_array);
+  mKernel.calc_gval();
+
+  ymuint nn = mKernel.node_num();
+  const PackedValW* gval_array = mKernel.gval_array();
+  mWsaVal1.assign(gval_array, gval_array + nn);
+
+  // 2時刻目のフリップフロップの値を設定する．
+  ymuint npi1 = mNetwork->input_num();
+  ymuint npo1 = mNetwork->output_num();
+  ymuint nff = mNetwork->dff_num();
+  for (ymuint i = 0; i < nff; ++ i) {
+    SimNode* onode = mOutputArray[i + npo1];
+    SimNode* inode = mInputArray[i + npi1];
+    inode->set_gval(onode->gval());
+  }
+
+  // 2時刻目の正常値の計算を行う．
+  mKernel.calc_gval();
+  mWsaVal2.assign(gval_array, gval_array + nn);
+
+  ymuint wsa = 0;
+  for (vector<SimNode*>::iterator q = mLogicArray.begin();
+       q != mLogicArray.end(); ++ q) {
+    SimNode* node = *q;
+    ymuint id = node->id();
+    if ( ((mWsaVal1[id] ^ mWsaVal2[id]).word(0) & 1UL) != kPvAll0 ) {
+      wsa += node->nfo();
+    }
+  }
+  return wsa;
+}
+
+// @brief 入力を反転させた時の WSA の差分を計算する．
+// @param[in] flip_list 反転させる入力番号のリスト
+// @return 現在の状態の WSA からの増分を返す．
+//
+// 1時刻目は反転させた入力から，2時刻目は反転させた外部入力と
+// 値の変化した擬似外部出力に対応する擬似外部入力から
+// イベントドリブンで値を計算し直す．
+// 全ビットに同じパタンが入っているので 0 ビットめだけを見ればよい．
+int
+Fsim2::delta_wsa(const vector<ymuint>& flip_list)
+{
+  ASSERT_COND( mWsaUndoList.empty() );
+
+  // 1時刻目の入力値を反転させる．
+  ymuint npi1 = mNetwork->input_num();
+  vector<SimNode*> pi_list;
+  for (ymuint i = 0; i < flip_list.size(); ++ i) {
+    SimNode* node = mInputArray[flip_list[i]];
+    ymuint id = node->id();
+    wsa_record(id);
+    mWsaVal1[id] = ~mWsaVal1[id];
+    ymuint no = node->nfo();
+    for (ymuint j = 0; j < no; ++ j) {
+      mEventQ.put(node->fanout(j));
+    }
+    if ( flip_list[i] < npi1 ) {
+      pi_list.push_back(node);
+    }
+  }
+
+  // 1時刻目の値の変化を伝搬させる．
+  vector<SimNode*> ppo_list;
+  for ( ; ; ) {
+    SimNode* node = mEventQ.get();
+    if ( node == nullptr ) {
+      break;
+    }
+    ymuint id = node->id();
+    PackedValW new_val = mKernel.calc_val(id, &mWsaVal1[0]);
+    if ( new_val != mWsaVal1[id] ) {
+      wsa_record(id);
+      mWsaVal1[id] = new_val;
+      ymuint no = node->nfo();
+      for (ymuint j = 0; j < no; ++ j) {
+	mEventQ.put(node->fanout(j));
+      }
+      if ( mPpiMap[id] != nullptr ) {
+	ppo_list.push_back(node);
+      }
+    }
+  }
+
+  // 2時刻目の外部入力は1時刻目の値を保持する．
+  for (ymuint i = 0; i < pi_list.size(); ++ i) {
+    SimNode* inode = pi_list[i];
+    ymuint id = inode->id();
+    mWsaVal2[id] = mWsaVal1[id];
+    ymuint no = inode->nfo();
+    for (ymuint j = 0; j < no; ++ j) {
+      mEventQ.put(inode->fanout(j));
+    }
+  }
+
+  // 2時刻目のフリップフロップの値を設定する．
+  for (ymuint i = 0; i < ppo_list.size(); ++ i) {
+    SimNode* onode = ppo_list[i];
+    SimNode* inode = mPpiMap[onode->id()];
+    ymuint id = inode->id();
+    wsa_record(id);
+    mWsaVal2[id] = mWsaVal1[onode->id()];
+    ymuint no = inode->nfo();
+    for (ymuint j = 0; j < no; ++ j) {
+      mEventQ.put(inode->fanout(j));
+    }
+  }
+
+  // 2時刻目の値の変化を伝搬させる．
+  for ( ; ; ) {
+    SimNode* node = mEventQ.get();
+    if ( node == nullptr ) {
+      break;
+    }
+    ymuint id = node->id();
+    PackedValW new_val = mKernel.calc_val(id, &mWsaVal2[0]);
+    if ( new_val != mWsaVal2[id] ) {
+      wsa_record(id);
+      mWsaVal2[id] = new_val;
+      ymuint no = node->nfo();
+      for (ymuint j = 0; j < no; ++ j) {
+	mEventQ.put(node->fanout(j));
+      }
+    }
+  }
+
+  // 値を変更した論理ノードについて WSA の増減を求める．
+  int delta = 0;
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    const WsaUndo& undo = mWsaUndoList[i];
+    ymuint id = undo.mId;
+    SimNode* node = mNodeArray[id];
+    if ( node->nfi() == 0 ) {
+      continue;
+    }
+    PackedVal old_toggle = (undo.mVal1 ^ undo.mVal2).word(0) & 1UL;
+    PackedVal new_toggle = (mWsaVal1[id] ^ mWsaVal2[id]).word(0) & 1UL;
+    if ( old_toggle != new_toggle ) {
+      if ( new_toggle ) {
+	delta += node->nfo();
+      }
+      else {
+	delta -= node->nfo();
+      }
+    }
+  }
+
+  return delta;
+}
+
+// @brief 直前の delta_wsa() の結果を確定させる．
+void
+Fsim2::commit_wsa()
+{
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    mWsaMark[mWsaUndoList[i].mId] = false;
+  }
+  mWsaUndoList.clear();
+}
+
+// @brief 直前の delta_wsa() の結果を取り消す．
+void
+Fsim2::rollback_wsa()
+{
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    const WsaUndo& undo = mWsaUndoList[i];
+    mWsaVal1[undo.mId] = undo.mVal1;
+    mWsaVal2[undo.mId] = undo.mVal2;
+    mWsaMark[undo.mId] = false;
+  }
+  mWsaUndoList.clear();
+}
+
+// @brief 差分 WSA 計算で値を変更する前のノードの値を記録する．
+// @param[in] id ノード番号
+void
+Fsim2::wsa_record(ymuint id)
+{
+  if ( !mWsaMark[id] ) {
+    mWsaMark[id] = true;
+    WsaUndo undo;
+    undo.mId = id;
+    undo.mVal1 = mWsaVal1[id];
+    undo.mVal2 = mWsaVal2[id];
+    mWsaUndoList.push_back(undo);
+  }
 }
 
 END_NAMESPACE_YM_SATPG_FSIM2
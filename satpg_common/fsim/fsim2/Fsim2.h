@@ -11,24 +11,27 @@
 
 
 #include "fsim2_nsdef.h"
-#include "Fsim.h"
-#include "PackedVal.h"
+#include "FsimBase.h"
+#include "PackedValW.h"
+#include "GvalKernel.h"
 #include "EventQ.h"
 #include "SimFault.h"
 #include "TpgNode.h"
+#include <atomic>
 
 
 BEGIN_NAMESPACE_YM_SATPG_FSIM2
 
 class SimFFR;
 class SimNode;
+class FaultProp;
 
 //////////////////////////////////////////////////////////////////////
 /// @class Fsim2 Fsim2.h "Fsim2.h"
 /// @brief 故障シミュレーションを行うモジュール
 //////////////////////////////////////////////////////////////////////
 class Fsim2 :
-  public Fsim
+  public FsimBase
 {
 public:
 
@@ -51,18 +54,11 @@ public:
   void
   set_network(const TpgNetwork& network);
 
-  /// @brief 故障にスキップマークをつける．
+  /// @brief ppsfp() で用いるスレッド数を設定する．
+  /// @param[in] num スレッド数(0 の場合はハードウェアの並列度)
   virtual
   void
-  set_skip(const TpgFault* f);
-
-  /// @brief 故障リストを設定する．
-  /// @param[in] fault_list 対象の故障リスト
-  ///
-  /// スキップマークは消される．
-  virtual
-  void
-  set_faults(const vector<const TpgFault*>& fault_list);
+  set_thread_num(ymuint num);
 
   /// @brief SPSFP故障シミュレーションを行う．
   /// @param[in] tv テストベクタ
@@ -108,18 +104,97 @@ public:
   ppsfp(const vector<TestVector*>& tv_array,
 	FsimOp& op);
 
+  /// @brief 複数のパタンで故障シミュレーションを行う．
+  /// @param[in] assign_list_array 値の割当リストの配列
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  virtual
+  void
+  ppsfp(const vector<NodeValList>& assign_list_array,
+	FsimOp& op);
+
+  /// @brief 複数のパタンで故障シミュレーションを行う．
+  /// @param[in] tv_store テストベクタを保持するオブジェクト
+  /// @param[in] blk ブロック番号
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  virtual
+  void
+  ppsfp(const TvStore& tv_store,
+	ymuint blk,
+	FsimOp& op);
+
   /// @brief WSA を計算する．
   /// @param[in] tv テストベクタ
   virtual
   ymuint
   calc_wsa(TestVector* tv);
 
+  /// @brief 複数のパタンの WSA を計算する．
+  /// @param[in] tv_array テストベクタの配列
+  /// @param[out] wsa_array 各パタンの WSA を格納する配列
+  virtual
+  void
+  calc_wsa(const vector<TestVector*>& tv_array,
+	   vector<ymuint>& wsa_array);
+
+  /// @brief 差分 WSA 計算用の状態を初期化する．
+  /// @param[in] tv 基準となるテストベクタ
+  /// @return tv の WSA を返す．
+  virtual
+  ymuint
+  init_wsa(TestVector* tv);
+
+  /// @brief 入力を反転させた時の WSA の差分を計算する．
+  /// @param[in] flip_list 反転させる入力番号のリスト
+  /// @return 現在の状態の WSA からの増分を返す．
+  virtual
+  int
+  delta_wsa(const vector<ymuint>& flip_list);
+
+  /// @brief 直前の delta_wsa() の結果を確定させる．
+  virtual
+  void
+  commit_wsa();
+
+  /// @brief 直前の delta_wsa() の結果を取り消す．
+  virtual
+  void
+  rollback_wsa();
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // FsimBase の仮想関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 故障リストを設定する．
+  /// @param[in] fault_list 対象の故障リスト
+  ///
+  /// スキップマークは消される．
+  virtual
+  void
+  _set_faults(const vector<const TpgFault*>& fault_list);
+
+  /// @brief 故障にスキップマークをつける．
+  virtual
+  void
+  _set_skip(const TpgFault* f);
+
+  /// @brief 故障リストに含まれる故障のスキップマークを消す．
+  virtual
+  void
+  _clear_skip(const TpgFault* f);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
   // 内部で用いられる下請け関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief tv_array の値を外部入力にセットする．
+  /// @param[in] tv_array テストベクタの配列
+  void
+  set_tv_array(const vector<TestVector*>& tv_array);
+
   /// @brief SPSFP故障シミュレーションの本体
   /// @param[in] f 対象の故障
   /// @retval true 故障の検出が行えた．
@@ -132,12 +207,31 @@ private:
   void
   _sppfp(FsimOp& op);
 
+  /// @brief PPSFP故障シミュレーションの本体
+  /// @param[in] nb パタン数
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  void
+  _ppsfp(ymuint nb,
+	 FsimOp& op);
+
+  /// @brief ppsfp() の並列版の本体
+  /// @param[in] nb パタン数
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  void
+  _ppsfp_mt(ymuint nb,
+	    FsimOp& op);
+
+  /// @brief _ppsfp_mt() のワーカースレッドの本体
+  /// @param[in] prop このスレッド用の故障伝搬オブジェクト
+  void
+  ppsfp_worker(FaultProp* prop);
+
   /// @brief FFR 内の故障シミュレーションを行う．
-  PackedVal
+  PackedValW
   ffr_simulate(SimFFR* ffr);
 
   /// @brief イベントキューを用いてシミュレーションを行う．
-  PackedVal
+  PackedValW
   eventq_simulate();
 
   /// @brief ffr 内の故障が検出可能か調べる．
@@ -145,6 +239,13 @@ private:
   fault_sweep(SimFFR* ffr,
 	      FsimOp& op);
 
+  /// @brief 差分 WSA 計算で値を変更する前のノードの値を記録する．
+  /// @param[in] id ノード番号
+  ///
+  /// 記録されるのは最初に呼ばれた時の値だけ．
+  void
+  wsa_record(ymuint id);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -170,6 +271,35 @@ private:
 	    const vector<SimNode*>& inputs);
 
 
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // 並列版の ppsfp で検出された故障とパタン
+  struct DetInfo
+  {
+    // 故障
+    const TpgFault* mFault;
+
+    // 検出したパタンを表すビットベクタ
+    PackedValW mPat;
+  };
+
+  // 差分 WSA 計算で値を変更したノードの元の値
+  struct WsaUndo
+  {
+    // ノード番号
+    ymuint mId;
+
+    // 1時刻目の値
+    PackedValW mVal1;
+
+    // 2時刻目の値
+    PackedValW mVal2;
+  };
+
+
 private:
   //////////////////////////////////////////////////////////////////////
   // データメンバ
@@ -193,9 +323,16 @@ private:
   // 入力からのトポロジカル順に並べた logic ノードの配列
   vector<SimNode*> mLogicArray;
 
+  // 擬似外部出力の ID 番号をキーにして対応する擬似外部入力を入れる配列
+  // それ以外のノードの場合は nullptr
+  vector<SimNode*> mPpiMap;
+
   // FFR を納めた配列
   vector<SimFFR> mFFRArray;
 
+  // 正常値計算用のカーネル
+  GvalKernel mKernel;
+
   // イベントキュー
   EventQ mEventQ;
 
@@ -208,6 +345,31 @@ private:
   // TpgFault::id() をキーとして SimFault を格納する配列
   vector<SimFault*> mFaultArray;
 
+  // ppsfp() で用いるスレッド数
+  ymuint mThreadNum;
+
+  // スレッドごとの故障伝搬オブジェクト
+  vector<FaultProp*> mPropArray;
+
+  // FFR のまとまりごとの検出結果
+  vector<vector<DetInfo> > mChunkArray;
+
+  // 次に取り出す FFR のまとまりの番号
+  std::atomic<ymuint> mNextChunk;
+
+  // 差分 WSA 計算用の1時刻目の値の配列(ID番号順)
+  // 故障シミュレーションとは別に保持する．
+  vector<PackedValW> mWsaVal1;
+
+  // 差分 WSA 計算用の2時刻目の値の配列(ID番号順)
+  vector<PackedValW> mWsaVal2;
+
+  // 直前の delta_wsa() で値を変更したノードのリスト
+  vector<WsaUndo> mWsaUndoList;
+
+  // mWsaUndoList に含まれているノードの印(ID番号をキーにする)
+  vector<bool> mWsaMark;
+
 };
 
 END_NAMESPACE_YM_SATPG_FSIM2
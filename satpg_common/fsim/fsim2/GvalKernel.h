@@ -0,0 +1,322 @@
+﻿#ifndef FSIM2_GVALKERNEL_H
+#define FSIM2_GVALKERNEL_H
+
+/// @file GvalKernel.h
+/// @brief GvalKernel のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "fsim2_nsdef.h"
+#include "PackedValW.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG_FSIM2
+
+class SimNode;
+
+//////////////////////////////////////////////////////////////////////
+/// @class GvalKernel GvalKernel.h "GvalKernel.h"
+/// @brief 正常値計算用の平坦化されたシミュレーションカーネル
+///
+/// 論理ノードをトポロジカル順に並べ，ゲートの種類とファンインの
+/// 番号を連続した配列に持つ．
+/// 各ノードの正常値と故障値もノード番号順の配列に保持し，
+/// SimNode はその要素へのポインタを通してアクセスする．
+/// 正常値の計算は仮想関数やポインタをたどらずに行える．
+/// また，ファンアウトとレベルの情報も持っているので，
+/// SimNode を用いずに故障値の計算を行うこともできる(FaultProp を参照)．
+//////////////////////////////////////////////////////////////////////
+class GvalKernel
+{
+public:
+
+  /// @brief コンストラクタ
+  GvalKernel();
+
+  /// @brief デストラクタ
+  ~GvalKernel();
+
+
+public:
+
+  /// @brief 初期化する．
+  /// @param[in] node_array 全ての SimNode の配列(ID番号順)
+  /// @param[in] logic_array 論理ノードの配列(トポロジカル順)
+  ///
+  /// 各 SimNode に値の格納場所を設定する．
+  /// SimNode のファンアウトリストは設定済みでなければならない．
+  void
+  init(const vector<SimNode*>& node_array,
+       const vector<SimNode*>& logic_array);
+
+  /// @brief 内容をクリアする．
+  void
+  clear();
+
+  /// @brief 全ての論理ノードの正常値を計算する．
+  ///
+  /// 外部入力の値はあらかじめ設定されている必要がある．
+  /// 計算後，全ノードの故障値は正常値と等しくなる．
+  void
+  calc_gval();
+
+  /// @brief ノード数を返す．
+  ymuint
+  node_num() const;
+
+  /// @brief 最大レベルを返す．
+  ymuint
+  max_level() const;
+
+  /// @brief ノードのレベルを返す．
+  /// @param[in] id ノード番号
+  ymuint
+  level(ymuint id) const;
+
+  /// @brief 出力ノードの時 true を返す．
+  /// @param[in] id ノード番号
+  bool
+  is_output(ymuint id) const;
+
+  /// @brief ファンアウト数を返す．
+  /// @param[in] id ノード番号
+  ymuint
+  fanout_num(ymuint id) const;
+
+  /// @brief ファンアウトのノード番号の配列を返す．
+  /// @param[in] id ノード番号
+  const ymuint32*
+  fanout_list(ymuint id) const;
+
+  /// @brief 正常値の配列を返す．
+  const PackedValW*
+  gval_array() const;
+
+  /// @brief 与えられた値の配列を用いて論理ノードの値を計算する．
+  /// @param[in] id ノード番号
+  /// @param[in] val_array 値の配列(ID番号順)
+  PackedValW
+  calc_val(ymuint id,
+	   const PackedValW* val_array) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // ゲートの種類を表す列挙型
+  enum OpType {
+    kOpBuff,
+    kOpNot,
+    kOpAnd,
+    kOpNand,
+    kOpOr,
+    kOpNor,
+    kOpXor,
+    kOpXnor
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief pos 番めの論理ノードの値を計算する．
+  /// @param[in] pos 論理ノードの位置(トポロジカル順)
+  /// @param[in] val_array 値の配列(ID番号順)
+  PackedValW
+  eval(ymuint pos,
+       const PackedValW* val_array) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 論理ノードのゲートの種類の配列
+  vector<ymuint8> mTypeArray;
+
+  // 論理ノードのID番号の配列
+  vector<ymuint32> mIdArray;
+
+  // mFaninArray 中の各ノードのファンインの開始位置
+  // 要素数は論理ノード数 + 1
+  vector<ymuint32> mFaninPos;
+
+  // 全論理ノードのファンインのID番号を並べた配列
+  vector<ymuint32> mFaninArray;
+
+  // ID番号をキーにして論理ノードの位置を入れる配列
+  // 外部入力の場合は意味を持たない．
+  vector<ymuint32> mPosArray;
+
+  // レベルの配列(ID番号順)
+  vector<ymuint32> mLevelArray;
+
+  // 出力の印の配列(ID番号順)
+  vector<ymuint8> mOutputArray;
+
+  // mFanoutArray 中の各ノードのファンアウトの開始位置
+  // 要素数はノード数 + 1
+  vector<ymuint32> mFanoutPos;
+
+  // 全ノードのファンアウトのID番号を並べた配列
+  vector<ymuint32> mFanoutArray;
+
+  // 最大レベル
+  ymuint mMaxLevel;
+
+  // 正常値の配列(ID番号順)
+  vector<PackedValW> mGvalArray;
+
+  // 故障値の配列(ID番号順)
+  vector<PackedValW> mFvalArray;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief ノード数を返す．
+inline
+ymuint
+GvalKernel::node_num() const
+{
+  return mLevelArray.size();
+}
+
+// @brief 最大レベルを返す．
+inline
+ymuint
+GvalKernel::max_level() const
+{
+  return mMaxLevel;
+}
+
+// @brief ノードのレベルを返す．
+// @param[in] id ノード番号
+inline
+ymuint
+GvalKernel::level(ymuint id) const
+{
+  return mLevelArray[id];
+}
+
+// @brief 出力ノードの時 true を返す．
+// @param[in] id ノード番号
+inline
+bool
+GvalKernel::is_output(ymuint id) const
+{
+  return mOutputArray[id] != 0;
+}
+
+// @brief ファンアウト数を返す．
+// @param[in] id ノード番号
+inline
+ymuint
+GvalKernel::fanout_num(ymuint id) const
+{
+  return mFanoutPos[id + 1] - mFanoutPos[id];
+}
+
+// @brief ファンアウトのノード番号の配列を返す．
+// @param[in] id ノード番号
+inline
+const ymuint32*
+GvalKernel::fanout_list(ymuint id) const
+{
+  return mFanoutArray.data() + mFanoutPos[id];
+}
+
+// @brief 正常値の配列を返す．
+inline
+const PackedValW*
+GvalKernel::gval_array() const
+{
+  return mGvalArray.data();
+}
+
+// @brief 与えられた値の配列を用いて論理ノードの値を計算する．
+// @param[in] id ノード番号
+// @param[in] val_array 値の配列(ID番号順)
+inline
+PackedValW
+GvalKernel::calc_val(ymuint id,
+		     const PackedValW* val_array) const
+{
+  return eval(mPosArray[id], val_array);
+}
+
+// @brief pos 番めの論理ノードの値を計算する．
+// @param[in] pos 論理ノードの位置(トポロジカル順)
+// @param[in] val_array 値の配列(ID番号順)
+inline
+PackedValW
+GvalKernel::eval(ymuint pos,
+		 const PackedValW* val_array) const
+{
+  const ymuint32* fanins = mFaninArray.data() + mFaninPos[pos];
+  ymuint ni = mFaninPos[pos + 1] - mFaninPos[pos];
+  PackedValW val = val_array[fanins[0]];
+  switch ( mTypeArray[pos] ) {
+  case kOpBuff:
+    break;
+
+  case kOpNot:
+    val = ~val;
+    break;
+
+  case kOpAnd:
+    for (ymuint j = 1; j < ni; ++ j) {
+      val &= val_array[fanins[j]];
+    }
+    break;
+
+  case kOpNand:
+    for (ymuint j = 1; j < ni; ++ j) {
+      val &= val_array[fanins[j]];
+    }
+    val = ~val;
+    break;
+
+  case kOpOr:
+    for (ymuint j = 1; j < ni; ++ j) {
+      val |= val_array[fanins[j]];
+    }
+    break;
+
+  case kOpNor:
+    for (ymuint j = 1; j < ni; ++ j) {
+      val |= val_array[fanins[j]];
+    }
+    val = ~val;
+    break;
+
+  case kOpXor:
+    for (ymuint j = 1; j < ni; ++ j) {
+      val ^= val_array[fanins[j]];
+    }
+    break;
+
+  case kOpXnor:
+    for (ymuint j = 1; j < ni; ++ j) {
+      val ^= val_array[fanins[j]];
+    }
+    val = ~val;
+    break;
+  }
+  return val;
+}
+
+END_NAMESPACE_YM_SATPG_FSIM2
+
+#endif // FSIM2_GVALKERNEL_H
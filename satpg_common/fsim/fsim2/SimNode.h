@@ -12,7 +12,7 @@
 #include "fsim2_nsdef.h"
 #include "TpgNode.h"
 #include "EqElem.h"
-#include "PackedVal.h"
+#include "PackedValW.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG_FSIM2
@@ -125,22 +125,22 @@ public:
   /// @note 通常は外部入力に対して行われる．
   /// @note 故障値も同様にセットされる．
   void
-  set_gval(PackedVal pat);
+  set_gval(PackedValW pat);
 
   /// @brief 正常値を得る．(2値版)
-  PackedVal
+  PackedValW
   gval() const;
 
   /// @brief 故障値をセットする．(2値版)
   void
-  set_fval(PackedVal pat);
+  set_fval(PackedValW pat);
 
   /// @brief 故障値のマスクをセットする．
   void
-  set_fmask(PackedVal mask);
+  set_fmask(PackedValW mask);
 
   /// @brief 故障値を得る．(2値版)
-  PackedVal
+  PackedValW
   fval() const;
 
   /// @brief 故障値をクリアする．
@@ -155,11 +155,11 @@ public:
   /// @brief 故障値の計算を行う．(2値版)
   /// @return 故障差を返す．
   /// @note 結果は mFval にセットされる．
-  PackedVal
-  calc_fval2(PackedVal mask);
+  PackedValW
+  calc_fval2(PackedValW mask);
 
   /// @brief ローカルな obs の計算を行う．
-  PackedVal
+  PackedValW
   calc_lobs();
 
   /// @brief lobs が計算済みかチェックする．
@@ -193,6 +193,13 @@ public:
   void
   set_ffr(SimFFR* ffr);
 
+  /// @brief 正常値と故障値の格納場所を設定する．
+  /// @param[in] gval_ptr 正常値の格納場所
+  /// @param[in] fval_ptr 故障値の格納場所
+  void
+  set_val_ptr(PackedValW* gval_ptr,
+	      PackedValW* fval_ptr);
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -201,17 +208,17 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2() = 0;
 
   /// @brief 故障値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2() = 0;
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos) = 0;
 
   /// @brief 内容をダンプする．
@@ -250,17 +257,17 @@ private:
   // レベル
   ymuint32 mLevel;
 
-  // 正常値
-  PackedVal mGval;
+  // 正常値の格納場所(GvalKernel 内の配列の要素)
+  PackedValW* mGvalPtr;
 
-  // 故障値
-  PackedVal mFval;
+  // 故障値の格納場所(GvalKernel 内の配列の要素)
+  PackedValW* mFvalPtr;
 
   // FFR 内のローカルな obs
-  PackedVal mLobs;
+  PackedValW mLobs;
 
   // 故障値に対するマスク
-  PackedVal mFmask;
+  PackedValW mFmask;
 
   // 名前
   string mName;
@@ -366,42 +373,42 @@ SimNode::clear_lobs()
 // @note 故障値も同様にセットされる．
 inline
 void
-SimNode::set_gval(PackedVal val)
+SimNode::set_gval(PackedValW val)
 {
-  mGval = val;
-  mFval = val;
+  *mGvalPtr = val;
+  *mFvalPtr = val;
 }
 
 // @brief 正常値を得る．(2値版)
 inline
-PackedVal
+PackedValW
 SimNode::gval() const
 {
-  return mGval;
+  return *mGvalPtr;
 }
 
 // @brief 故障値をセットする．(2値版)
 inline
 void
-SimNode::set_fval(PackedVal pat)
+SimNode::set_fval(PackedValW pat)
 {
-  mFval = pat;
+  *mFvalPtr = pat;
 }
 
 // @brief 故障値のマスクをセットする．
 inline
 void
-SimNode::set_fmask(PackedVal mask)
+SimNode::set_fmask(PackedValW mask)
 {
   mFmask = mask;
 }
 
 // @brief 故障値を得る．(2値版)
 inline
-PackedVal
+PackedValW
 SimNode::fval() const
 {
-  return mFval;
+  return *mFvalPtr;
 }
 
 // @brief 故障値をクリアする．
@@ -409,8 +416,8 @@ inline
 void
 SimNode::clear_fval()
 {
-  mFval = mGval;
-  mFmask = kPvAll1;
+  *mFvalPtr = *mGvalPtr;
+  mFmask = kPvwAll1;
 }
 
 // @brief 正常値の計算を行う．(2値版)
@@ -426,12 +433,12 @@ SimNode::calc_gval2()
 // @return 故障差を返す．
 // @note 結果は mFval にセットされる．
 inline
-PackedVal
-SimNode::calc_fval2(PackedVal mask)
+PackedValW
+SimNode::calc_fval2(PackedValW mask)
 {
-  PackedVal val = _calc_fval2();
-  PackedVal diff = (mGval ^ val) & mask;
-  mFval ^= diff;
+  PackedValW val = _calc_fval2();
+  PackedValW diff = (*mGvalPtr ^ val) & mask;
+  *mFvalPtr ^= diff;
   return diff;
 }
 
@@ -443,6 +450,18 @@ SimNode::set_ffr(SimFFR* ffr)
   mFFR = ffr;
 }
 
+// @brief 正常値と故障値の格納場所を設定する．
+// @param[in] gval_ptr 正常値の格納場所
+// @param[in] fval_ptr 故障値の格納場所
+inline
+void
+SimNode::set_val_ptr(PackedValW* gval_ptr,
+		     PackedValW* fval_ptr)
+{
+  mGvalPtr = gval_ptr;
+  mFvalPtr = fval_ptr;
+}
+
 // @brief 名前を設定する．
 inline
 void
@@ -36,11 +36,11 @@ SnAnd::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->gval();
   }
@@ -48,11 +48,11 @@ SnAnd::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->fval();
   }
@@ -60,10 +60,10 @@ SnAnd::_calc_fval2()
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnAnd::calc_gobs2(ymuint ipos)
 {
-  PackedVal obs = kPvAll1;
+  PackedValW obs = kPvwAll1;
   for (ymuint i = 0; i < ipos; ++ i) {
     obs &= mFanins[i]->gval();
   }
@@ -110,25 +110,25 @@ SnAnd2::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return pat0 & pat1;
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return pat0 & pat1;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnAnd2::calc_gobs2(ymuint ipos)
 {
   return mFanins[ipos ^ 1]->gval();
@@ -168,27 +168,27 @@ SnAnd3::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd3::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
   return pat0 & pat1 & pat2;
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd3::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
   return pat0 & pat1 & pat2;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnAnd3::calc_gobs2(ymuint ipos)
 {
   switch ( ipos ) {
@@ -196,7 +196,7 @@ SnAnd3::calc_gobs2(ymuint ipos)
   case 1: return mFanins[0]->gval() & mFanins[2]->gval();
   case 2: return mFanins[0]->gval() & mFanins[1]->gval();
   }
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -234,29 +234,29 @@ SnAnd4::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd4::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
-  PackedVal pat3 = mFanins[3]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
+  PackedValW pat3 = mFanins[3]->gval();
   return pat0 & pat1 & pat2 & pat3;
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnAnd4::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
-  PackedVal pat3 = mFanins[3]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
+  PackedValW pat3 = mFanins[3]->fval();
   return pat0 & pat1 & pat2 & pat3;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnAnd4::calc_gobs2(ymuint ipos)
 {
   switch ( ipos ) {
@@ -265,7 +265,7 @@ SnAnd4::calc_gobs2(ymuint ipos)
   case 2: return mFanins[0]->gval() & mFanins[1]->gval() & mFanins[3]->gval();
   case 3: return mFanins[0]->gval() & mFanins[1]->gval() & mFanins[2]->gval();
   }
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -304,11 +304,11 @@ SnNand::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->gval();
   }
@@ -316,11 +316,11 @@ SnNand::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->fval();
   }
@@ -364,20 +364,20 @@ SnNand2::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return ~(pat0 & pat1);
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return ~(pat0 & pat1);
 }
 
@@ -415,22 +415,22 @@ SnNand3::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand3::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
   return ~(pat0 & pat1 & pat2);
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand3::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
   return ~(pat0 & pat1 & pat2);
 }
 
@@ -469,24 +469,24 @@ SnNand4::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand4::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
-  PackedVal pat3 = mFanins[3]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
+  PackedValW pat3 = mFanins[3]->gval();
   return ~(pat0 & pat1 & pat2 & pat3);
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNand4::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
-  PackedVal pat3 = mFanins[3]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
+  PackedValW pat3 = mFanins[3]->fval();
   return ~(pat0 & pat1 & pat2 & pat3);
 }
 
@@ -54,7 +54,7 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．(2値版)
@@ -62,12 +62,12 @@ public:
   /// @retval false 値は変わらなかった．
   /// @note 結果は mFval にセットされる．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -105,17 +105,17 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -153,12 +153,12 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
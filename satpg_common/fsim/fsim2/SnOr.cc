@@ -29,11 +29,11 @@ SnOr::~SnOr()
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val |= mFanins[i]->gval();
   }
@@ -48,11 +48,11 @@ SnOr::gate_type() const
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val |= mFanins[i]->fval();
   }
@@ -60,10 +60,10 @@ SnOr::_calc_fval2()
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnOr::calc_gobs2(ymuint ipos)
 {
-  PackedVal obs = kPvAll0;
+  PackedValW obs = kPvwAll0;
   for (ymuint i = 0; i < ipos; ++ i) {
     obs |= mFanins[i]->gval();
   }
@@ -110,25 +110,25 @@ SnOr2::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return pat0 | pat1;
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return pat0 | pat1;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnOr2::calc_gobs2(ymuint ipos)
 {
   return ~mFanins[ipos ^ 1]->gval();
@@ -168,27 +168,27 @@ SnOr3::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr3::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
   return pat0 | pat1 | pat2;
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr3::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
   return pat0 | pat1 | pat2;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnOr3::calc_gobs2(ymuint ipos)
 {
   switch ( ipos ) {
@@ -196,7 +196,7 @@ SnOr3::calc_gobs2(ymuint ipos)
   case 1: return ~(mFanins[0]->gval() | mFanins[2]->gval());
   case 2: return ~(mFanins[0]->gval() | mFanins[1]->gval());
   }
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -234,29 +234,29 @@ SnOr4::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr4::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
-  PackedVal pat3 = mFanins[3]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
+  PackedValW pat3 = mFanins[3]->gval();
   return pat0 | pat1 | pat2 | pat3;
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnOr4::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
-  PackedVal pat3 = mFanins[3]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
+  PackedValW pat3 = mFanins[3]->fval();
   return pat0 | pat1 | pat2 | pat3;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnOr4::calc_gobs2(ymuint ipos)
 {
   switch ( ipos ) {
@@ -265,7 +265,7 @@ SnOr4::calc_gobs2(ymuint ipos)
   case 2: return ~(mFanins[0]->gval() | mFanins[1]->gval() | mFanins[3]->gval());
   case 3: return ~(mFanins[0]->gval() | mFanins[1]->gval() | mFanins[2]->gval());
   }
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -304,11 +304,11 @@ SnNor::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val |= mFanins[i]->gval();
   }
@@ -316,11 +316,11 @@ SnNor::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val |= mFanins[i]->fval();
   }
@@ -364,20 +364,20 @@ SnNor2::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return ~(pat0 | pat1);
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return ~(pat0 | pat1);
 }
 
@@ -415,22 +415,22 @@ SnNor3::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor3::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
   return ~(pat0 | pat1 | pat2);
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor3::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
   return ~(pat0 | pat1 | pat2);
 }
 
@@ -469,24 +469,24 @@ SnNor4::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor4::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
-  PackedVal pat3 = mFanins[3]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
+  PackedValW pat3 = mFanins[3]->gval();
   return ~(pat0 | pat1 | pat2 | pat3);
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnNor4::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
-  PackedVal pat3 = mFanins[3]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
+  PackedValW pat3 = mFanins[3]->fval();
   return ~(pat0 | pat1 | pat2 | pat3);
 }
 
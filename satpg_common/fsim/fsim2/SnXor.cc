@@ -36,11 +36,11 @@ SnXor::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXor::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val ^= mFanins[i]->gval();
   }
@@ -48,11 +48,11 @@ SnXor::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXor::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val ^= mFanins[i]->fval();
   }
@@ -60,10 +60,10 @@ SnXor::_calc_fval2()
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnXor::calc_gobs2(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -103,28 +103,28 @@ SnXor2::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXor2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return pat0 ^ pat1;
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXor2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return pat0 ^ pat1;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnXor2::calc_gobs2(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -161,11 +161,11 @@ SnXnor::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXnor::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal val = mFanins[0]->gval();
+  PackedValW val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     val ^= mFanins[i]->gval();
   }
@@ -173,11 +173,11 @@ SnXnor::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXnor::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val ^= mFanins[i]->fval();
   }
@@ -221,20 +221,20 @@ SnXnor2::gate_type() const
 }
 
 // @brief 正常値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXnor2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return ~(pat0 ^ pat1);
 }
 
 // @brief 故障値の計算を行う．(2値版)
-PackedVal
+PackedValW
 SnXnor2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return ~(pat0 ^ pat1);
 }
 
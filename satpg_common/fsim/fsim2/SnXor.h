@@ -41,17 +41,17 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -89,17 +89,17 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -137,12 +137,12 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
@@ -180,12 +180,12 @@ public:
 
   /// @brief 正常値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．(2値版)
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
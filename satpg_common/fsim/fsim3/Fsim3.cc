@@ -13,6 +13,7 @@
 #include "TpgNode.h"
 #include "TpgFault.h"
 #include "TestVector.h"
+#include "TvStore.h"
 #include "NodeValList.h"
 #include "SimNode.h"
 #include "SimFFR.h"
@@ -50,7 +51,9 @@ END_NONAMESPACE
 //////////////////////////////////////////////////////////////////////
 
 // @brief コンストラクタ
-Fsim3::Fsim3()
+Fsim3::Fsim3() :
+  mWsaVal(0),
+  mWsaNewVal(0)
 {
 }
 
@@ -67,6 +70,8 @@ Fsim3::set_network(const TpgNetwork& network)
 {
   clear();
 
+  clear_sync();
+
   mNetwork = &network;
 
   ymuint nn = mNetwork->node_num();
@@ -168,7 +173,6 @@ Fsim3::set_network(const TpgNetwork& network)
   }
 
   // 消去用の配列の大きさはノード数を越えない．
-  mGvalClearArray.reserve(mNodeArray.size());
   mFvalClearArray.reserve(mNodeArray.size());
 
   // 最大レベルを求め，イベントキューを初期化する．
@@ -181,12 +185,9 @@ Fsim3::set_network(const TpgNetwork& network)
   }
   mEventQ.init(max_level);
 
-  // 値を X に初期化しておく
-  for (vector<SimNode*>::iterator p = mNodeArray.begin();
-       p != mNodeArray.end(); ++ p) {
-    SimNode* simnode = *p;
-    simnode->set_gval(kPvAll0, kPvAll0);
-  }
+  // 値の格納場所を設定する．
+  // 値は X に初期化される．
+  mKernel.init(mNodeArray, mLogicArray);
 
 
   //////////////////////////////////////////////////////////////////////
@@ -220,19 +221,50 @@ Fsim3::set_network(const TpgNetwork& network)
   }
 }
 
+// @brief ppsfp() で用いるスレッド数を設定する．
+// @param[in] num スレッド数(0 の場合はハードウェアの並列度)
+//
+// このクラスは並列化に対応していないので何もしない．
+void
+Fsim3::set_thread_num(ymuint num)
+{
+}
+
 // @brief 故障にスキップマークをつける．
 void
-Fsim3::set_skip(const TpgFault* f)
+Fsim3::_set_skip(const TpgFault* f)
 {
   mFaultArray[f->id()]->mSkip = true;
 }
 
+// @brief 故障リストに含まれる故障のスキップマークを消す．
+//
+// スキップマークのついた故障は ffr_simulate() で SimFFR::fault_list()
+// から取り除かれている可能性があるので，なければ追加し直す．
+void
+Fsim3::_clear_skip(const TpgFault* f)
+{
+  SimFault* ff = mFaultArray[f->id()];
+  if ( !ff->mSkip ) {
+    return;
+  }
+  ff->mSkip = false;
+
+  vector<SimFault*>& flist = ff->mNode->ffr()->fault_list();
+  for (ymuint i = 0; i < flist.size(); ++ i) {
+    if ( flist[i] == ff ) {
+      return;
+    }
+  }
+  flist.push_back(ff);
+}
+
 // @brief 故障リストを設定する．
 // @param[in] fault_list 対象の故障リスト
 //
 // スキップマークは消される．
 void
-Fsim3::set_faults(const vector<const TpgFault*>& fault_list)
+Fsim3::_set_faults(const vector<const TpgFault*>& fault_list)
 {
   HashSet<ymuint> fault_set;
   for (ymuint i = 0; i < fault_list.size(); ++ i) {
@@ -269,17 +301,14 @@ Fsim3::spsfp(TestVector* tv,
 	     const TpgFault* f)
 {
   // tv を全ビットにセットしていく．
-  mGvalClearArray.clear();
-
   ymuint npi = mNetwork->input_num2();
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
     switch ( tv->val3(i) ) {
-    case kVal0: simnode->set_gval(kPvAll1, kPvAll0); break;
-    case kVal1: simnode->set_gval(kPvAll0, kPvAll1); break;
-    case kValX: continue;
+    case kVal0: simnode->set_gval(kPvwAll1, kPvwAll0); break;
+    case kVal1: simnode->set_gval(kPvwAll0, kPvwAll1); break;
+    case kValX: break; // 直前の clear_gval() で X になっているはず．
     }
-    update_gval(simnode);
   }
 
   return _spsfp(f);
@@ -295,19 +324,16 @@ Fsim3::spsfp(const NodeValList& assign_list,
 	     const TpgFault* f)
 {
   // assign_list を全ビットにセットしていく．
-  mGvalClearArray.clear();
-
   ymuint n = assign_list.size();
   for (ymuint i = 0; i < n; ++ i) {
     NodeVal nv = assign_list[i];
     SimNode* simnode = mInputArray[nv.node()->input_id()];
     if ( nv.val() ) {
-      simnode->set_gval(kPvAll0, kPvAll1);
+      simnode->set_gval(kPvwAll0, kPvwAll1);
     }
     else {
-      simnode->set_gval(kPvAll1, kPvAll0);
+      simnode->set_gval(kPvwAll1, kPvwAll0);
     }
-    update_gval(simnode);
   }
 
   return _spsfp(f);
@@ -324,7 +350,7 @@ Fsim3::_spsfp(const TpgFault* f)
   calc_gval();
 
   // FFR 内の故障伝搬を行う．
-  PackedVal lobs;
+  PackedValW lobs;
   if ( f->is_branch_fault() ) {
     SimNode* simnode = find_simnode(f->tpg_onode());
     ymuint ipos = f->tpg_pos();
@@ -338,7 +364,7 @@ Fsim3::_spsfp(const TpgFault* f)
   }
 
   SimNode* isimnode = find_simnode(f->tpg_inode());
-  PackedVal valdiff;
+  PackedValW valdiff;
   if ( f->val() == 1 ) {
     valdiff = isimnode->gval_0();
   }
@@ -350,21 +376,21 @@ Fsim3::_spsfp(const TpgFault* f)
   bool ans = false;
 
   // lobs が 0 ならその後のシミュレーションを行う必要はない．
-  if ( lobs != kPvAll0 ) {
+  if ( lobs != kPvwAll0 ) {
     SimNode* root = isimnode->ffr()->root();
     if ( root->is_output() ) {
-      ans = (lobs != kPvAll0);
+      ans = (lobs != kPvwAll0);
     }
     else {
-      PackedVal gval0 = root->gval_0();
-      PackedVal gval1 = root->gval_1();
-      PackedVal fval0 = (gval0 & ~lobs) | (gval1 & lobs);
-      PackedVal fval1 = (gval1 & ~lobs) | (gval0 & lobs);
+      PackedValW gval0 = root->gval_0();
+      PackedValW gval1 = root->gval_1();
+      PackedValW fval0 = (gval0 & ~lobs) | (gval1 & lobs);
+      PackedValW fval1 = (gval1 & ~lobs) | (gval0 & lobs);
       root->set_fval(fval0, fval1);
       update_fval(root);
 
-      PackedVal obs = calc_fval() & lobs;
-      ans = (obs != kPvAll0);
+      PackedValW obs = calc_fval() & lobs;
+      ans = (obs != kPvwAll0);
     }
   }
 
@@ -384,15 +410,13 @@ Fsim3::sppfp(TestVector* tv,
   ymuint npi = mNetwork->input_num2();
 
   // tv を全ビットにセットしていく．
-  mGvalClearArray.clear();
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
     switch ( tv->val3(i) ) {
-    case kVal0: simnode->set_gval(kPvAll1, kPvAll0); break;
-    case kVal1: simnode->set_gval(kPvAll0, kPvAll1); break;
-    case kValX: continue; // 直前の clear_gval() で X になっているはず．
+    case kVal0: simnode->set_gval(kPvwAll1, kPvwAll0); break;
+    case kVal1: simnode->set_gval(kPvwAll0, kPvwAll1); break;
+    case kValX: break; // 直前の clear_gval() で X になっているはず．
     }
-    update_gval(simnode);
   }
 
   _sppfp(op);
@@ -406,19 +430,16 @@ Fsim3::sppfp(const NodeValList& assign_list,
 	     FsimOp& op)
 {
   // assign_list を全ビットにセットしていく．
-  mGvalClearArray.clear();
-
   ymuint n = assign_list.size();
   for (ymuint i = 0; i < n; ++ i) {
     NodeVal nv = assign_list[i];
     SimNode* simnode = mInputArray[nv.node()->input_id()];
     if ( nv.val() ) {
-      simnode->set_gval(kPvAll0, kPvAll1);
+      simnode->set_gval(kPvwAll0, kPvwAll1);
     }
     else {
-      simnode->set_gval(kPvAll1, kPvAll0);
+      simnode->set_gval(kPvwAll1, kPvwAll0);
     }
-    update_gval(simnode);
   }
 
   _sppfp(op);
@@ -433,25 +454,25 @@ Fsim3::_sppfp(FsimOp& op)
   calc_gval();
 
   ymuint bitpos = 0;
-  SimFFR* ffr_buff[kPvBitLen];
+  SimFFR* ffr_buff[kPvwBitLen];
   // FFR ごとに処理を行う．
   for (vector<SimFFR>::iterator p = mFFRArray.begin();
        p != mFFRArray.end(); ++ p) {
     SimFFR* ffr = &(*p);
 
     SimNode* root = ffr->root();
-    PackedVal gval0 = root->gval_0();
-    PackedVal gval1 = root->gval_1();
+    PackedValW gval0 = root->gval_0();
+    PackedValW gval1 = root->gval_1();
     // FFR の根の値が X なら故障の検出はできない．
-    if ( (gval0 | gval1) == kPvAll0 ) continue;
+    if ( (gval0 | gval1) == kPvwAll0 ) continue;
 
     // FFR 内の故障伝搬を行う．
     // 結果は Fsim3Fault.mObsMask に保存される．
     // FFR 内の全ての obs マスクの OR を ffr_req に入れる．
-    PackedVal ffr_req = ffr_simulate(ffr);
+    PackedValW ffr_req = ffr_simulate(ffr);
 
     // ffr_req が 0 ならその後のシミュレーションを行う必要はない．
-    if ( ffr_req == kPvAll0 ) {
+    if ( ffr_req == kPvwAll0 ) {
       continue;
     }
 
@@ -463,9 +484,10 @@ Fsim3::_sppfp(FsimOp& op)
 
     // この FFR の root の故障伝搬をシミュレートする必要があるので
     // キューに積んでおく
-    PackedVal bitmask = 1UL << bitpos;
-    PackedVal fval0 = (gval0 & ~bitmask) | (gval1 & bitmask);
-    PackedVal fval1 = (gval1 & ~bitmask) | (gval0 & bitmask);
+    PackedValW bitmask = kPvwAll0;
+    bitmask.set_bit(bitpos);
+    PackedValW fval0 = (gval0 & ~bitmask) | (gval1 & bitmask);
+    PackedValW fval1 = (gval1 & ~bitmask) | (gval0 & bitmask);
     root->set_fval(fval0, fval1);
     root->set_fmask(~bitmask);
 
@@ -473,11 +495,11 @@ Fsim3::_sppfp(FsimOp& op)
     ffr_buff[bitpos] = ffr;
 
     ++ bitpos;
-    if ( bitpos == kPvBitLen ) {
-      // kPvBitLen だけ故障がたまったのでシミュレートする．
-      PackedVal obs = calc_fval();
-      for (ymuint i = 0; i < bitpos; ++ i, obs >>= 1) {
-	if ( obs & 1UL ) {
+    if ( bitpos == kPvwBitLen ) {
+      // kPvwBitLen だけ故障がたまったのでシミュレートする．
+      PackedValW obs = calc_fval();
+      for (ymuint i = 0; i < bitpos; ++ i) {
+	if ( obs.check_bit(i) ) {
 	  fault_sweep(ffr_buff[i], op);
 	}
       }
@@ -486,9 +508,9 @@ Fsim3::_sppfp(FsimOp& op)
   }
   if ( bitpos > 0 ) {
     // キューに残っている故障をシミュレートする．
-    PackedVal obs = calc_fval();
-    for (ymuint i = 0; i < bitpos; ++ i, obs >>= 1) {
-      if ( obs & 1UL ) {
+    PackedValW obs = calc_fval();
+    for (ymuint i = 0; i < bitpos; ++ i) {
+      if ( obs.check_bit(i) ) {
 	fault_sweep(ffr_buff[i], op);
       }
     }
@@ -505,56 +527,105 @@ void
 Fsim3::ppsfp(const vector<TestVector*>& tv_array,
 	     FsimOp& op)
 {
-  ymuint npi = mNetwork->input_num2();
   ymuint nb = tv_array.size();
 
   // tv_array を入力ごとに固めてセットしていく．
-  mGvalClearArray.clear();
-  for (ymuint i = 0; i < npi; ++ i) {
-    PackedVal val_0 = kPvAll0;
-    PackedVal val_1 = kPvAll0;
-    PackedVal bit = 1UL;
-    for (ymuint j = 0; j < nb; ++ j, bit <<= 1) {
-      switch ( tv_array[j]->val3(i) ) {
-      case kVal0:
-	val_0 |= bit;
-	break;
-
-      case kVal1:
-	val_1 |= bit;
-	break;
-
-      default:
-	break;
-      }
-    }
+  set_tv_array(tv_array);
 
-    // 残ったビットには 0 番めのパタンを詰めておく．
-    // これは無駄なイベントを発生させないため．
-    switch ( tv_array[0]->val3(i) ) {
-    case kVal0:
-      for (ymuint j = nb; j < kPvBitLen; ++ j, bit <<= 1) {
-	val_0 |= bit;
-      }
-      break;
+  _ppsfp(nb, op);
+}
 
-    case kVal1:
-      for (ymuint j = nb; j < kPvBitLen; ++ j, bit <<= 1) {
-	val_1 |= bit;
+// @brief 複数のパタンで故障シミュレーションを行う．
+// @param[in] assign_list_array 値の割当リストの配列
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+Fsim3::ppsfp(const vector<NodeValList>& assign_list_array,
+	     FsimOp& op)
+{
+  ymuint npi = mNetwork->input_num2();
+  ymuint nb = assign_list_array.size();
+
+  ASSERT_COND( nb > 0 && nb <= kPvwBitLen );
+
+  // 割当のない入力の値は X(0 と 1 のどちらのビットも立っていない) となる．
+  vector<PackedValW> val0_array(npi, kPvwAll0);
+  vector<PackedValW> val1_array(npi, kPvwAll0);
+  for (ymuint j = 0; j < nb; ++ j) {
+    const NodeValList& assign_list = assign_list_array[j];
+    ymuint n = assign_list.size();
+    for (ymuint i = 0; i < n; ++ i) {
+      NodeVal nv = assign_list[i];
+      ymuint iid = nv.node()->input_id();
+      if ( nv.val() ) {
+	val1_array[iid].set_bit(j);
       }
-      break;
-
-    default:
-      break;
+      else {
+	val0_array[iid].set_bit(j);
+      }
+    }
+  }
 
+  // 残ったビットには 0 番めのパタンを詰めておく．
+  PackedValW rest_mask = kPvwAll0;
+  {
+    ymuint wpos = nb / kPvBitLen;
+    ymuint bpos = nb % kPvBitLen;
+    if ( bpos > 0 ) {
+      rest_mask.set_word(wpos, kPvAll1 << bpos);
+      ++ wpos;
     }
-    SimNode* simnode = mInputArray[i];
-    if ( (val_0 | val_1) != kPvAll0 ) {
-      simnode->set_gval(val_0, val_1);
-      update_gval(simnode);
+    for ( ; wpos < kPvwWordNum; ++ wpos) {
+      rest_mask.set_word(wpos, kPvAll1);
+    }
+  }
+  const NodeValList& assign_list0 = assign_list_array[0];
+  ymuint n0 = assign_list0.size();
+  for (ymuint i = 0; i < n0; ++ i) {
+    NodeVal nv = assign_list0[i];
+    ymuint iid = nv.node()->input_id();
+    if ( nv.val() ) {
+      val1_array[iid] |= rest_mask;
+    }
+    else {
+      val0_array[iid] |= rest_mask;
     }
   }
 
+  for (ymuint i = 0; i < npi; ++ i) {
+    SimNode* simnode = mInputArray[i];
+    simnode->set_gval(val0_array[i], val1_array[i]);
+  }
+
+  _ppsfp(nb, op);
+}
+
+// @brief 複数のパタンで故障シミュレーションを行う．
+// @param[in] tv_store テストベクタを保持するオブジェクト
+// @param[in] blk ブロック番号
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+Fsim3::ppsfp(const TvStore& tv_store,
+	     ymuint blk,
+	     FsimOp& op)
+{
+  ymuint npi = mNetwork->input_num2();
+  ASSERT_COND( tv_store.input_num() == npi );
+
+  // ブロック内の値をそのまま外部入力にセットする．
+  for (ymuint i = 0; i < npi; ++ i) {
+    mInputArray[i]->set_gval(tv_store.val0(blk, i), tv_store.val1(blk, i));
+  }
+
+  _ppsfp(tv_store.block_size(blk), op);
+}
+
+// @brief PPSFP故障シミュレーションの本体
+// @param[in] nb パタン数
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+Fsim3::_ppsfp(ymuint nb,
+	      FsimOp& op)
+{
   // 正常値の計算を行う．
   calc_gval();
 
@@ -564,33 +635,33 @@ Fsim3::ppsfp(const vector<TestVector*>& tv_array,
     SimFFR* ffr = &(*p);
 
     SimNode* root = ffr->root();
-    PackedVal gval0 = root->gval_0();
-    PackedVal gval1 = root->gval_1();
+    PackedValW gval0 = root->gval_0();
+    PackedValW gval1 = root->gval_1();
     // FFR の根の値が X なら故障の検出はできない．
-    if ( (gval0 | gval1) == kPvAll0 ) continue;
+    if ( (gval0 | gval1) == kPvwAll0 ) continue;
 
     // FFR 内の故障伝搬を行う．
     // 結果は Fsim3Fault.mObsMask に保存される．
     // FFR 内の全ての obs マスクの OR を ffr_req に入れる．
-    PackedVal ffr_req = ffr_simulate(ffr);
+    PackedValW ffr_req = ffr_simulate(ffr);
 
     // ffr_req が 0 ならその後のシミュレーションを行う必要はない．
-    if ( ffr_req == kPvAll0 ) {
+    if ( ffr_req == kPvwAll0 ) {
       continue;
     }
 
     // FFR の出力の故障伝搬を行う．
-    PackedVal obs = kPvAll0;
+    PackedValW obs = kPvwAll0;
     if ( root->is_output() ) {
-      obs = kPvAll1;
+      obs = kPvwAll1;
     }
     else {
       mFvalClearArray.clear();
       // FFR 内で必要とされているビットだけ反転させる．
-      PackedVal gval0 = root->gval_0();
-      PackedVal gval1 = root->gval_1();
-      PackedVal fval0 = (ffr_req & gval1) | (~ffr_req & gval0);
-      PackedVal fval1 = (ffr_req & gval0) | (~ffr_req & gval1);
+      PackedValW gval0 = root->gval_0();
+      PackedValW gval1 = root->gval_1();
+      PackedValW fval0 = (ffr_req & gval1) | (~ffr_req & gval0);
+      PackedValW fval1 = (ffr_req & gval0) | (~ffr_req & gval1);
       root->set_fval(fval0, fval1);
       update_fval(root);
       obs = calc_fval();
@@ -602,9 +673,16 @@ Fsim3::ppsfp(const vector<TestVector*>& tv_array,
     for (vector<SimFault*>::const_iterator p_ff = flist.begin();
 	 p_ff != flist.end(); ++ p_ff) {
       SimFault* ff = *p_ff;
-      PackedVal dbits = obs & ff->mObsMask;
-      if ( dbits ) {
-	const TpgFault* f = ff->mOrigF;
+      PackedValW dbits = obs & ff->mObsMask;
+      if ( dbits.is_zero() ) {
+	continue;
+      }
+      const TpgFault* f = ff->mOrigF;
+      if ( nb <= kPvBitLen ) {
+	// 残りのワードは 0 番めのパタンの複製なので先頭のワードだけでよい．
+	op(f, dbits.word(0));
+      }
+      else {
 	op(f, dbits);
       }
     }
@@ -632,9 +710,10 @@ Fsim3::clear()
 
   mFFRArray.clear();
 
-  mGvalClearArray.clear();
   mFvalClearArray.clear();
 
+  mKernel.clear();
+
   for (vector<SimFFR>::iterator p = mFFRArray.begin();
        p != mFFRArray.end(); ++ p) {
     p->fault_list().clear();
@@ -643,6 +722,9 @@ Fsim3::clear()
   mSimFaults.clear();
   mFaultArray.clear();
 
+  mWsaInput.clear();
+  mWsaFlipList.clear();
+
 
   // 念のため
   mNetwork = nullptr;
@@ -657,10 +739,10 @@ Fsim3::clear()
 //
 // 故障は SimFFR::fault_list() に格納されているが，
 // スキップフラグが立った故障はリストから取り除かれる．
-PackedVal
+PackedValW
 Fsim3::ffr_simulate(SimFFR* ffr)
 {
-  PackedVal ffr_req = kPvAll0;
+  PackedValW ffr_req = kPvwAll0;
   vector<SimFault*>& flist = ffr->fault_list();
   ymuint fnum = flist.size();
   ymuint wpos = 0;
@@ -677,7 +759,7 @@ Fsim3::ffr_simulate(SimFFR* ffr)
 
     // ff の故障伝搬を行う．
     SimNode* simnode = ff->mNode;
-    PackedVal lobs = simnode->calc_lobs();
+    PackedValW lobs = simnode->calc_lobs();
     SimNode* isimnode = ff->mInode;
     if ( f->is_branch_fault() ) {
       // 入力の故障
@@ -685,7 +767,7 @@ Fsim3::ffr_simulate(SimFFR* ffr)
       lobs &= simnode->calc_gobs3(ipos);
     }
 
-    PackedVal valdiff;
+    PackedValW valdiff;
     if ( f->val() == 1 ) {
       valdiff = isimnode->gval_0();
     }
@@ -714,49 +796,48 @@ Fsim3::ffr_simulate(SimFFR* ffr)
 }
 
 // @brief 正常値の計算を行う．
-// @note 値の変わったノードは mGvalClearArray に積まれる．
+//
+// 外部入力の値はあらかじめ設定されている必要がある．
+// 割当の一部だけが変わる場合でもほとんどのノードの値が変わるので，
+// イベントドリブンではなく全ての論理ノードを順に計算する．
 void
 Fsim3::calc_gval()
 {
-  for ( ; ; ) {
-    SimNode* node = mEventQ.get();
-    if ( node == nullptr ) break;
-    if ( node->calc_gval3() ) {
-      update_gval(node);
-    }
-  }
+  mKernel.calc_gval();
 }
 
 // @brief 正常値をクリアする．
-// @note mGvalClearArray を使う．
+//
+// 外部入力の値を X に戻す．
+// 論理ノードの値は次の calc_gval() で全て計算し直される．
 void
 Fsim3::clear_gval()
 {
-  for (vector<SimNode*>::iterator p = mGvalClearArray.begin();
-       p != mGvalClearArray.end(); ++ p) {
+  for (vector<SimNode*>::iterator p = mInputArray.begin();
+       p != mInputArray.end(); ++ p) {
     SimNode* node = *p;
-    node->set_gval(kPvAll0, kPvAll0);
+    node->set_gval(kPvwAll0, kPvwAll0);
   }
 }
 
 // @brief イベントキューを用いてシミュレーションを行う．
-PackedVal
+PackedValW
 Fsim3::calc_fval()
 {
-  PackedVal obs = kPvAll0;
+  PackedValW obs = kPvwAll0;
   for ( ; ; ) {
     SimNode* node = mEventQ.get();
     if ( node == nullptr ) break;
-    PackedVal diff = node->calc_fval3(~obs);
-    if ( diff != kPvAll0 ) {
+    PackedValW diff = mKernel.calc_fval(node->id(), node->fmask() & ~obs);
+    if ( diff != kPvwAll0 ) {
       mFvalClearArray.push_back(node);
       if ( node->is_output() ) {
-	PackedVal gval0 = node->gval_0();
-	PackedVal gval1 = node->gval_1();
-	PackedVal fval0 = node->fval_0();
-	PackedVal fval1 = node->fval_1();
+	PackedValW gval0 = node->gval_0();
+	PackedValW gval1 = node->gval_1();
+	PackedValW fval0 = node->fval_0();
+	PackedValW fval1 = node->fval_1();
 	obs |= (gval0 ^ fval0) & (gval1 ^ fval1);
-	if ( obs == kPvAll1 ) {
+	if ( obs == kPvwAll1 ) {
 	  break;
 	}
       }
@@ -790,7 +871,7 @@ Fsim3::fault_sweep(SimFFR* ffr,
   ymuint fnum = flist.size();
   for (ymuint rpos = 0; rpos < fnum; ++ rpos) {
     SimFault* ff = flist[rpos];
-    if ( ff->mObsMask ) {
+    if ( !ff->mObsMask.is_zero() ) {
       const TpgFault* f = ff->mOrigF;
       op(f, kPvAll1);
     }
@@ -826,12 +907,180 @@ Fsim3::find_simnode(const TpgNode* node) const
   return mSimMap[node->id()];
 }
 
+// @brief tv_array の値を外部入力にセットする．
+// @param[in] tv_array テストベクタの配列
+//
+// 残ったビットには 0 番めのパタンを詰めておく．
+void
+Fsim3::set_tv_array(const vector<TestVector*>& tv_array)
+{
+  ymuint npi = mNetwork->input_num2();
+  ymuint nb = tv_array.size();
+
+  ASSERT_COND( nb > 0 && nb <= kPvwBitLen );
+
+  // tv_array を入力ごとのビット列に変換する．
+  // 残ったビットに 0 番めのパタンを詰めるのは無駄なイベントを
+  // 発生させないため．
+  vector<PackedValW> val0_array(npi, kPvwAll0);
+  vector<PackedValW> val1_array(npi, kPvwAll0);
+  TestVector::transpose(tv_array, val0_array.data(), val1_array.data());
+  for (ymuint i = 0; i < npi; ++ i) {
+    SimNode* simnode = mInputArray[i];
+    simnode->set_gval(val0_array[i], val1_array[i]);
+  }
+}
+
 // @brief WSA を計算する．
 // @param[in] tv テストベクタ
 ymuint
 Fsim3::calc_wsa(TestVector* tv)
 {
-  return 0;
+  vector<TestVector*> tv_array(1, tv);
+  vector<ymuint> wsa_array;
+  calc_wsa(tv_array, wsa_array);
+  return wsa_array[0];
+}
+
+// @brief 複数のパタンの WSA を計算する．
+// @param[in] tv_array テストベクタの配列
+// @param[out] wsa_array 各パタンの WSA を格納する配列
+//
+// 値が X のビットは変化しなかったものとみなす．
+void
+Fsim3::calc_wsa(const vector<TestVector*>& tv_array,
+		vector<ymuint>& wsa_array)
+{
+  set_tv_array(tv_array);
+  _calc_wsa(tv_array.size(), wsa_array);
+}
+
+// @brief WSA の計算の本体
+// @param[in] nb パタン数
+// @param[out] wsa_array 各パタンの WSA を格納する配列
+void
+Fsim3::_calc_wsa(ymuint nb,
+		 vector<ymuint>& wsa_array)
+{
+  // 1時刻目の正常値の計算を行う．
+  calc_gval();
+
+  // 1時刻目の値を保存しておく．
+  ymuint nn = mNodeArray.size();
+  vector<PackedValW> gval1_0(nn);
+  vector<PackedValW> gval1_1(nn);
+  for (ymuint i = 0; i < nn; ++ i) {
+    SimNode* node = mNodeArray[i];
+    gval1_0[i] = node->gval_0();
+    gval1_1[i] = node->gval_1();
+  }
+
+  // 2時刻目のフリップフロップの値を設定する．
+  ymuint npi1 = mNetwork->input_num();
+  ymuint npo1 = mNetwork->output_num();
+  ymuint nff = mNetwork->dff_num();
+  for (ymuint i = 0; i < nff; ++ i) {
+    SimNode* onode = mOutputArray[i + npo1];
+    SimNode* inode = mInputArray[i + npi1];
+    inode->set_gval(onode->gval_0(), onode->gval_1());
+  }
+
+  // 2時刻目の正常値の計算を行う．
+  calc_gval();
+
+  // 値の変化したノードのファンアウト数を加える．
+  wsa_array.clear();
+  wsa_array.resize(nb, 0);
+  for (vector<SimNode*>::iterator q = mLogicArray.begin();
+       q != mLogicArray.end(); ++ q) {
+    SimNode* node = *q;
+    ymuint id = node->id();
+    PackedValW toggle = (gval1_0[id] & node->gval_1()) | (gval1_1[id] & node->gval_0());
+    add_wsa(toggle, node->nfo(), wsa_array);
+  }
+
+  // 値をクリアする．
+  clear_gval();
+}
+
+// @brief 差分 WSA 計算用の状態を初期化する．
+// @param[in] tv 基準となるテストベクタ
+// @return tv の WSA を返す．
+//
+// このクラスは各時刻の値を保持しないので入力値だけを覚えておく．
+ymuint
+Fsim3::init_wsa(TestVector* tv)
+{
+  ymuint npi = mNetwork->input_num2();
+  mWsaInput.resize(npi);
+  for (ymuint i = 0; i < npi; ++ i) {
+    mWsaInput[i] = tv->val3(i);
+  }
+  mWsaFlipList.clear();
+
+  mWsaVal = calc_wsa(tv);
+  mWsaNewVal = mWsaVal;
+  return mWsaVal;
+}
+
+// @brief 入力を反転させた時の WSA の差分を計算する．
+// @param[in] flip_list 反転させる入力番号のリスト
+// @return 現在の状態の WSA からの増分を返す．
+//
+// ここでは反転させた入力値で WSA 全体を計算し直している．
+int
+Fsim3::delta_wsa(const vector<ymuint>& flip_list)
+{
+  ASSERT_COND( mWsaFlipList.empty() );
+
+  mWsaFlipList = flip_list;
+  for (ymuint i = 0; i < flip_list.size(); ++ i) {
+    ymuint pos = flip_list[i];
+    mWsaInput[pos] = ~mWsaInput[pos];
+  }
+
+  ymuint npi = mWsaInput.size();
+  for (ymuint i = 0; i < npi; ++ i) {
+    SimNode* simnode = mInputArray[i];
+    switch ( mWsaInput[i] ) {
+    case kVal0:
+      simnode->set_gval(kPvwAll1, kPvwAll0);
+      break;
+
+    case kVal1:
+      simnode->set_gval(kPvwAll0, kPvwAll1);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+  vector<ymuint> wsa_array;
+  _calc_wsa(1, wsa_array);
+  mWsaNewVal = wsa_array[0];
+
+  return static_cast<int>(mWsaNewVal) - static_cast<int>(mWsaVal);
+}
+
+// @brief 直前の delta_wsa() の結果を確定させる．
+void
+Fsim3::commit_wsa()
+{
+  mWsaVal = mWsaNewVal;
+  mWsaFlipList.clear();
+}
+
+// @brief 直前の delta_wsa() の結果を取り消す．
+void
+Fsim3::rollback_wsa()
+{
+  for (ymuint i = 0; i < mWsaFlipList.size(); ++ i) {
+    ymuint pos = mWsaFlipList[i];
+    mWsaInput[pos] = ~mWsaInput[pos];
+  }
+  mWsaNewVal = mWsaVal;
+  mWsaFlipList.clear();
 }
 
 END_NAMESPACE_YM_SATPG_FSIM
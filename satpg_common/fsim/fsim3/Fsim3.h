@@ -11,9 +11,10 @@
 
 
 #include "fsim3_nsdef.h"
-#include "Fsim.h"
-#include "PackedVal.h"
+#include "FsimBase.h"
+#include "PackedValW.h"
 #include "EventQ.h"
+#include "GvalKernel.h"
 #include "SimFault.h"
 #include "TpgNode.h"
 
@@ -29,7 +30,7 @@ class SimNode;
 /// @sa ModBase
 //////////////////////////////////////////////////////////////////////
 class Fsim3 :
-  public Fsim
+  public FsimBase
 {
 public:
 
@@ -52,18 +53,13 @@ public:
   void
   set_network(const TpgNetwork& network);
 
-  /// @brief 故障にスキップマークをつける．
-  virtual
-  void
-  set_skip(const TpgFault* f);
-
-  /// @brief 故障リストを設定する．
-  /// @param[in] fault_list 対象の故障リスト
+  /// @brief ppsfp() で用いるスレッド数を設定する．
+  /// @param[in] num スレッド数(0 の場合はハードウェアの並列度)
   ///
-  /// スキップマークは消される．
+  /// このクラスは並列化に対応していないので何もしない．
   virtual
   void
-  set_faults(const vector<const TpgFault*>& fault_list);
+  set_thread_num(ymuint num);
 
   /// @brief SPSFP故障シミュレーションを行う．
   /// @param[in] tv テストベクタ
@@ -109,18 +105,97 @@ public:
   ppsfp(const vector<TestVector*>& tv_array,
 	FsimOp& op);
 
+  /// @brief 複数のパタンで故障シミュレーションを行う．
+  /// @param[in] assign_list_array 値の割当リストの配列
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  virtual
+  void
+  ppsfp(const vector<NodeValList>& assign_list_array,
+	FsimOp& op);
+
+  /// @brief 複数のパタンで故障シミュレーションを行う．
+  /// @param[in] tv_store テストベクタを保持するオブジェクト
+  /// @param[in] blk ブロック番号
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  virtual
+  void
+  ppsfp(const TvStore& tv_store,
+	ymuint blk,
+	FsimOp& op);
+
   /// @brief WSA を計算する．
   /// @param[in] tv テストベクタ
   virtual
   ymuint
   calc_wsa(TestVector* tv);
 
+  /// @brief 複数のパタンの WSA を計算する．
+  /// @param[in] tv_array テストベクタの配列
+  /// @param[out] wsa_array 各パタンの WSA を格納する配列
+  virtual
+  void
+  calc_wsa(const vector<TestVector*>& tv_array,
+	   vector<ymuint>& wsa_array);
+
+  /// @brief 差分 WSA 計算用の状態を初期化する．
+  /// @param[in] tv 基準となるテストベクタ
+  /// @return tv の WSA を返す．
+  virtual
+  ymuint
+  init_wsa(TestVector* tv);
+
+  /// @brief 入力を反転させた時の WSA の差分を計算する．
+  /// @param[in] flip_list 反転させる入力番号のリスト
+  /// @return 現在の状態の WSA からの増分を返す．
+  virtual
+  int
+  delta_wsa(const vector<ymuint>& flip_list);
+
+  /// @brief 直前の delta_wsa() の結果を確定させる．
+  virtual
+  void
+  commit_wsa();
+
+  /// @brief 直前の delta_wsa() の結果を取り消す．
+  virtual
+  void
+  rollback_wsa();
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // FsimBase の仮想関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 故障リストを設定する．
+  /// @param[in] fault_list 対象の故障リスト
+  ///
+  /// スキップマークは消される．
+  virtual
+  void
+  _set_faults(const vector<const TpgFault*>& fault_list);
+
+  /// @brief 故障にスキップマークをつける．
+  virtual
+  void
+  _set_skip(const TpgFault* f);
+
+  /// @brief 故障リストに含まれる故障のスキップマークを消す．
+  virtual
+  void
+  _clear_skip(const TpgFault* f);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
   // 内部で用いられる下請け関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief tv_array の値を外部入力にセットする．
+  /// @param[in] tv_array テストベクタの配列
+  void
+  set_tv_array(const vector<TestVector*>& tv_array);
+
   /// @brief SPSFP故障シミュレーションの本体
   /// @param[in] f 対象の故障
   /// @retval true 故障の検出が行えた．
@@ -133,6 +208,22 @@ private:
   void
   _sppfp(FsimOp& op);
 
+  /// @brief PPSFP故障シミュレーションの本体
+  /// @param[in] nb パタン数
+  /// @param[in] op 検出した時に起動されるファンクタオブジェクト
+  void
+  _ppsfp(ymuint nb,
+	 FsimOp& op);
+
+  /// @brief WSA の計算の本体
+  /// @param[in] nb パタン数
+  /// @param[out] wsa_array 各パタンの WSA を格納する配列
+  ///
+  /// 外部入力の値はあらかじめ設定されている必要がある．
+  void
+  _calc_wsa(ymuint nb,
+	    vector<ymuint>& wsa_array);
+
   /// @brief FFR 内の故障シミュレーションを行う．
   /// @param[in] ffr 対象のFFR
   ///
@@ -142,26 +233,25 @@ private:
   ///
   /// 故障は SimFFR::fault_list() に格納されているが，
   /// スキップフラグが立った故障はリストから取り除かれる．
-  PackedVal
+  PackedValW
   ffr_simulate(SimFFR* ffr);
 
   /// @brief 正常値の計算を行う．
-  /// @note 値の変わったノードは mGvalClearArray に積まれる．
+  ///
+  /// 外部入力の値はあらかじめ設定されている必要がある．
   void
   calc_gval();
 
-  /// @brief 正常値が更新されたときの処理を行なう．
-  void
-  update_gval(SimNode* node);
-
   /// @brief 正常値をクリアする．
-  /// @note mGvalClearArray を使う．
+  ///
+  /// 外部入力の値を X に戻す．
+  /// 論理ノードの値は次の calc_gval() で全て計算し直される．
   void
   clear_gval();
 
   /// @brief 故障値の計算を行う．
   /// @note この関数を抜けた時点で故障値はクリアされている．
-  PackedVal
+  PackedValW
   calc_fval();
 
   /// @brief 故障値が更新されたときの処理を行なう．
@@ -227,11 +317,11 @@ private:
   // FFR を納めた配列
   vector<SimFFR> mFFRArray;
 
-  // イベントキュー
-  EventQ mEventQ;
+  // 値の配列と平坦化された回路構造を持つカーネル
+  GvalKernel mKernel;
 
-  // 正常値を消去する必要のあるノードを入れておく配列
-  vector<SimNode*> mGvalClearArray;
+  // 故障値計算用のイベントキュー
+  EventQ mEventQ;
 
   // 故障値を消去する必要のあるノードを入れておく配列
   vector<SimNode*> mFvalClearArray;
@@ -242,6 +332,18 @@ private:
   // TpgFault::id() をキーにして SimFault を格納する配列
   vector<SimFault*> mFaultArray;
 
+  // 差分 WSA 計算用の入力値の配列
+  vector<Val3> mWsaInput;
+
+  // mWsaInput に対する WSA
+  ymuint mWsaVal;
+
+  // 直前の delta_wsa() で求めた WSA
+  ymuint mWsaNewVal;
+
+  // 直前の delta_wsa() で反転させた入力番号のリスト
+  vector<ymuint> mWsaFlipList;
+
 };
 
 
@@ -249,19 +351,8 @@ private:
 // インライン関数の定義
 //////////////////////////////////////////////////////////////////////
 
-// @brief 正常値が更新されたときの処理を行なう．
-inline
-void
-Fsim3::update_gval(SimNode* node)
-{
-  mGvalClearArray.push_back(node);
-  ymuint no = node->nfo();
-  for (ymuint i = 0; i < no; ++ i) {
-    mEventQ.put(node->fanout(i));
-  }
-}
-
 // @brief 故障値が更新されたときの処理を行なう．
+inline
 void
 Fsim3::update_fval(SimNode* node)
 {
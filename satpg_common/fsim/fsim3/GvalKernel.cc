@@ -0,0 +1,120 @@
+﻿/// @file GvalKernel.cc
+/// @brief GvalKernel の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "GvalKernel.h"
+#include "SimNode.h"
+#include <algorithm>
+
+
+BEGIN_NAMESPACE_YM_SATPG_FSIM
+
+//////////////////////////////////////////////////////////////////////
+// クラス GvalKernel
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+GvalKernel::GvalKernel()
+{
+}
+
+// @brief デストラクタ
+GvalKernel::~GvalKernel()
+{
+}
+
+// @brief 初期化する．
+// @param[in] node_array 全ての SimNode の配列(ID番号順)
+// @param[in] logic_array 論理ノードの配列(トポロジカル順)
+//
+// 各 SimNode に値の格納場所を設定する．
+// 値は全て X に初期化される．
+void
+GvalKernel::init(const vector<SimNode*>& node_array,
+		 const vector<SimNode*>& logic_array)
+{
+  clear();
+
+  ymuint nn = node_array.size();
+  mGval0Array.resize(nn, kPvwAll0);
+  mGval1Array.resize(nn, kPvwAll0);
+  mFval0Array.resize(nn, kPvwAll0);
+  mFval1Array.resize(nn, kPvwAll0);
+  mPosArray.resize(nn, 0);
+  for (ymuint i = 0; i < nn; ++ i) {
+    SimNode* node = node_array[i];
+    ASSERT_COND( node->id() == i );
+    node->set_val_ptr(&mGval0Array[i], &mGval1Array[i],
+		      &mFval0Array[i], &mFval1Array[i]);
+  }
+
+  ymuint nl = logic_array.size();
+  mTypeArray.reserve(nl);
+  mIdArray.reserve(nl);
+  mFaninPos.reserve(nl + 1);
+  mFaninPos.push_back(0);
+  for (ymuint i = 0; i < nl; ++ i) {
+    SimNode* node = logic_array[i];
+    OpType type = kOpBuff;
+    switch ( node->gate_type() ) {
+    case kGateBUFF: type = kOpBuff; break;
+    case kGateNOT:  type = kOpNot;  break;
+    case kGateAND:  type = kOpAnd;  break;
+    case kGateNAND: type = kOpNand; break;
+    case kGateOR:   type = kOpOr;   break;
+    case kGateNOR:  type = kOpNor;  break;
+    case kGateXOR:  type = kOpXor;  break;
+    case kGateXNOR: type = kOpXnor; break;
+    default: ASSERT_NOT_REACHED;
+    }
+    mTypeArray.push_back(type);
+    mIdArray.push_back(node->id());
+    mPosArray[node->id()] = i;
+    ymuint ni = node->nfi();
+    for (ymuint j = 0; j < ni; ++ j) {
+      mFaninArray.push_back(node->fanin(j)->id());
+    }
+    mFaninPos.push_back(mFaninArray.size());
+  }
+}
+
+// @brief 内容をクリアする．
+void
+GvalKernel::clear()
+{
+  mTypeArray.clear();
+  mIdArray.clear();
+  mFaninPos.clear();
+  mFaninArray.clear();
+  mPosArray.clear();
+  mGval0Array.clear();
+  mGval1Array.clear();
+  mFval0Array.clear();
+  mFval1Array.clear();
+}
+
+// @brief 全ての論理ノードの正常値を計算する．
+//
+// 外部入力の値はあらかじめ設定されている必要がある．
+// 計算後，全ノードの故障値は正常値と等しくなる．
+void
+GvalKernel::calc_gval()
+{
+  PackedValW* gval0 = mGval0Array.data();
+  PackedValW* gval1 = mGval1Array.data();
+  ymuint nl = mTypeArray.size();
+  for (ymuint i = 0; i < nl; ++ i) {
+    ymuint id = mIdArray[i];
+    eval(i, gval0, gval1, gval0[id], gval1[id]);
+  }
+
+  // 故障値を正常値に揃えておく．
+  std::copy(mGval0Array.begin(), mGval0Array.end(), mFval0Array.begin());
+  std::copy(mGval1Array.begin(), mGval1Array.end(), mFval1Array.begin());
+}
+
+END_NAMESPACE_YM_SATPG_FSIM
@@ -0,0 +1,261 @@
+﻿#ifndef FSIM3_GVALKERNEL_H
+#define FSIM3_GVALKERNEL_H
+
+/// @file GvalKernel.h
+/// @brief GvalKernel のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2005-2010, 2012-2014 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "fsim3_nsdef.h"
+#include "PackedValW.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG_FSIM
+
+class SimNode;
+
+//////////////////////////////////////////////////////////////////////
+/// @class GvalKernel GvalKernel.h "GvalKernel.h"
+/// @brief 3値の正常値計算用の平坦化されたシミュレーションカーネル
+///
+/// 論理ノードをトポロジカル順に並べ，ゲートの種類とファンインの
+/// 番号を連続した配列に持つ．
+/// 値は 0 のビットと 1 のビットを別々の配列に持つ2線式で表し
+/// (どちらも立っていないビットが X)，ノード番号順に並べる．
+/// SimNode はその要素へのポインタを通してアクセスする．
+/// 正常値の計算は仮想関数やポインタをたどらずに行える．
+//////////////////////////////////////////////////////////////////////
+class GvalKernel
+{
+public:
+
+  /// @brief コンストラクタ
+  GvalKernel();
+
+  /// @brief デストラクタ
+  ~GvalKernel();
+
+
+public:
+
+  /// @brief 初期化する．
+  /// @param[in] node_array 全ての SimNode の配列(ID番号順)
+  /// @param[in] logic_array 論理ノードの配列(トポロジカル順)
+  ///
+  /// 各 SimNode に値の格納場所を設定する．
+  /// 値は全て X に初期化される．
+  void
+  init(const vector<SimNode*>& node_array,
+       const vector<SimNode*>& logic_array);
+
+  /// @brief 内容をクリアする．
+  void
+  clear();
+
+  /// @brief 全ての論理ノードの正常値を計算する．
+  ///
+  /// 外部入力の値はあらかじめ設定されている必要がある．
+  /// 計算後，全ノードの故障値は正常値と等しくなる．
+  void
+  calc_gval();
+
+  /// @brief 論理ノードの故障値を計算する．
+  /// @param[in] id ノード番号
+  /// @param[in] mask 値を更新するビットのマスク
+  /// @return 故障差を返す．
+  ///
+  /// ファンインの故障値から計算した値のうち mask のビットだけを
+  /// 故障値に書き込む．
+  PackedValW
+  calc_fval(ymuint id,
+	    const PackedValW& mask);
+
+  /// @brief ノード数を返す．
+  ymuint
+  node_num() const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // ゲートの種類を表す列挙型
+  enum OpType {
+    kOpBuff,
+    kOpNot,
+    kOpAnd,
+    kOpNand,
+    kOpOr,
+    kOpNor,
+    kOpXor,
+    kOpXnor
+  };
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief pos 番めの論理ノードの値を計算する．
+  /// @param[in] pos 論理ノードの位置(トポロジカル順)
+  /// @param[in] val0_array, val1_array 値の配列(ID番号順)
+  /// @param[out] val0, val1 計算結果
+  void
+  eval(ymuint pos,
+       const PackedValW* val0_array,
+       const PackedValW* val1_array,
+       PackedValW& val0,
+       PackedValW& val1) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 論理ノードのゲートの種類の配列
+  vector<ymuint8> mTypeArray;
+
+  // 論理ノードのID番号の配列
+  vector<ymuint32> mIdArray;
+
+  // mFaninArray 中の各ノードのファンインの開始位置
+  // 要素数は論理ノード数 + 1
+  vector<ymuint32> mFaninPos;
+
+  // 全論理ノードのファンインのID番号を並べた配列
+  vector<ymuint32> mFaninArray;
+
+  // ID番号をキーにして論理ノードの位置を入れる配列
+  // 外部入力の場合は意味を持たない．
+  vector<ymuint32> mPosArray;
+
+  // 正常値の 0 のビットの配列(ID番号順)
+  vector<PackedValW> mGval0Array;
+
+  // 正常値の 1 のビットの配列(ID番号順)
+  vector<PackedValW> mGval1Array;
+
+  // 故障値の 0 のビットの配列(ID番号順)
+  vector<PackedValW> mFval0Array;
+
+  // 故障値の 1 のビットの配列(ID番号順)
+  vector<PackedValW> mFval1Array;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief ノード数を返す．
+inline
+ymuint
+GvalKernel::node_num() const
+{
+  return mGval0Array.size();
+}
+
+// @brief 論理ノードの故障値を計算する．
+// @param[in] id ノード番号
+// @param[in] mask 値を更新するビットのマスク
+// @return 故障差を返す．
+inline
+PackedValW
+GvalKernel::calc_fval(ymuint id,
+		      const PackedValW& mask)
+{
+  PackedValW val0;
+  PackedValW val1;
+  eval(mPosArray[id], mFval0Array.data(), mFval1Array.data(), val0, val1);
+
+  PackedValW& fval0 = mFval0Array[id];
+  PackedValW& fval1 = mFval1Array[id];
+  fval0 = (fval0 & ~mask) | (val0 & mask);
+  fval1 = (fval1 & ~mask) | (val1 & mask);
+  return (mGval0Array[id] ^ fval0) | (mGval1Array[id] ^ fval1);
+}
+
+// @brief pos 番めの論理ノードの値を計算する．
+// @param[in] pos 論理ノードの位置(トポロジカル順)
+// @param[in] val0_array, val1_array 値の配列(ID番号順)
+// @param[out] val0, val1 計算結果
+//
+// NAND/NOR/XNOR は否定をとらない形で計算して最後に 0 と 1 を入れ替える．
+inline
+void
+GvalKernel::eval(ymuint pos,
+		 const PackedValW* val0_array,
+		 const PackedValW* val1_array,
+		 PackedValW& val0,
+		 PackedValW& val1) const
+{
+  const ymuint32* fanins = mFaninArray.data() + mFaninPos[pos];
+  ymuint ni = mFaninPos[pos + 1] - mFaninPos[pos];
+  PackedValW v0 = val0_array[fanins[0]];
+  PackedValW v1 = val1_array[fanins[0]];
+  bool inv = false;
+  switch ( mTypeArray[pos] ) {
+  case kOpBuff:
+    break;
+
+  case kOpNot:
+    inv = true;
+    break;
+
+  case kOpNand:
+    inv = true;
+    // わざと次に続く
+
+  case kOpAnd:
+    for (ymuint j = 1; j < ni; ++ j) {
+      v0 |= val0_array[fanins[j]];
+      v1 &= val1_array[fanins[j]];
+    }
+    break;
+
+  case kOpNor:
+    inv = true;
+    // わざと次に続く
+
+  case kOpOr:
+    for (ymuint j = 1; j < ni; ++ j) {
+      v0 &= val0_array[fanins[j]];
+      v1 |= val1_array[fanins[j]];
+    }
+    break;
+
+  case kOpXnor:
+    inv = true;
+    // わざと次に続く
+
+  case kOpXor:
+    for (ymuint j = 1; j < ni; ++ j) {
+      PackedValW i0 = val0_array[fanins[j]];
+      PackedValW i1 = val1_array[fanins[j]];
+      PackedValW n0 = (v0 & i0) | (v1 & i1);
+      PackedValW n1 = (v0 & i1) | (v1 & i0);
+      v0 = n0;
+      v1 = n1;
+    }
+    break;
+  }
+  if ( inv ) {
+    val0 = v1;
+    val1 = v0;
+  }
+  else {
+    val0 = v0;
+    val1 = v1;
+  }
+}
+
+END_NAMESPACE_YM_SATPG_FSIM
+
+#endif // FSIM3_GVALKERNEL_H
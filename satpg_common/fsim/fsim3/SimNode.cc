@@ -23,12 +23,17 @@ BEGIN_NAMESPACE_YM_SATPG_FSIM
 
 // コンストラクタ
 SimNode::SimNode(ymuint32 id) :
+  mGval0Ptr(nullptr),
+  mGval1Ptr(nullptr),
+  mFval0Ptr(nullptr),
+  mFval1Ptr(nullptr),
   mId(id),
   mNfo(0),
   mFanouts(nullptr),
   mFanoutIpos(0),
   mFFR(nullptr),
-  mLevel(0)
+  mLevel(0),
+  mFmask(kPvwAll1)
 {
 }
 
@@ -150,11 +155,11 @@ SimNode::set_fanout_list(const vector<SimNode*>& fo_list,
 }
 
 // @brief ローカルな obs の計算を行う．
-PackedVal
+PackedValW
 SimNode::calc_lobs()
 {
   if ( is_ffr_root() ) {
-    return kPvAll1;
+    return kPvwAll1;
   }
   if ( !check_lobs() ) {
     SimNode* onode = fanout(0);
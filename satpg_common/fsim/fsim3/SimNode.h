@@ -11,7 +11,7 @@
 
 #include "fsim3_nsdef.h"
 #include "EqElem.h"
-#include "PackedVal.h"
+#include "PackedValW.h"
 #include "TpgNode.h"
 
 
@@ -63,6 +63,11 @@ public:
   ymuint32
   id() const;
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const = 0;
+
   /// @brief ファンイン数を得る．
   virtual
   ymuint
@@ -112,33 +117,37 @@ public:
   /// @note 通常は外部入力に対して行われる．
   /// @note 故障値も同様にセットされる．
   void
-  set_gval(PackedVal val_0,
-	   PackedVal val_1);
+  set_gval(PackedValW val_0,
+	   PackedValW val_1);
 
   /// @brief 正常値の 0 パタンを得る．
-  PackedVal
+  PackedValW
   gval_0() const;
 
   /// @brief 正常値の 1 パタンを得る．
-  PackedVal
+  PackedValW
   gval_1() const;
 
   /// @brief 故障値をセットする．(3値版)
   /// @param[in] val_0, val_1 値
   void
-  set_fval(PackedVal val_0,
-	   PackedVal val_1);
+  set_fval(PackedValW val_0,
+	   PackedValW val_1);
 
   /// @brief 故障値のマスクをセットする．
   void
-  set_fmask(PackedVal mask);
+  set_fmask(PackedValW mask);
+
+  /// @brief 故障値のマスクを得る．
+  PackedValW
+  fmask() const;
 
   /// @brief 故障値の 0 パタンを得る．
-  PackedVal
+  PackedValW
   fval_0() const;
 
   /// @brief 故障値の 1 パタンを得る．
-  PackedVal
+  PackedValW
   fval_1() const;
 
   /// @brief 故障値をクリアする．
@@ -155,11 +164,11 @@ public:
   /// @param[in] mask マスク
   /// @return 故障差を返す．
   /// @note 結果は mFval にセットされる．
-  PackedVal
-  calc_fval3(PackedVal mask);
+  PackedValW
+  calc_fval3(PackedValW mask);
 
   /// @brief ローカルな obs の計算を行う．
-  PackedVal
+  PackedValW
   calc_lobs();
 
   /// @brief lobs が計算済みかチェックする．
@@ -193,6 +202,15 @@ public:
   void
   set_ffr(SimFFR* ffr);
 
+  /// @brief 正常値と故障値の格納場所を設定する．
+  /// @param[in] gval0_ptr, gval1_ptr 正常値の格納場所
+  /// @param[in] fval0_ptr, fval1_ptr 故障値の格納場所
+  void
+  set_val_ptr(PackedValW* gval0_ptr,
+	      PackedValW* gval1_ptr,
+	      PackedValW* fval0_ptr,
+	      PackedValW* fval1_ptr);
+
 
 public:
   //////////////////////////////////////////////////////////////////////
@@ -210,11 +228,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask) = 0;
+  _calc_fval3(PackedValW mask) = 0;
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos) = 0;
 
   /// @brief 内容をダンプする．
@@ -232,17 +250,17 @@ protected:
 
 protected:
 
-  // 正常値0
-  PackedVal mGval0;
+  // 正常値0の格納場所(GvalKernel 内の配列の要素)
+  PackedValW* mGval0Ptr;
 
-  // 正常値1
-  PackedVal mGval1;
+  // 正常値1の格納場所(GvalKernel 内の配列の要素)
+  PackedValW* mGval1Ptr;
 
-  // 故障値0
-  PackedVal mFval0;
+  // 故障値0の格納場所(GvalKernel 内の配列の要素)
+  PackedValW* mFval0Ptr;
 
-  // 故障値1
-  PackedVal mFval1;
+  // 故障値1の格納場所(GvalKernel 内の配列の要素)
+  PackedValW* mFval1Ptr;
 
 
 private:
@@ -269,10 +287,10 @@ private:
   ymuint32 mLevel;
 
   // FFR 内のローカルな obs
-  PackedVal mLobs;
+  PackedValW mLobs;
 
   // 故障値に対するマスク
-  PackedVal mFmask;
+  PackedValW mFmask;
 
 };
 
@@ -375,65 +393,73 @@ SimNode::clear_lobs()
 // @note 故障値も同様にセットされる．
 inline
 void
-SimNode::set_gval(PackedVal val_0,
-		  PackedVal val_1)
+SimNode::set_gval(PackedValW val_0,
+		  PackedValW val_1)
 {
-  mGval0 = val_0;
-  mGval1 = val_1;
-  mFval0 = val_0;
-  mFval1 = val_1;
-  mFmask = kPvAll1;
+  *mGval0Ptr = val_0;
+  *mGval1Ptr = val_1;
+  *mFval0Ptr = val_0;
+  *mFval1Ptr = val_1;
+  mFmask = kPvwAll1;
 }
 
 // @brief 正常値の 0 パタンを得る．
 inline
-PackedVal
+PackedValW
 SimNode::gval_0() const
 {
-  return mGval0;
+  return *mGval0Ptr;
 }
 
 // @brief 正常値の 1 パタンを得る．
 inline
-PackedVal
+PackedValW
 SimNode::gval_1() const
 {
-  return mGval1;
+  return *mGval1Ptr;
 }
 
 // @brief 故障値をセットする．(3値版)
 // @param[in] val_0, val_1 値
 inline
 void
-SimNode::set_fval(PackedVal val_0,
-		  PackedVal val_1)
+SimNode::set_fval(PackedValW val_0,
+		  PackedValW val_1)
 {
-  mFval0 = val_0;
-  mFval1 = val_1;
+  *mFval0Ptr = val_0;
+  *mFval1Ptr = val_1;
 }
 
 // @brief 故障値のマスクをセットする．
 inline
 void
-SimNode::set_fmask(PackedVal mask)
+SimNode::set_fmask(PackedValW mask)
 {
   mFmask = mask;
 }
 
+// @brief 故障値のマスクを得る．
+inline
+PackedValW
+SimNode::fmask() const
+{
+  return mFmask;
+}
+
 // @brief 故障値の 0 パタンを得る．
 inline
-PackedVal
+PackedValW
 SimNode::fval_0() const
 {
-  return mFval0;
+  return *mFval0Ptr;
 }
 
 // @brief 故障値の 1 パタンを得る．
 inline
-PackedVal
+PackedValW
 SimNode::fval_1() const
 {
-  return mFval1;
+  return *mFval1Ptr;
 }
 
 // @brief 故障値をクリアする．
@@ -441,9 +467,9 @@ inline
 void
 SimNode::clear_fval()
 {
-  mFval0 = mGval0;
-  mFval1 = mGval1;
-  mFmask = kPvAll1;
+  *mFval0Ptr = *mGval0Ptr;
+  *mFval1Ptr = *mGval1Ptr;
+  mFmask = kPvwAll1;
 }
 
 // @brief 正常値の計算を行う．(3値版)
@@ -454,20 +480,20 @@ bool
 SimNode::calc_gval3()
 {
   _calc_gval3();
-  mFval0 = mGval0;
-  mFval1 = mGval1;
-  return (mGval0 | mGval1) != kPvAll0;
+  *mFval0Ptr = *mGval0Ptr;
+  *mFval1Ptr = *mGval1Ptr;
+  return (*mGval0Ptr | *mGval1Ptr) != kPvwAll0;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @return 故障差を返す．
 // @note 結果は mFval にセットされる．
 inline
-PackedVal
-SimNode::calc_fval3(PackedVal mask)
+PackedValW
+SimNode::calc_fval3(PackedValW mask)
 {
   _calc_fval3(mFmask & mask);
-  return (mGval0 ^ mFval0) | (mGval1 ^ mFval1);
+  return (*mGval0Ptr ^ *mFval0Ptr) | (*mGval1Ptr ^ *mFval1Ptr);
 }
 
 // @brief FFR を設定する．
@@ -478,6 +504,22 @@ SimNode::set_ffr(SimFFR* ffr)
   mFFR = ffr;
 }
 
+// @brief 正常値と故障値の格納場所を設定する．
+// @param[in] gval0_ptr, gval1_ptr 正常値の格納場所
+// @param[in] fval0_ptr, fval1_ptr 故障値の格納場所
+inline
+void
+SimNode::set_val_ptr(PackedValW* gval0_ptr,
+		     PackedValW* gval1_ptr,
+		     PackedValW* fval0_ptr,
+		     PackedValW* fval1_ptr)
+{
+  mGval0Ptr = gval0_ptr;
+  mGval1Ptr = gval1_ptr;
+  mFval0Ptr = fval0_ptr;
+  mFval1Ptr = fval1_ptr;
+}
+
 END_NAMESPACE_YM_SATPG_FSIM
 
 #endif // SIMNODE_H
@@ -28,43 +28,50 @@ SnAnd::~SnAnd()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnAnd::gate_type() const
+{
+  return kGateAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnAnd::_calc_gval3()
 {
-  PackedVal val0 = mFanins[0]->gval_0();
-  PackedVal val1 = mFanins[0]->gval_1();
+  PackedValW val0 = mFanins[0]->gval_0();
+  PackedValW val1 = mFanins[0]->gval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 |= mFanins[i]->gval_0();
     val1 &= mFanins[i]->gval_1();
   }
-  mGval0 = val0;
-  mGval1 = val1;
+  *mGval0Ptr = val0;
+  *mGval1Ptr = val1;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnAnd::_calc_fval3(PackedVal mask)
+SnAnd::_calc_fval3(PackedValW mask)
 {
-  PackedVal val0 = mFanins[0]->fval_0();
-  PackedVal val1 = mFanins[0]->fval_1();
+  PackedValW val0 = mFanins[0]->fval_0();
+  PackedValW val1 = mFanins[0]->fval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 |= mFanins[i]->fval_0();
     val1 &= mFanins[i]->fval_1();
   }
-  mFval0 &= ~mask;
-  mFval0 |= val0 & mask;
-  mFval1 &= ~mask;
-  mFval1 |= val1 & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= val0 & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= val1 & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnAnd::calc_gobs3(ymuint ipos)
 {
-  PackedVal obs = kPvAll1;
+  PackedValW obs = kPvwAll1;
   for (ymuint i = 0; i < ipos; ++ i) {
     obs &= mFanins[i]->gval_1();
   }
@@ -102,28 +109,35 @@ SnAnd2::~SnAnd2()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnAnd2::gate_type() const
+{
+  return kGateAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnAnd2::_calc_gval3()
 {
-  mGval0 = mFanins[0]->gval_0() | mFanins[1]->gval_0();
-  mGval1 = mFanins[0]->gval_1() & mFanins[1]->gval_1();
+  *mGval0Ptr = mFanins[0]->gval_0() | mFanins[1]->gval_0();
+  *mGval1Ptr = mFanins[0]->gval_1() & mFanins[1]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnAnd2::_calc_fval3(PackedVal mask)
+SnAnd2::_calc_fval3(PackedValW mask)
 {
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_0() | mFanins[1]->fval_0()) & mask;
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_1() & mFanins[1]->fval_1()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_0() | mFanins[1]->fval_0()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_1() & mFanins[1]->fval_1()) & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnAnd2::calc_gobs3(ymuint ipos)
 {
   return mFanins[ipos ^ 1]->gval_1();
@@ -155,28 +169,35 @@ SnAnd3::~SnAnd3()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnAnd3::gate_type() const
+{
+  return kGateAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnAnd3::_calc_gval3()
 {
-  mGval0 = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0();
-  mGval1 = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1();
+  *mGval0Ptr = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0();
+  *mGval1Ptr = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnAnd3::_calc_fval3(PackedVal mask)
+SnAnd3::_calc_fval3(PackedValW mask)
 {
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0()) & mask;
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1()) & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnAnd3::calc_gobs3(ymuint ipos)
 {
   ymuint idx1 = 0;
@@ -202,8 +223,8 @@ SnAnd3::calc_gobs3(ymuint ipos)
     break;
   }
 
-  PackedVal pat0 = mFanins[idx1]->gval_1();
-  PackedVal pat1 = mFanins[idx2]->gval_1();
+  PackedValW pat0 = mFanins[idx1]->gval_1();
+  PackedValW pat1 = mFanins[idx2]->gval_1();
   return pat0 & pat1;
 }
 
@@ -234,28 +255,35 @@ SnAnd4::~SnAnd4()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnAnd4::gate_type() const
+{
+  return kGateAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnAnd4::_calc_gval3()
 {
-  mGval0 = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0() | mFanins[3]->gval_0();
-  mGval1 = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1() & mFanins[3]->gval_1();
+  *mGval0Ptr = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0() | mFanins[3]->gval_0();
+  *mGval1Ptr = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1() & mFanins[3]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnAnd4::_calc_fval3(PackedVal mask)
+SnAnd4::_calc_fval3(PackedValW mask)
 {
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0() | mFanins[3]->fval_0()) & mask;
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1() & mFanins[3]->fval_1()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0() | mFanins[3]->fval_0()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1() & mFanins[3]->fval_1()) & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnAnd4::calc_gobs3(ymuint ipos)
 {
   ymuint idx1 = 0;
@@ -287,9 +315,9 @@ SnAnd4::calc_gobs3(ymuint ipos)
     break;
 
   }
-  PackedVal pat0 = mFanins[idx1]->gval_1();
-  PackedVal pat1 = mFanins[idx2]->gval_1();
-  PackedVal pat2 = mFanins[idx3]->gval_1();
+  PackedValW pat0 = mFanins[idx1]->gval_1();
+  PackedValW pat1 = mFanins[idx2]->gval_1();
+  PackedValW pat2 = mFanins[idx3]->gval_1();
   return pat0 & pat1 & pat2;
 }
 
@@ -321,36 +349,43 @@ SnNand::~SnNand()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNand::gate_type() const
+{
+  return kGateNAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNand::_calc_gval3()
 {
-  PackedVal val0 = mFanins[0]->gval_0();
-  PackedVal val1 = mFanins[0]->gval_1();
+  PackedValW val0 = mFanins[0]->gval_0();
+  PackedValW val1 = mFanins[0]->gval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 |= mFanins[i]->gval_0();
     val1 &= mFanins[i]->gval_1();
   }
-  mGval0 = val1;
-  mGval1 = val0;
+  *mGval0Ptr = val1;
+  *mGval1Ptr = val0;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNand::_calc_fval3(PackedVal mask)
+SnNand::_calc_fval3(PackedValW mask)
 {
-  PackedVal val0 = mFanins[0]->fval_0();
-  PackedVal val1 = mFanins[0]->fval_1();
+  PackedValW val0 = mFanins[0]->fval_0();
+  PackedValW val1 = mFanins[0]->fval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 |= mFanins[i]->fval_0();
     val1 &= mFanins[i]->fval_1();
   }
-  mFval0 &= ~mask;
-  mFval0 |= val1 & mask;
-  mFval1 &= ~mask;
-  mFval1 |= val0 & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= val1 & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= val0 & mask;
 }
 
 // @brief 内容をダンプする．
@@ -381,24 +416,31 @@ SnNand2::~SnNand2()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNand2::gate_type() const
+{
+  return kGateNAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNand2::_calc_gval3()
 {
-  mGval1 = mFanins[0]->gval_0() | mFanins[1]->gval_0();
-  mGval0 = mFanins[0]->gval_1() & mFanins[1]->gval_1();
+  *mGval1Ptr = mFanins[0]->gval_0() | mFanins[1]->gval_0();
+  *mGval0Ptr = mFanins[0]->gval_1() & mFanins[1]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNand2::_calc_fval3(PackedVal mask)
+SnNand2::_calc_fval3(PackedValW mask)
 {
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_0() | mFanins[1]->fval_0()) & mask;
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_1() & mFanins[1]->fval_1()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_0() | mFanins[1]->fval_0()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_1() & mFanins[1]->fval_1()) & mask;
 }
 
 // @brief 内容をダンプする．
@@ -427,24 +469,31 @@ SnNand3::~SnNand3()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNand3::gate_type() const
+{
+  return kGateNAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNand3::_calc_gval3()
 {
-  mGval1 = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0();
-  mGval0 = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1();
+  *mGval1Ptr = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0();
+  *mGval0Ptr = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNand3::_calc_fval3(PackedVal mask)
+SnNand3::_calc_fval3(PackedValW mask)
 {
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0()) & mask;
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1()) & mask;
 }
 
 // @brief 内容をダンプする．
@@ -474,24 +523,31 @@ SnNand4::~SnNand4()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNand4::gate_type() const
+{
+  return kGateNAND;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNand4::_calc_gval3()
 {
-  mGval1 = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0() | mFanins[3]->gval_0();
-  mGval0 = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1() & mFanins[3]->gval_1();
+  *mGval1Ptr = mFanins[0]->gval_0() | mFanins[1]->gval_0() | mFanins[2]->gval_0() | mFanins[3]->gval_0();
+  *mGval0Ptr = mFanins[0]->gval_1() & mFanins[1]->gval_1() & mFanins[2]->gval_1() & mFanins[3]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNand4::_calc_fval3(PackedVal mask)
+SnNand4::_calc_fval3(PackedValW mask)
 {
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0() | mFanins[3]->fval_0()) & mask;
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1() & mFanins[3]->fval_1()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_0() | mFanins[1]->fval_0() | mFanins[2]->fval_0() | mFanins[3]->fval_0()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_1() & mFanins[1]->fval_1() & mFanins[2]->fval_1() & mFanins[3]->fval_1()) & mask;
 }
 
 // @brief 内容をダンプする．
@@ -28,6 +28,15 @@ SnInput::~SnInput()
 {
 }
 
+// @brief ゲートタイプを返す．
+//
+// ここでは kGateBUFF を返す．
+GateType
+SnInput::gate_type() const
+{
+  return kGateBUFF;
+}
+
 // @brief ファンイン数を得る．
 ymuint
 SnInput::nfi() const
@@ -54,16 +63,16 @@ SnInput::_calc_gval3()
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnInput::_calc_fval3(PackedVal mask)
+SnInput::_calc_fval3(PackedValW mask)
 {
   ASSERT_NOT_REACHED;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnInput::calc_gobs3(ymuint ipos)
 {
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -90,31 +99,38 @@ SnBuff::~SnBuff()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnBuff::gate_type() const
+{
+  return kGateBUFF;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnBuff::_calc_gval3()
 {
-  mGval0 = mFanin->gval_0();
-  mGval1 = mFanin->gval_1();
+  *mGval0Ptr = mFanin->gval_0();
+  *mGval1Ptr = mFanin->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnBuff::_calc_fval3(PackedVal mask)
+SnBuff::_calc_fval3(PackedValW mask)
 {
-  mFval0 &= ~mask;
-  mFval0 |= mFanin->fval_0() & mask;
-  mFval1 &= ~mask;
-  mFval1 |= mFanin->fval_1() & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= mFanin->fval_0() & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= mFanin->fval_1() & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnBuff::calc_gobs3(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -141,24 +157,31 @@ SnNot::~SnNot()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNot::gate_type() const
+{
+  return kGateNOT;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNot::_calc_gval3()
 {
-  mGval1 = mFanin->gval_0();
-  mGval0 = mFanin->gval_1();
+  *mGval1Ptr = mFanin->gval_0();
+  *mGval0Ptr = mFanin->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNot::_calc_fval3(PackedVal mask)
+SnNot::_calc_fval3(PackedValW mask)
 {
-  mFval1 &= ~mask;
-  mFval1 |= mFanin->fval_0() & mask;
-  mFval0 &= ~mask;
-  mFval0 |= mFanin->fval_1() & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= mFanin->fval_0() & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= mFanin->fval_1() & mask;
 }
 
 // @brief 内容をダンプする．
@@ -35,6 +35,13 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  ///
+  /// ここでは kGateBUFF を返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief ファンイン数を得る．
   virtual
   ymuint
@@ -56,11 +63,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -91,6 +98,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -102,11 +114,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -137,6 +149,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -148,7 +165,7 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief 内容をダンプする．
   virtual
@@ -28,43 +28,50 @@ SnOr::~SnOr()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnOr::gate_type() const
+{
+  return kGateOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnOr::_calc_gval3()
 {
-  PackedVal val0 = mFanins[0]->gval_0();
-  PackedVal val1 = mFanins[0]->gval_1();
+  PackedValW val0 = mFanins[0]->gval_0();
+  PackedValW val1 = mFanins[0]->gval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 &= mFanins[i]->gval_0();
     val1 |= mFanins[i]->gval_1();
   }
-  mGval0 = val0;
-  mGval1 = val1;
+  *mGval0Ptr = val0;
+  *mGval1Ptr = val1;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnOr::_calc_fval3(PackedVal mask)
+SnOr::_calc_fval3(PackedValW mask)
 {
-  PackedVal val0 = mFanins[0]->fval_0();
-  PackedVal val1 = mFanins[0]->fval_1();
+  PackedValW val0 = mFanins[0]->fval_0();
+  PackedValW val1 = mFanins[0]->fval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 &= mFanins[i]->fval_0();
     val1 |= mFanins[i]->fval_1();
   }
-  mFval0 &= ~mask;
-  mFval0 |= val0 & mask;
-  mFval1 &= ~mask;
-  mFval1 |= val1 & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= val0 & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= val1 & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnOr::calc_gobs3(ymuint ipos)
 {
-  PackedVal obs = kPvAll1;
+  PackedValW obs = kPvwAll1;
   for (ymuint i = 0; i < ipos; ++ i) {
     obs &= mFanins[i]->gval_0();
   }
@@ -103,28 +110,35 @@ SnOr2::~SnOr2()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnOr2::gate_type() const
+{
+  return kGateOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnOr2::_calc_gval3()
 {
-  mGval0 = mFanins[0]->gval_0() & mFanins[1]->gval_0();
-  mGval1 = mFanins[0]->gval_1() | mFanins[1]->gval_1();
+  *mGval0Ptr = mFanins[0]->gval_0() & mFanins[1]->gval_0();
+  *mGval1Ptr = mFanins[0]->gval_1() | mFanins[1]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnOr2::_calc_fval3(PackedVal mask)
+SnOr2::_calc_fval3(PackedValW mask)
 {
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_0() & mFanins[1]->fval_0()) & mask;
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_1() | mFanins[1]->fval_1()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_0() & mFanins[1]->fval_0()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_1() | mFanins[1]->fval_1()) & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnOr2::calc_gobs3(ymuint ipos)
 {
   return mFanins[ipos ^ 1]->gval_0();
@@ -156,28 +170,35 @@ SnOr3::~SnOr3()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnOr3::gate_type() const
+{
+  return kGateOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnOr3::_calc_gval3()
 {
-  mGval0 = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0();
-  mGval1 = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1();
+  *mGval0Ptr = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0();
+  *mGval1Ptr = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnOr3::_calc_fval3(PackedVal mask)
+SnOr3::_calc_fval3(PackedValW mask)
 {
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0()) & mask;
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1()) & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnOr3::calc_gobs3(ymuint ipos)
 {
   ymuint idx1 = 0;
@@ -202,8 +223,8 @@ SnOr3::calc_gobs3(ymuint ipos)
     ASSERT_NOT_REACHED;
     break;
   }
-  PackedVal pat0 = mFanins[idx1]->gval_0();
-  PackedVal pat1 = mFanins[idx2]->gval_0();
+  PackedValW pat0 = mFanins[idx1]->gval_0();
+  PackedValW pat1 = mFanins[idx2]->gval_0();
   return pat0 & pat1;
 }
 
@@ -234,28 +255,35 @@ SnOr4::~SnOr4()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnOr4::gate_type() const
+{
+  return kGateOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnOr4::_calc_gval3()
 {
-  mGval0 = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0() & mFanins[3]->gval_0();
-  mGval1 = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1() | mFanins[3]->gval_1();
+  *mGval0Ptr = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0() & mFanins[3]->gval_0();
+  *mGval1Ptr = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1() | mFanins[3]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnOr4::_calc_fval3(PackedVal mask)
+SnOr4::_calc_fval3(PackedValW mask)
 {
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0() & mFanins[3]->fval_0()) & mask;
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1() | mFanins[3]->fval_1()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0() & mFanins[3]->fval_0()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1() | mFanins[3]->fval_1()) & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnOr4::calc_gobs3(ymuint ipos)
 {
   ymuint idx1 = 0;
@@ -290,9 +318,9 @@ SnOr4::calc_gobs3(ymuint ipos)
     ASSERT_NOT_REACHED;
     break;
   }
-  PackedVal pat0 = mFanins[idx1]->gval_0();
-  PackedVal pat1 = mFanins[idx2]->gval_0();
-  PackedVal pat2 = mFanins[idx3]->gval_0();
+  PackedValW pat0 = mFanins[idx1]->gval_0();
+  PackedValW pat1 = mFanins[idx2]->gval_0();
+  PackedValW pat2 = mFanins[idx3]->gval_0();
   return pat0 & pat1 & pat2;
 }
 
@@ -324,36 +352,43 @@ SnNor::~SnNor()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNor::gate_type() const
+{
+  return kGateNOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNor::_calc_gval3()
 {
-  PackedVal val0 = mFanins[0]->gval_0();
-  PackedVal val1 = mFanins[0]->gval_1();
+  PackedValW val0 = mFanins[0]->gval_0();
+  PackedValW val1 = mFanins[0]->gval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 &= mFanins[i]->gval_0();
     val1 |= mFanins[i]->gval_1();
   }
-  mGval0 = val1;
-  mGval1 = val0;
+  *mGval0Ptr = val1;
+  *mGval1Ptr = val0;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNor::_calc_fval3(PackedVal mask)
+SnNor::_calc_fval3(PackedValW mask)
 {
-  PackedVal val0 = mFanins[0]->fval_0();
-  PackedVal val1 = mFanins[0]->fval_1();
+  PackedValW val0 = mFanins[0]->fval_0();
+  PackedValW val1 = mFanins[0]->fval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
     val0 &= mFanins[i]->fval_0();
     val1 |= mFanins[i]->fval_1();
   }
-  mFval0 &= ~mask;
-  mFval0 |= val1 & mask;
-  mFval1 &= ~mask;
-  mFval1 |= val0 & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= val1 & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= val0 & mask;
 }
 
 // @brief 内容をダンプする．
@@ -384,24 +419,31 @@ SnNor2::~SnNor2()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNor2::gate_type() const
+{
+  return kGateNOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNor2::_calc_gval3()
 {
-  mGval1 = mFanins[0]->gval_0() & mFanins[1]->gval_0();
-  mGval0 = mFanins[0]->gval_1() | mFanins[1]->gval_1();
+  *mGval1Ptr = mFanins[0]->gval_0() & mFanins[1]->gval_0();
+  *mGval0Ptr = mFanins[0]->gval_1() | mFanins[1]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNor2::_calc_fval3(PackedVal mask)
+SnNor2::_calc_fval3(PackedValW mask)
 {
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_0() & mFanins[1]->fval_0()) & mask;
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_1() | mFanins[1]->fval_1()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_0() & mFanins[1]->fval_0()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_1() | mFanins[1]->fval_1()) & mask;
 }
 
 // @brief 内容をダンプする．
@@ -430,24 +472,31 @@ SnNor3::~SnNor3()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNor3::gate_type() const
+{
+  return kGateNOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNor3::_calc_gval3()
 {
-  mGval1 = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0();
-  mGval0 = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1();
+  *mGval1Ptr = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0();
+  *mGval0Ptr = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNor3::_calc_fval3(PackedVal mask)
+SnNor3::_calc_fval3(PackedValW mask)
 {
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0()) & mask;
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1()) & mask;
 }
 
 // @brief 内容をダンプする．
@@ -477,24 +526,31 @@ SnNor4::~SnNor4()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnNor4::gate_type() const
+{
+  return kGateNOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnNor4::_calc_gval3()
 {
-  mGval1 = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0() & mFanins[3]->gval_0();
-  mGval0 = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1() | mFanins[3]->gval_1();
+  *mGval1Ptr = mFanins[0]->gval_0() & mFanins[1]->gval_0() & mFanins[2]->gval_0() & mFanins[3]->gval_0();
+  *mGval0Ptr = mFanins[0]->gval_1() | mFanins[1]->gval_1() | mFanins[2]->gval_1() | mFanins[3]->gval_1();
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnNor4::_calc_fval3(PackedVal mask)
+SnNor4::_calc_fval3(PackedValW mask)
 {
-  mFval1 &= ~mask;
-  mFval1 |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0() & mFanins[3]->fval_0()) & mask;
-  mFval0 &= ~mask;
-  mFval0 |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1() | mFanins[3]->fval_1()) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (mFanins[0]->fval_0() & mFanins[1]->fval_0() & mFanins[2]->fval_0() & mFanins[3]->fval_0()) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (mFanins[0]->fval_1() | mFanins[1]->fval_1() | mFanins[2]->fval_1() | mFanins[3]->fval_1()) & mask;
 }
 
 // @brief 内容をダンプする．
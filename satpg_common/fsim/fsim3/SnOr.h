@@ -34,6 +34,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -45,11 +50,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -80,6 +85,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -91,11 +101,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -126,6 +136,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -137,11 +152,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -172,6 +187,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -183,11 +203,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -218,6 +238,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -229,7 +254,7 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief 内容をダンプする．
   virtual
@@ -259,6 +284,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -270,7 +300,7 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief 内容をダンプする．
   virtual
@@ -300,6 +330,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -311,7 +346,7 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief 内容をダンプする．
   virtual
@@ -341,6 +376,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -352,7 +392,7 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief 内容をダンプする．
   virtual
@@ -28,59 +28,66 @@ SnXor::~SnXor()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnXor::gate_type() const
+{
+  return kGateXOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnXor::_calc_gval3()
 {
-  PackedVal val0 = mFanins[0]->gval_0();
-  PackedVal val1 = mFanins[0]->gval_1();
+  PackedValW val0 = mFanins[0]->gval_0();
+  PackedValW val1 = mFanins[0]->gval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
-    PackedVal tmp_val0 = mFanins[i]->gval_0();
-    PackedVal tmp_val1 = mFanins[i]->gval_1();
+    PackedValW tmp_val0 = mFanins[i]->gval_0();
+    PackedValW tmp_val1 = mFanins[i]->gval_1();
 
-    PackedVal a_val0 = (val0 | tmp_val1);
-    PackedVal a_val1 = (val1 & tmp_val0);
-    PackedVal b_val0 = (val1 | tmp_val0);
-    PackedVal b_val1 = (val0 & tmp_val1);
+    PackedValW a_val0 = (val0 | tmp_val1);
+    PackedValW a_val1 = (val1 & tmp_val0);
+    PackedValW b_val0 = (val1 | tmp_val0);
+    PackedValW b_val1 = (val0 & tmp_val1);
 
     val0 = a_val0 & b_val0;
     val1 = a_val1 | b_val1;
   }
-  mGval0 = val0;
-  mGval1 = val1;
+  *mGval0Ptr = val0;
+  *mGval1Ptr = val1;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnXor::_calc_fval3(PackedVal mask)
+SnXor::_calc_fval3(PackedValW mask)
 {
-  PackedVal val0 = mFanins[0]->fval_0();
-  PackedVal val1 = mFanins[0]->fval_1();
+  PackedValW val0 = mFanins[0]->fval_0();
+  PackedValW val1 = mFanins[0]->fval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
-    PackedVal tmp_val0 = mFanins[i]->fval_0();
-    PackedVal tmp_val1 = mFanins[i]->fval_1();
+    PackedValW tmp_val0 = mFanins[i]->fval_0();
+    PackedValW tmp_val1 = mFanins[i]->fval_1();
 
-    PackedVal a_val0 = (val0 | tmp_val1);
-    PackedVal a_val1 = (val1 & tmp_val0);
-    PackedVal b_val0 = (val1 | tmp_val0);
-    PackedVal b_val1 = (val0 & tmp_val1);
+    PackedValW a_val0 = (val0 | tmp_val1);
+    PackedValW a_val1 = (val1 & tmp_val0);
+    PackedValW b_val0 = (val1 | tmp_val0);
+    PackedValW b_val1 = (val0 & tmp_val1);
 
     val0 = a_val0 & b_val0;
     val1 = a_val1 | b_val1;
   }
-  mFval0 &= ~mask;
-  mFval0 |= val0 & mask;
-  mFval1 &= ~mask;
-  mFval1 |= val1 & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= val0 & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= val1 & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnXor::calc_gobs3(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -111,43 +118,50 @@ SnXor2::~SnXor2()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnXor2::gate_type() const
+{
+  return kGateXOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnXor2::_calc_gval3()
 {
-  PackedVal tmp0_0 = mFanins[0]->gval_0() | mFanins[1]->gval_1();
-  PackedVal tmp0_1 = mFanins[0]->gval_1() & mFanins[1]->gval_0();
+  PackedValW tmp0_0 = mFanins[0]->gval_0() | mFanins[1]->gval_1();
+  PackedValW tmp0_1 = mFanins[0]->gval_1() & mFanins[1]->gval_0();
 
-  PackedVal tmp1_0 = mFanins[0]->gval_1() | mFanins[1]->gval_0();
-  PackedVal tmp1_1 = mFanins[0]->gval_0() & mFanins[1]->gval_1();
+  PackedValW tmp1_0 = mFanins[0]->gval_1() | mFanins[1]->gval_0();
+  PackedValW tmp1_1 = mFanins[0]->gval_0() & mFanins[1]->gval_1();
 
-  mGval0 = tmp0_0 & tmp1_0;
-  mGval1 = tmp0_1 | tmp1_1;
+  *mGval0Ptr = tmp0_0 & tmp1_0;
+  *mGval1Ptr = tmp0_1 | tmp1_1;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnXor2::_calc_fval3(PackedVal mask)
+SnXor2::_calc_fval3(PackedValW mask)
 {
-  PackedVal tmp0_0 = mFanins[0]->fval_0() | mFanins[1]->fval_1();
-  PackedVal tmp0_1 = mFanins[0]->fval_1() & mFanins[1]->fval_0();
+  PackedValW tmp0_0 = mFanins[0]->fval_0() | mFanins[1]->fval_1();
+  PackedValW tmp0_1 = mFanins[0]->fval_1() & mFanins[1]->fval_0();
 
-  PackedVal tmp1_0 = mFanins[0]->fval_1() | mFanins[1]->fval_0();
-  PackedVal tmp1_1 = mFanins[0]->fval_0() & mFanins[1]->fval_1();
+  PackedValW tmp1_0 = mFanins[0]->fval_1() | mFanins[1]->fval_0();
+  PackedValW tmp1_1 = mFanins[0]->fval_0() & mFanins[1]->fval_1();
 
-  mFval0 &= ~mask;
-  mFval0 |= (tmp0_0 & tmp1_0) & mask;
-  mFval1 &= ~mask;
-  mFval1 |= (tmp0_1 | tmp1_1) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (tmp0_0 & tmp1_0) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (tmp0_1 | tmp1_1) & mask;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
-PackedVal
+PackedValW
 SnXor2::calc_gobs3(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -176,52 +190,59 @@ SnXnor::~SnXnor()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnXnor::gate_type() const
+{
+  return kGateXNOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnXnor::_calc_gval3()
 {
-  PackedVal val0 = mFanins[0]->gval_0();
-  PackedVal val1 = mFanins[0]->gval_1();
+  PackedValW val0 = mFanins[0]->gval_0();
+  PackedValW val1 = mFanins[0]->gval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
-    PackedVal tmp_val0 = mFanins[i]->gval_0();
-    PackedVal tmp_val1 = mFanins[i]->gval_1();
+    PackedValW tmp_val0 = mFanins[i]->gval_0();
+    PackedValW tmp_val1 = mFanins[i]->gval_1();
 
-    PackedVal a_val0 = (val0 | tmp_val1);
-    PackedVal a_val1 = (val1 & tmp_val0);
-    PackedVal b_val0 = (val1 | tmp_val0);
-    PackedVal b_val1 = (val0 & tmp_val1);
+    PackedValW a_val0 = (val0 | tmp_val1);
+    PackedValW a_val1 = (val1 & tmp_val0);
+    PackedValW b_val0 = (val1 | tmp_val0);
+    PackedValW b_val1 = (val0 & tmp_val1);
 
     val0 = a_val0 & b_val0;
     val1 = a_val1 | b_val1;
   }
-  mGval0 = val1;
-  mGval1 = val0;
+  *mGval0Ptr = val1;
+  *mGval1Ptr = val0;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnXnor::_calc_fval3(PackedVal mask)
+SnXnor::_calc_fval3(PackedValW mask)
 {
-  PackedVal val0 = mFanins[0]->fval_0();
-  PackedVal val1 = mFanins[0]->fval_1();
+  PackedValW val0 = mFanins[0]->fval_0();
+  PackedValW val1 = mFanins[0]->fval_1();
   for (ymuint i = 1; i < mNfi; ++ i) {
-    PackedVal tmp_val0 = mFanins[i]->fval_0();
-    PackedVal tmp_val1 = mFanins[i]->fval_1();
+    PackedValW tmp_val0 = mFanins[i]->fval_0();
+    PackedValW tmp_val1 = mFanins[i]->fval_1();
 
-    PackedVal a_val0 = (val0 | tmp_val1);
-    PackedVal a_val1 = (val1 & tmp_val0);
-    PackedVal b_val0 = (val1 | tmp_val0);
-    PackedVal b_val1 = (val0 & tmp_val1);
+    PackedValW a_val0 = (val0 | tmp_val1);
+    PackedValW a_val1 = (val1 & tmp_val0);
+    PackedValW b_val0 = (val1 | tmp_val0);
+    PackedValW b_val1 = (val0 & tmp_val1);
 
     val0 = a_val0 & b_val0;
     val1 = a_val1 | b_val1;
   }
-  mFval0 &= ~mask;
-  mFval0 |= val1 & mask;
-  mFval1 &= ~mask;
-  mFval1 |= val0 & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= val1 & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= val0 & mask;
 }
 
 // @brief 内容をダンプする．
@@ -252,36 +273,43 @@ SnXnor2::~SnXnor2()
 {
 }
 
+// @brief ゲートタイプを返す．
+GateType
+SnXnor2::gate_type() const
+{
+  return kGateXNOR;
+}
+
 // @brief 正常値の計算を行う．(3値版)
 void
 SnXnor2::_calc_gval3()
 {
-  PackedVal tmp0_0 = mFanins[0]->gval_0() | mFanins[1]->gval_1();
-  PackedVal tmp0_1 = mFanins[0]->gval_1() & mFanins[1]->gval_0();
+  PackedValW tmp0_0 = mFanins[0]->gval_0() | mFanins[1]->gval_1();
+  PackedValW tmp0_1 = mFanins[0]->gval_1() & mFanins[1]->gval_0();
 
-  PackedVal tmp1_0 = mFanins[0]->gval_1() | mFanins[1]->gval_0();
-  PackedVal tmp1_1 = mFanins[0]->gval_0() & mFanins[1]->gval_1();
+  PackedValW tmp1_0 = mFanins[0]->gval_1() | mFanins[1]->gval_0();
+  PackedValW tmp1_1 = mFanins[0]->gval_0() & mFanins[1]->gval_1();
 
-  mGval1 = tmp0_0 & tmp1_0;
-  mGval0 = tmp0_1 | tmp1_1;
+  *mGval1Ptr = tmp0_0 & tmp1_0;
+  *mGval0Ptr = tmp0_1 | tmp1_1;
 }
 
 // @brief 故障値の計算を行う．(3値版)
 // @param[in] mask マスク
 // @note 結果は mFval0, mFval1 に格納される．
 void
-SnXnor2::_calc_fval3(PackedVal mask)
+SnXnor2::_calc_fval3(PackedValW mask)
 {
-  PackedVal tmp0_0 = mFanins[0]->fval_0() | mFanins[1]->fval_1();
-  PackedVal tmp0_1 = mFanins[0]->fval_1() & mFanins[1]->fval_0();
+  PackedValW tmp0_0 = mFanins[0]->fval_0() | mFanins[1]->fval_1();
+  PackedValW tmp0_1 = mFanins[0]->fval_1() & mFanins[1]->fval_0();
 
-  PackedVal tmp1_0 = mFanins[0]->fval_1() | mFanins[1]->fval_0();
-  PackedVal tmp1_1 = mFanins[0]->fval_0() & mFanins[1]->fval_1();
+  PackedValW tmp1_0 = mFanins[0]->fval_1() | mFanins[1]->fval_0();
+  PackedValW tmp1_1 = mFanins[0]->fval_0() & mFanins[1]->fval_1();
 
-  mFval1 &= ~mask;
-  mFval1 |= (tmp0_0 & tmp1_0) & mask;
-  mFval0 &= ~mask;
-  mFval0 |= (tmp0_1 | tmp1_1) & mask;
+  *mFval1Ptr &= ~mask;
+  *mFval1Ptr |= (tmp0_0 & tmp1_0) & mask;
+  *mFval0Ptr &= ~mask;
+  *mFval0Ptr |= (tmp0_1 | tmp1_1) & mask;
 }
 
 // @brief 内容をダンプする．
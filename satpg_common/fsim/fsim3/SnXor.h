@@ -34,6 +34,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -45,11 +50,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -80,6 +85,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -91,11 +101,11 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(3値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs3(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -126,6 +136,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -137,7 +152,7 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief 内容をダンプする．
   virtual
@@ -167,6 +182,11 @@ public:
 
 public:
 
+  /// @brief ゲートタイプを返す．
+  virtual
+  GateType
+  gate_type() const;
+
   /// @brief 正常値の計算を行う．(3値版)
   /// @note 結果は mGval0, mGval1 に格納される．
   virtual
@@ -178,7 +198,7 @@ public:
   /// @note 結果は mFval0, mFval1 に格納される．
   virtual
   void
-  _calc_fval3(PackedVal mask);
+  _calc_fval3(PackedValW mask);
 
   /// @brief 内容をダンプする．
   virtual
@@ -53,7 +53,7 @@ struct SimFault
   SimNode* mInode;
 
   // 現在計算中のローカルな故障伝搬マスク
-  PackedVal mObsMask;
+  PackedValW mObsMask;
 
   // スキップフラグ
   bool mSkip;
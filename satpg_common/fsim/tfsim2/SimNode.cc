@@ -150,11 +150,11 @@ SimNode::set_fanout_list(const vector<SimNode*>& fo_list,
 }
 
 // @brief ローカルな obs の計算を行う．
-PackedVal
+PackedValW
 SimNode::calc_lobs()
 {
   if ( is_ffr_root() ) {
-    return kPvAll1;
+    return kPvwAll1;
   }
   if ( !check_lobs() ) {
     SimNode* onode = fanout(0);
@@ -12,7 +12,7 @@
 #include "tfsim2_nsdef.h"
 #include "TpgNode.h"
 #include "EqElem.h"
-#include "PackedVal.h"
+#include "PackedValW.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG_TFSIM2
@@ -124,10 +124,10 @@ public:
   /// @param[in] pat 値
   /// @note 通常は外部入力に対して行われる．
   void
-  set_gval1(PackedVal pat);
+  set_gval1(PackedValW pat);
 
   /// @brief 1時刻目の正常値を得る．
-  PackedVal
+  PackedValW
   gval1() const;
 
   /// @brief 正常値のセットを行う．
@@ -135,22 +135,22 @@ public:
   /// @note 通常は外部入力に対して行われる．
   /// @note 故障値も同様にセットされる．
   void
-  set_gval(PackedVal pat);
+  set_gval(PackedValW pat);
 
   /// @brief 正常値を得る．
-  PackedVal
+  PackedValW
   gval() const;
 
   /// @brief 故障値をセットする．
   void
-  set_fval(PackedVal pat);
+  set_fval(PackedValW pat);
 
   /// @brief 故障値のマスクをセットする．
   void
-  set_fmask(PackedVal mask);
+  set_fmask(PackedValW mask);
 
   /// @brief 故障値を得る．
-  PackedVal
+  PackedValW
   fval() const;
 
   /// @brief 故障値をクリアする．
@@ -170,11 +170,11 @@ public:
   /// @brief 故障値の計算を行う．
   /// @return 故障差を返す．
   /// @note 結果は mFval にセットされる．
-  PackedVal
-  calc_fval2(PackedVal mask);
+  PackedValW
+  calc_fval2(PackedValW mask);
 
   /// @brief ローカルな obs の計算を行う．
-  PackedVal
+  PackedValW
   calc_lobs();
 
   /// @brief lobs が計算済みかチェックする．
@@ -216,22 +216,22 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1() = 0;
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2() = 0;
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2() = 0;
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos) = 0;
 
   /// @brief 内容をダンプする．
@@ -271,19 +271,19 @@ private:
   ymuint32 mLevel;
 
   // 1時刻目の正常値
-  PackedVal mGval1;
+  PackedValW mGval1;
 
   // 2時刻目の正常値
-  PackedVal mGval;
+  PackedValW mGval;
 
   // 故障値
-  PackedVal mFval;
+  PackedValW mFval;
 
   // FFR 内のローカルな obs
-  PackedVal mLobs;
+  PackedValW mLobs;
 
   // 故障値に対するマスク
-  PackedVal mFmask;
+  PackedValW mFmask;
 
   // 名前
   string mName;
@@ -388,7 +388,7 @@ SimNode::clear_lobs()
 // @note 通常は外部入力に対して行われる．
 inline
 void
-SimNode::set_gval1(PackedVal val)
+SimNode::set_gval1(PackedValW val)
 {
   mGval1 = val;
 }
@@ -399,7 +399,7 @@ SimNode::set_gval1(PackedVal val)
 // @note 故障値も同様にセットされる．
 inline
 void
-SimNode::set_gval(PackedVal val)
+SimNode::set_gval(PackedValW val)
 {
   mGval = val;
   mFval = val;
@@ -407,7 +407,7 @@ SimNode::set_gval(PackedVal val)
 
 // @brief 1時刻目の正常値を得る．
 inline
-PackedVal
+PackedValW
 SimNode::gval1() const
 {
   return mGval1;
@@ -415,7 +415,7 @@ SimNode::gval1() const
 
 // @brief 正常値を得る．
 inline
-PackedVal
+PackedValW
 SimNode::gval() const
 {
   return mGval;
@@ -424,7 +424,7 @@ SimNode::gval() const
 // @brief 故障値をセットする．
 inline
 void
-SimNode::set_fval(PackedVal pat)
+SimNode::set_fval(PackedValW pat)
 {
   mFval = pat;
 }
@@ -432,14 +432,14 @@ SimNode::set_fval(PackedVal pat)
 // @brief 故障値のマスクをセットする．
 inline
 void
-SimNode::set_fmask(PackedVal mask)
+SimNode::set_fmask(PackedValW mask)
 {
   mFmask = mask;
 }
 
 // @brief 故障値を得る．(2値版)
 inline
-PackedVal
+PackedValW
 SimNode::fval() const
 {
   return mFval;
@@ -451,7 +451,7 @@ void
 SimNode::clear_fval()
 {
   mFval = mGval;
-  mFmask = kPvAll1;
+  mFmask = kPvwAll1;
 }
 
 // @brief 1時刻目の正常値の計算を行う．
@@ -476,11 +476,11 @@ SimNode::calc_gval2()
 // @return 故障差を返す．
 // @note 結果は mFval にセットされる．
 inline
-PackedVal
-SimNode::calc_fval2(PackedVal mask)
+PackedValW
+SimNode::calc_fval2(PackedValW mask)
 {
-  PackedVal val = _calc_fval2();
-  PackedVal diff = (mGval ^ val) & mask;
+  PackedValW val = _calc_fval2();
+  PackedValW diff = (mGval ^ val) & mask;
   mFval ^= diff;
   return diff;
 }
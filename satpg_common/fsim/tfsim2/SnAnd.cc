@@ -36,11 +36,11 @@ SnAnd::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd::_calc_gval1()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval1();
+  PackedValW new_val = mFanins[0]->gval1();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->gval1();
   }
@@ -48,11 +48,11 @@ SnAnd::_calc_gval1()
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->gval();
   }
@@ -60,11 +60,11 @@ SnAnd::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnAnd::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->fval();
   }
@@ -72,10 +72,10 @@ SnAnd::_calc_fval2()
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．
-PackedVal
+PackedValW
 SnAnd::calc_gobs2(ymuint ipos)
 {
-  PackedVal obs = kPvAll1;
+  PackedValW obs = kPvwAll1;
   for (ymuint i = 0; i < ipos; ++ i) {
     obs &= mFanins[i]->gval();
   }
@@ -122,34 +122,34 @@ SnAnd2::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd2::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
   return pat0 & pat1;
 }
 
 // @brief 正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return pat0 & pat1;
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnAnd2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return pat0 & pat1;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnAnd2::calc_gobs2(ymuint ipos)
 {
   return mFanins[ipos ^ 1]->gval();
@@ -189,37 +189,37 @@ SnAnd3::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd3::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
-  PackedVal pat2 = mFanins[2]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
+  PackedValW pat2 = mFanins[2]->gval1();
   return pat0 & pat1 & pat2;
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd3::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
   return pat0 & pat1 & pat2;
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnAnd3::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
   return pat0 & pat1 & pat2;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．
-PackedVal
+PackedValW
 SnAnd3::calc_gobs2(ymuint ipos)
 {
   switch ( ipos ) {
@@ -227,7 +227,7 @@ SnAnd3::calc_gobs2(ymuint ipos)
   case 1: return mFanins[0]->gval() & mFanins[2]->gval();
   case 2: return mFanins[0]->gval() & mFanins[1]->gval();
   }
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -265,40 +265,40 @@ SnAnd4::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd4::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
-  PackedVal pat2 = mFanins[2]->gval1();
-  PackedVal pat3 = mFanins[3]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
+  PackedValW pat2 = mFanins[2]->gval1();
+  PackedValW pat3 = mFanins[3]->gval1();
   return pat0 & pat1 & pat2 & pat3;
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnAnd4::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
-  PackedVal pat3 = mFanins[3]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
+  PackedValW pat3 = mFanins[3]->gval();
   return pat0 & pat1 & pat2 & pat3;
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnAnd4::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
-  PackedVal pat3 = mFanins[3]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
+  PackedValW pat3 = mFanins[3]->fval();
   return pat0 & pat1 & pat2 & pat3;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．
-PackedVal
+PackedValW
 SnAnd4::calc_gobs2(ymuint ipos)
 {
   switch ( ipos ) {
@@ -307,7 +307,7 @@ SnAnd4::calc_gobs2(ymuint ipos)
   case 2: return mFanins[0]->gval() & mFanins[1]->gval() & mFanins[3]->gval();
   case 3: return mFanins[0]->gval() & mFanins[1]->gval() & mFanins[2]->gval();
   }
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -346,11 +346,11 @@ SnNand::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand::_calc_gval1()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval1();
+  PackedValW new_val = mFanins[0]->gval1();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->gval1();
   }
@@ -358,11 +358,11 @@ SnNand::_calc_gval1()
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->gval();
   }
@@ -370,11 +370,11 @@ SnNand::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnNand::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val &= mFanins[i]->fval();
   }
@@ -418,29 +418,29 @@ SnNand2::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand2::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
   return ~(pat0 & pat1);
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return ~(pat0 & pat1);
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnNand2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return ~(pat0 & pat1);
 }
 
@@ -478,32 +478,32 @@ SnNand3::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand3::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
-  PackedVal pat2 = mFanins[2]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
+  PackedValW pat2 = mFanins[2]->gval1();
   return ~(pat0 & pat1 & pat2);
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand3::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
   return ~(pat0 & pat1 & pat2);
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnNand3::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
   return ~(pat0 & pat1 & pat2);
 }
 
@@ -542,35 +542,35 @@ SnNand4::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand4::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
-  PackedVal pat2 = mFanins[2]->gval1();
-  PackedVal pat3 = mFanins[3]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
+  PackedValW pat2 = mFanins[2]->gval1();
+  PackedValW pat3 = mFanins[3]->gval1();
   return ~(pat0 & pat1 & pat2 & pat3);
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNand4::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
-  PackedVal pat2 = mFanins[2]->gval();
-  PackedVal pat3 = mFanins[3]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
+  PackedValW pat2 = mFanins[2]->gval();
+  PackedValW pat3 = mFanins[3]->gval();
   return ~(pat0 & pat1 & pat2 & pat3);
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnNand4::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
-  PackedVal pat2 = mFanins[2]->fval();
-  PackedVal pat3 = mFanins[3]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
+  PackedValW pat2 = mFanins[2]->fval();
+  PackedValW pat3 = mFanins[3]->fval();
   return ~(pat0 & pat1 & pat2 & pat3);
 }
 
@@ -41,22 +41,22 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -94,22 +94,22 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -147,22 +147,22 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -200,22 +200,22 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -253,17 +253,17 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
@@ -301,17 +301,17 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
@@ -349,17 +349,17 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
@@ -397,17 +397,17 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
@@ -53,31 +53,31 @@ SnInput::fanin(ymuint pos) const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnInput::_calc_gval1()
 {
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnInput::_calc_gval2()
 {
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnInput::_calc_fval2()
 {
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnInput::calc_gobs2(ymuint ipos)
 {
-  return kPvAll0;
+  return kPvwAll0;
 }
 
 // @brief 内容をダンプする．
@@ -112,31 +112,31 @@ SnBuff::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnBuff::_calc_gval1()
 {
   return mFanin->gval1();
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnBuff::_calc_gval2()
 {
   return mFanin->gval();
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnBuff::_calc_fval2()
 {
   return mFanin->fval();
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．
-PackedVal
+PackedValW
 SnBuff::calc_gobs2(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -171,21 +171,21 @@ SnNot::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNot::_calc_gval1()
 {
   return ~mFanin->gval1();
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnNot::_calc_gval2()
 {
   return ~mFanin->gval();
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnNot::_calc_fval2()
 {
   return ~mFanin->fval();
@@ -54,22 +54,22 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -107,22 +107,22 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
   virtual
-  PackedVal
+  PackedValW
   calc_gobs2(ymuint ipos);
 
   /// @brief 内容をダンプする．
@@ -160,17 +160,17 @@ public:
 
   /// @brief 1時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval1();
 
   /// @brief 2時刻目の正常値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_gval2();
 
   /// @brief 故障値の計算を行う．
   virtual
-  PackedVal
+  PackedValW
   _calc_fval2();
 
   /// @brief 内容をダンプする．
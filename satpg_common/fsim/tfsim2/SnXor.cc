@@ -36,11 +36,11 @@ SnXor::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXor::_calc_gval1()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval1();
+  PackedValW new_val = mFanins[0]->gval1();
   for (ymuint i = 1; i < n; ++ i) {
     new_val ^= mFanins[i]->gval1();
   }
@@ -48,11 +48,11 @@ SnXor::_calc_gval1()
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXor::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->gval();
+  PackedValW new_val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val ^= mFanins[i]->gval();
   }
@@ -60,11 +60,11 @@ SnXor::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnXor::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val ^= mFanins[i]->fval();
   }
@@ -72,10 +72,10 @@ SnXor::_calc_fval2()
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．
-PackedVal
+PackedValW
 SnXor::calc_gobs2(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -115,37 +115,37 @@ SnXor2::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXor2::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
   return pat0 ^ pat1;
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXor2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return pat0 ^ pat1;
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnXor2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return pat0 ^ pat1;
 }
 
 // @brief ゲートの入力から出力までの可観測性を計算する．(2値版)
-PackedVal
+PackedValW
 SnXor2::calc_gobs2(ymuint ipos)
 {
-  return kPvAll1;
+  return kPvwAll1;
 }
 
 // @brief 内容をダンプする．
@@ -182,11 +182,11 @@ SnXnor::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXnor::_calc_gval1()
 {
   ymuint n = mNfi;
-  PackedVal val = mFanins[0]->gval1();
+  PackedValW val = mFanins[0]->gval1();
   for (ymuint i = 1; i < n; ++ i) {
     val ^= mFanins[i]->gval1();
   }
@@ -194,11 +194,11 @@ SnXnor::_calc_gval1()
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXnor::_calc_gval2()
 {
   ymuint n = mNfi;
-  PackedVal val = mFanins[0]->gval();
+  PackedValW val = mFanins[0]->gval();
   for (ymuint i = 1; i < n; ++ i) {
     val ^= mFanins[i]->gval();
   }
@@ -206,11 +206,11 @@ SnXnor::_calc_gval2()
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnXnor::_calc_fval2()
 {
   ymuint n = mNfi;
-  PackedVal new_val = mFanins[0]->fval();
+  PackedValW new_val = mFanins[0]->fval();
   for (ymuint i = 1; i < n; ++ i) {
     new_val ^= mFanins[i]->fval();
   }
@@ -254,29 +254,29 @@ SnXnor2::gate_type() const
 }
 
 // @brief 1時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXnor2::_calc_gval1()
 {
-  PackedVal pat0 = mFanins[0]->gval1();
-  PackedVal pat1 = mFanins[1]->gval1();
+  PackedValW pat0 = mFanins[0]->gval1();
+  PackedValW pat1 = mFanins[1]->gval1();
   return ~(pat0 ^ pat1);
 }
 
 // @brief 2時刻目の正常値の計算を行う．
-PackedVal
+PackedValW
 SnXnor2::_calc_gval2()
 {
-  PackedVal pat0 = mFanins[0]->gval();
-  PackedVal pat1 = mFanins[1]->gval();
+  PackedValW pat0 = mFanins[0]->gval();
+  PackedValW pat1 = mFanins[1]->gval();
   return ~(pat0 ^ pat1);
 }
 
 // @brief 故障値の計算を行う．
-PackedVal
+PackedValW
 SnXnor2::_calc_fval2()
 {
-  PackedVal pat0 = mFanins[0]->fval();
-  PackedVal pat1 = mFanins[1]->fval();
+  PackedValW pat0 = mFanins[0]->fval();
+  PackedValW pat1 = mFanins[1]->fval();
   return ~(pat0 ^ pat1);
 }
 
@@ -13,6 +13,7 @@
 #include "TpgNode.h"
 #include "TpgFault.h"
 #include "TestVector.h"
+#include "TvStore.h"
 #include "NodeValList.h"
 #include "DetectOp.h"
 #include "SimNode.h"
@@ -70,6 +71,8 @@ TFsim2::set_network(const TpgNetwork& network)
 {
   clear();
 
+  clear_sync();
+
   mNetwork = &network;
 
   ymuint nn = mNetwork->node_num();
@@ -137,6 +140,20 @@ TFsim2::set_network(const TpgNetwork& network)
     }
   }
 
+  // 擬似外部出力から擬似外部入力への対応表を作る．
+  {
+    ymuint npi1 = mNetwork->input_num();
+    ymuint npo1 = mNetwork->output_num();
+    ymuint nff = mNetwork->dff_num();
+    mPpiMap.clear();
+    mPpiMap.resize(mNodeArray.size(), nullptr);
+    for (ymuint i = 0; i < nff; ++ i) {
+      SimNode* onode = mOutputArray[i + npo1];
+      SimNode* inode = mInputArray[i + npi1];
+      mPpiMap[onode->id()] = inode;
+    }
+  }
+
   // 各ノードのファンアウトリストの設定
   ymuint node_num = mNodeArray.size();
   {
@@ -187,6 +204,10 @@ TFsim2::set_network(const TpgNetwork& network)
   // 消去用の配列の大きさはノード数を越えない．
   mClearArray.reserve(mNodeArray.size());
 
+  mWsaUndoList.clear();
+  mWsaMark.clear();
+  mWsaMark.resize(mNodeArray.size(), false);
+
   // 最大レベルを求め，イベントキューを初期化する．
   ymuint max_level = 0;
   for (ymuint i = 0; i < no; ++ i) {
@@ -229,19 +250,35 @@ TFsim2::set_network(const TpgNetwork& network)
   }
 }
 
+// @brief ppsfp() で用いるスレッド数を設定する．
+// @param[in] num スレッド数(0 の場合はハードウェアの並列度)
+//
+// このクラスは並列化に対応していないので何もしない．
+void
+TFsim2::set_thread_num(ymuint num)
+{
+}
+
 // @brief 故障にスキップマークをつける．
 void
-TFsim2::set_skip(const TpgFault* f)
+TFsim2::_set_skip(const TpgFault* f)
 {
   mFaultArray[f->id()]->mSkip = true;
 }
 
+// @brief 故障リストに含まれる故障のスキップマークを消す．
+void
+TFsim2::_clear_skip(const TpgFault* f)
+{
+  mFaultArray[f->id()]->mSkip = false;
+}
+
 // @brief 故障リストを設定する．
 // @param[in] fault_list 対象の故障リスト
 //
 // スキップマークは消される．
 void
-TFsim2::set_faults(const vector<const TpgFault*>& fault_list)
+TFsim2::_set_faults(const vector<const TpgFault*>& fault_list)
 {
   HashSet<ymuint> fault_set;
   for (ymuint i = 0; i < fault_list.size(); ++ i) {
@@ -280,7 +317,7 @@ TFsim2::sppfp(TestVector* tv,
   // tv を全ビットにセットしていく．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    PackedVal val = (tv->val3(i) == kVal1) ? kPvAll1 : kPvAll0;
+    PackedValW val = (tv->val3(i) == kVal1) ? kPvwAll1 : kPvwAll0;
     simnode->set_gval1(val);
   }
 
@@ -299,7 +336,7 @@ TFsim2::sppfp(const NodeValList& assign_list,
   // デフォルトで 0 にする．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    simnode->set_gval1(kPvAll0);
+    simnode->set_gval1(kPvwAll0);
   }
 
   ymuint n = assign_list.size();
@@ -307,7 +344,7 @@ TFsim2::sppfp(const NodeValList& assign_list,
     NodeVal nv = assign_list[i];
     if ( nv.val() ) {
       SimNode* simnode = mInputArray[nv.node()->input_id()];
-      simnode->set_gval1(kPvAll1);
+      simnode->set_gval1(kPvwAll1);
     }
   }
 
@@ -319,32 +356,11 @@ TFsim2::sppfp(const NodeValList& assign_list,
 void
 TFsim2::_sppfp(FsimOp& op)
 {
-  // 1時刻目の正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval1();
-  }
-
-  // 2時刻目のフリップフロップの値を設定する．
-  ymuint npi1 = mNetwork->input_num();
-  ymuint npo1 = mNetwork->output_num();
-  ymuint nff = mNetwork->dff_num();
-  for (ymuint i = 0; i < nff; ++ i) {
-    SimNode* onode = mOutputArray[i + npo1];
-    SimNode* inode = mInputArray[i + npi1];
-    inode->set_gval(onode->gval());
-  }
-
-  // 2時刻目の正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval2();
-  }
+  // 正常値の計算を行う．
+  calc_gval_2frames();
 
   ymuint bitpos = 0;
-  SimFFR* ffr_buff[kPvBitLen];
+  SimFFR* ffr_buff[kPvwBitLen];
   // FFR ごとに処理を行う．
   for (vector<SimFFR>::iterator p = mFFRArray.begin();
        p != mFFRArray.end(); ++ p) {
@@ -355,10 +371,10 @@ TFsim2::_sppfp(FsimOp& op)
     // 結果は SimFault.mObsMask に保存される．
     // FFR 内の全ての obs マスクを ffr_req に入れる．
     // 検出済みの故障は ffr->fault_list() から取り除かれる．
-    PackedVal ffr_req = ffr_simulate(ffr);
+    PackedValW ffr_req = ffr_simulate(ffr);
 
     // ffr_req が 0 ならその後のシミュレーションを行う必要はない．
-    if ( ffr_req == kPvAll0 ) {
+    if ( ffr_req == kPvwAll0 ) {
       continue;
     }
 
@@ -370,8 +386,9 @@ TFsim2::_sppfp(FsimOp& op)
     }
 
     // キューに積んでおく
-    PackedVal bitmask = 1UL << bitpos;
-    PackedVal pat = root->gval() ^ bitmask;
+    PackedValW bitmask = kPvwAll0;
+    bitmask.set_bit(bitpos);
+    PackedValW pat = root->gval() ^ bitmask;
     root->set_fval(pat);
     root->set_fmask(~bitmask);
 
@@ -383,10 +400,10 @@ TFsim2::_sppfp(FsimOp& op)
     ffr_buff[bitpos] = ffr;
 
     ++ bitpos;
-    if ( bitpos == kPvBitLen ) {
-      PackedVal obs = eventq_simulate();
-      for (ymuint i = 0; i < kPvBitLen; ++ i, obs >>= 1) {
-	if ( obs & 1UL ) {
+    if ( bitpos == kPvwBitLen ) {
+      PackedValW obs = eventq_simulate();
+      for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+	if ( obs.check_bit(i) ) {
 	  fault_sweep(ffr_buff[i], op);
 	}
       }
@@ -394,9 +411,9 @@ TFsim2::_sppfp(FsimOp& op)
     }
   }
   if ( bitpos > 0 ) {
-    PackedVal obs = eventq_simulate();
-    for (ymuint i = 0; i < bitpos; ++ i, obs >>= 1) {
-      if ( obs & 1UL ) {
+    PackedValW obs = eventq_simulate();
+    for (ymuint i = 0; i < bitpos; ++ i) {
+      if ( obs.check_bit(i) ) {
 	fault_sweep(ffr_buff[i], op);
       }
     }
@@ -410,54 +427,100 @@ void
 TFsim2::ppsfp(const vector<TestVector*>& tv_array,
 	      FsimOp& op)
 {
-  ymuint npi = mNetwork->input_num2();
   ymuint nb = tv_array.size();
 
   // tv_array を入力ごとに固めてセットしていく．
-  for (ymuint i = 0; i < npi; ++ i) {
-    PackedVal val = kPvAll0;
-    PackedVal bit = 1UL;
-    for (ymuint j = 0; j < nb; ++ j, bit <<= 1) {
-      if ( tv_array[j]->val3(i) == kVal1 ) {
-	val |= bit;
-      }
-    }
-    // 残ったビットには 0 番めのパタンを詰めておく．
-    if ( tv_array[0]->val3(i) == kVal1 ) {
-      for (ymuint j = nb; j < kPvBitLen; ++ j, bit <<= 1) {
-	val |= bit;
+  set_tv_array(tv_array);
+
+  _ppsfp(nb, op);
+}
+
+// @brief 複数のパタンで故障シミュレーションを行う．
+// @param[in] assign_list_array 値の割当リストの配列
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+TFsim2::ppsfp(const vector<NodeValList>& assign_list_array,
+	      FsimOp& op)
+{
+  ymuint npi = mNetwork->input_num2();
+  ymuint nb = assign_list_array.size();
+
+  ASSERT_COND( nb > 0 && nb <= kPvwBitLen );
+
+  // 割当のない入力の値は 0 にしておく．
+  vector<PackedValW> val_array(npi, kPvwAll0);
+  for (ymuint j = 0; j < nb; ++ j) {
+    const NodeValList& assign_list = assign_list_array[j];
+    ymuint n = assign_list.size();
+    for (ymuint i = 0; i < n; ++ i) {
+      NodeVal nv = assign_list[i];
+      if ( nv.val() ) {
+	val_array[nv.node()->input_id()].set_bit(j);
       }
     }
-    SimNode* simnode = mInputArray[i];
-    simnode->set_gval1(val);
   }
 
-  // 1時刻目の正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval1();
-  }
-
-  // 2時刻目のフリップフロップの値を設定する．
+  // 残ったビットには 0 番めのパタンを詰めておく．
+  PackedValW rest_mask = kPvwAll0;
   {
-    ymuint npi1 = mNetwork->input_num();
-    ymuint npo1 = mNetwork->output_num();
-    ymuint nff = mNetwork->dff_num();
-    for (ymuint i = 0; i < nff; ++ i) {
-      SimNode* onode = mOutputArray[i + npo1];
-      SimNode* inode = mInputArray[i + npi1];
-      inode->set_gval(onode->gval());
+    ymuint wpos = nb / kPvBitLen;
+    ymuint bpos = nb % kPvBitLen;
+    if ( bpos > 0 ) {
+      rest_mask.set_word(wpos, kPvAll1 << bpos);
+      ++ wpos;
+    }
+    for ( ; wpos < kPvwWordNum; ++ wpos) {
+      rest_mask.set_word(wpos, kPvAll1);
+    }
+  }
+  const NodeValList& assign_list0 = assign_list_array[0];
+  ymuint n0 = assign_list0.size();
+  for (ymuint i = 0; i < n0; ++ i) {
+    NodeVal nv = assign_list0[i];
+    if ( nv.val() ) {
+      val_array[nv.node()->input_id()] |= rest_mask;
     }
   }
 
-  // 2時刻目の正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval2();
+  for (ymuint i = 0; i < npi; ++ i) {
+    SimNode* simnode = mInputArray[i];
+    simnode->set_gval1(val_array[i]);
   }
 
+  _ppsfp(nb, op);
+}
+
+// @brief 複数のパタンで故障シミュレーションを行う．
+// @param[in] tv_store テストベクタを保持するオブジェクト
+// @param[in] blk ブロック番号
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+TFsim2::ppsfp(const TvStore& tv_store,
+	      ymuint blk,
+	      FsimOp& op)
+{
+  ymuint npi = mNetwork->input_num2();
+  ASSERT_COND( tv_store.input_num() == npi );
+
+  // ブロック内の値をそのまま外部入力にセットする．
+  // X は 0 として扱う．
+  for (ymuint i = 0; i < npi; ++ i) {
+    mInputArray[i]->set_gval1(tv_store.val1(blk, i));
+  }
+
+  _ppsfp(tv_store.block_size(blk), op);
+}
+
+// @brief PPSFP故障シミュレーションの本体
+// @param[in] nb パタン数
+// @param[in] op 検出した時に起動されるファンクタオブジェクト
+void
+TFsim2::_ppsfp(ymuint nb,
+	       FsimOp& op)
+{
+  // 正常値の計算を行う．
+  calc_gval_2frames();
+
   // FFR ごとに処理を行う．
   for (vector<SimFFR>::iterator p = mFFRArray.begin();
        p != mFFRArray.end(); ++ p) {
@@ -468,21 +531,21 @@ TFsim2::ppsfp(const vector<TestVector*>& tv_array,
     // 結果は SimFault.mObsMask に保存される．
     // FFR 内の全ての obs マスクを ffr_req に入れる．
     // 検出済みの故障は ffr->fault_list() から取り除かれる．
-    PackedVal ffr_req = ffr_simulate(ffr);
+    PackedValW ffr_req = ffr_simulate(ffr);
 
     // ffr_req が 0 ならその後のシミュレーションを行う必要はない．
-    if ( ffr_req == kPvAll0 ) {
+    if ( ffr_req == kPvwAll0 ) {
       continue;
     }
 
     // FFR の出力の故障伝搬を行う．
     SimNode* root = ffr->root();
-    PackedVal obs = kPvAll0;
+    PackedValW obs = kPvwAll0;
     if ( root->is_output() ) {
-      obs = kPvAll1;
+      obs = kPvwAll1;
     }
     else {
-      PackedVal pat = root->gval() ^ ffr_req;
+      PackedValW pat = root->gval() ^ ffr_req;
       root->set_fval(pat);
       mClearArray.clear();
       mClearArray.push_back(root);
@@ -502,9 +565,16 @@ TFsim2::ppsfp(const vector<TestVector*>& tv_array,
       if ( ff->mSkip ) {
 	continue;
       }
-      PackedVal dpat = obs & ff->mObsMask;
-      if ( dpat ) {
-	const TpgFault* f = ff->mOrigF;
+      PackedValW dpat = obs & ff->mObsMask;
+      if ( dpat.is_zero() ) {
+	continue;
+      }
+      const TpgFault* f = ff->mOrigF;
+      if ( nb <= kPvBitLen ) {
+	// 残りのワードは 0 番めのパタンの複製なので先頭のワードだけでよい．
+	op(f, dpat.word(0));
+      }
+      else {
 	op(f, dpat);
       }
     }
@@ -525,8 +595,8 @@ TFsim2::spsfp(TestVector* tv,
   // tv を全ビットにセットしていく．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    PackedVal val = (tv->val3(i) == kVal1) ? kPvAll1 : kPvAll0;
-    simnode->set_gval(val);
+    PackedValW val = (tv->val3(i) == kVal1) ? kPvwAll1 : kPvwAll0;
+    simnode->set_gval1(val);
   }
 
   return _spsfp(f);
@@ -546,7 +616,7 @@ TFsim2::spsfp(const NodeValList& assign_list,
   // assign_list にないノードの値は 0 にしておく．
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    simnode->set_gval(kPvAll0);
+    simnode->set_gval1(kPvwAll0);
   }
 
   ymuint n = assign_list.size();
@@ -554,13 +624,50 @@ TFsim2::spsfp(const NodeValList& assign_list,
     NodeVal nv = assign_list[i];
     if ( nv.val() ) {
       SimNode* simnode = mInputArray[nv.node()->input_id()];
-      simnode->set_gval(kPvAll1);
+      simnode->set_gval1(kPvwAll1);
     }
   }
 
   return _spsfp(f);
 }
 
+// @brief 1時刻目と2時刻目の正常値を計算する．
+//
+// 1時刻目の外部入力の値はあらかじめ設定されている必要がある．
+void
+TFsim2::calc_gval_2frames()
+{
+  // 1時刻目の正常値の計算を行う．
+  for (vector<SimNode*>::iterator q = mLogicArray.begin();
+       q != mLogicArray.end(); ++ q) {
+    SimNode* node = *q;
+    node->calc_gval1();
+  }
+
+  // 2時刻目の外部入力は1時刻目の値を保持する．
+  ymuint npi1 = mNetwork->input_num();
+  for (ymuint i = 0; i < npi1; ++ i) {
+    SimNode* inode = mInputArray[i];
+    inode->set_gval(inode->gval1());
+  }
+
+  // 2時刻目のフリップフロップの値を設定する．
+  ymuint npo1 = mNetwork->output_num();
+  ymuint nff = mNetwork->dff_num();
+  for (ymuint i = 0; i < nff; ++ i) {
+    SimNode* onode = mOutputArray[i + npo1];
+    SimNode* inode = mInputArray[i + npi1];
+    inode->set_gval(onode->gval1());
+  }
+
+  // 2時刻目の正常値の計算を行う．
+  for (vector<SimNode*>::iterator q = mLogicArray.begin();
+       q != mLogicArray.end(); ++ q) {
+    SimNode* node = *q;
+    node->calc_gval2();
+  }
+}
+
 // @brief SPSFP故障シミュレーションの本体
 // @param[in] f 対象の故障
 // @retval true 故障の検出が行えた．
@@ -569,14 +676,10 @@ bool
 TFsim2::_spsfp(const TpgFault* f)
 {
   // 正常値の計算を行う．
-  for (vector<SimNode*>::iterator q = mLogicArray.begin();
-       q != mLogicArray.end(); ++ q) {
-    SimNode* node = *q;
-    node->calc_gval2();
-  }
+  calc_gval_2frames();
 
   // FFR 内の故障伝搬を行う．
-  PackedVal lobs;
+  PackedValW lobs;
   if ( f->is_branch_fault() ) {
     SimNode* simnode = find_simnode(f->tpg_onode());
     ymuint ipos = f->tpg_pos();
@@ -590,20 +693,27 @@ TFsim2::_spsfp(const TpgFault* f)
   }
 
   SimNode* isimnode = find_simnode(f->tpg_inode());
-  PackedVal valdiff = isimnode->gval();
+  PackedValW val1 = isimnode->gval1();
+  PackedValW val2 = isimnode->gval();
+  PackedValW valdiff;
   if ( f->val() == 1 ) {
-    valdiff = ~valdiff;
+    // 1 -> 0 への遷移
+    valdiff = ~val2 & val1;
+  }
+  else {
+    // 0 -> 1 への遷移
+    valdiff = val2 & ~val1;
   }
   lobs &= valdiff;
 
   // lobs が 0 ならその後のシミュレーションを行う必要はない．
-  if ( lobs == kPvAll0 ) {
+  if ( lobs == kPvwAll0 ) {
     return false;
   }
 
   SimNode* root = isimnode->ffr()->root();
   if ( root->is_output() ) {
-    return (lobs != kPvAll0);
+    return (lobs != kPvwAll0);
   }
 
   root->set_fval(~root->gval());
@@ -614,8 +724,8 @@ TFsim2::_spsfp(const TpgFault* f)
     mEventQ.put(root->fanout(i));
   }
 
-  PackedVal obs = eventq_simulate() & lobs;
-  return (obs != kPvAll0);
+  PackedValW obs = eventq_simulate() & lobs;
+  return (obs != kPvwAll0);
 }
 
 // @brief 現在保持している SimNode のネットワークを破棄する．
@@ -633,6 +743,7 @@ TFsim2::clear()
   mInputArray.clear();
   mOutputArray.clear();
   mLogicArray.clear();
+  mPpiMap.clear();
 
   mFFRArray.clear();
 
@@ -646,15 +757,18 @@ TFsim2::clear()
   mSimFaults.clear();
   mFaultArray.clear();
 
+  mWsaUndoList.clear();
+  mWsaMark.clear();
+
   // 念のため
   mNetwork = nullptr;
 }
 
 // @brief FFR 内の故障シミュレーションを行う．
-PackedVal
+PackedValW
 TFsim2::ffr_simulate(SimFFR* ffr)
 {
-  PackedVal ffr_req = kPvAll0;
+  PackedValW ffr_req = kPvwAll0;
   const vector<SimFault*>& flist = ffr->fault_list();
   for (vector<SimFault*>::const_iterator p = flist.begin();
        p != flist.end(); ++ p) {
@@ -665,16 +779,16 @@ TFsim2::ffr_simulate(SimFFR* ffr)
 
     // ff の故障伝搬を行う．
     SimNode* simnode = ff->mNode;
-    PackedVal lobs = simnode->calc_lobs();
-    PackedVal val1 = ff->mInode->gval1();
-    PackedVal val2 = ff->mInode->gval();
+    PackedValW lobs = simnode->calc_lobs();
+    PackedValW val1 = ff->mInode->gval1();
+    PackedValW val2 = ff->mInode->gval();
     const TpgFault* f = ff->mOrigF;
     if ( f->is_branch_fault() ) {
       // 入力の故障
       ymuint ipos = ff->mIpos;
       lobs &= simnode->calc_gobs2(ipos);
     }
-    PackedVal valdiff;
+    PackedValW valdiff;
     if ( f->val() == 1 ) {
       // 1 -> 0 への遷移
       valdiff = ~val2 & val1;
@@ -702,18 +816,18 @@ TFsim2::ffr_simulate(SimFFR* ffr)
 }
 
 // @brief イベントキューを用いてシミュレーションを行う．
-PackedVal
+PackedValW
 TFsim2::eventq_simulate()
 {
   // どこかの外部出力で検出されたことを表すビット
-  PackedVal obs = kPvAll0;
+  PackedValW obs = kPvwAll0;
   for ( ; ; ) {
     SimNode* node = mEventQ.get();
     if ( node == nullptr ) break;
     // すでに検出済みのビットはマスクしておく
     // これは無駄なイベントの発生を抑える．
-    PackedVal diff = node->calc_fval2(~obs);
-    if ( diff != kPvAll0 ) {
+    PackedValW diff = node->calc_fval2(~obs);
+    if ( diff != kPvwAll0 ) {
       mClearArray.push_back(node);
       if ( node->is_output() ) {
 	obs |= diff;
@@ -744,7 +858,7 @@ TFsim2::fault_sweep(SimFFR* ffr,
   for (vector<SimFault*>::const_iterator p = flist.begin();
        p != flist.end(); ++ p) {
     SimFault* ff = *p;
-    if ( !ff->mSkip && ff->mObsMask != kPvAll0 ) {
+    if ( !ff->mSkip && ff->mObsMask != kPvwAll0 ) {
       const TpgFault* f = ff->mOrigF;
       op(f, kPvAll1);
     }
@@ -780,19 +894,49 @@ TFsim2::find_simnode(const TpgNode* node) const
   return mSimMap[node->id()];
 }
 
-// @brief WSA を計算する．
-// @param[in] tv テストベクタ
-ymuint
-TFsim2::calc_wsa(TestVector* tv)
+// @brief tv_array の値を1時刻目の外部入力にセットする．
+// @param[in] tv_array テストベクタの配列
+//
+// 残ったビットには 0 番めのパタンを詰めておく．
+void
+TFsim2::set_tv_array(const vector<TestVector*>& tv_array)
 {
   ymuint npi = mNetwork->input_num2();
+  ymuint nb = tv_array.size();
 
-  // tv を全ビットにセットしていく．
+  ASSERT_COND( nb > 0 && nb <= kPvwBitLen );
+
+  // tv_array を入力ごとのビット列に変換する．
+  // X は 0 として扱う．
+  vector<PackedValW> val_array(npi, kPvwAll0);
+  TestVector::transpose(tv_array, nullptr, val_array.data());
   for (ymuint i = 0; i < npi; ++ i) {
     SimNode* simnode = mInputArray[i];
-    PackedVal val = (tv->val3(i) == kVal1) ? kPvAll1 : kPvAll0;
-    simnode->set_gval1(val);
+    simnode->set_gval1(val_array[i]);
   }
+}
+
+// @brief WSA を計算する．
+// @param[in] tv テストベクタ
+ymuint
+TFsim2::calc_wsa(TestVector* tv)
+{
+  vector<TestVector*> tv_array(1, tv);
+  vector<ymuint> wsa_array;
+  calc_wsa(tv_array, wsa_array);
+  return wsa_array[0];
+}
+
+// @brief 複数のパタンの WSA を計算する．
+// @param[in] tv_array テストベクタの配列
+// @param[out] wsa_array 各パタンの WSA を格納する配列
+void
+TFsim2::calc_wsa(const vector<TestVector*>& tv_array,
+		 vector<ymuint>& wsa_array)
+{
+  ymuint nb = tv_array.size();
+
+  set_tv_array(tv_array);
 
   // 1時刻目の正常値の計算を行う．
   for (vector<SimNode*>::iterator q = mLogicArray.begin();
@@ -801,31 +945,202 @@ TFsim2::calc_wsa(TestVector* tv)
     node->calc_gval1();
   }
 
-  // 2時刻目のフリップフロップの値を設定する．
+  // 2時刻目の外部入力は1時刻目の値を保持する．
   ymuint npi1 = mNetwork->input_num();
+  for (ymuint i = 0; i < npi1; ++ i) {
+    SimNode* inode = mInputArray[i];
+    inode->set_gval(inode->gval1());
+  }
+
+  // 2時刻目のフリップフロップの値を設定する．
   ymuint npo1 = mNetwork->output_num();
   ymuint nff = mNetwork->dff_num();
   for (ymuint i = 0; i < nff; ++ i) {
     SimNode* onode = mOutputArray[i + npo1];
     SimNode* inode = mInputArray[i + npi1];
-    inode->set_gval(onode->gval());
+    inode->set_gval(onode->gval1());
   }
 
   // 2時刻目の正常値の計算を行う．
   // と同時に WSA を計算する．
-  ymuint wsa = 0;
+  wsa_array.clear();
+  wsa_array.resize(nb, 0);
   for (vector<SimNode*>::iterator q = mLogicArray.begin();
        q != mLogicArray.end(); ++ q) {
     SimNode* node = *q;
     node->calc_gval2();
 
     // wsa を計算する．
-    if ( node->gval1() != node->gval() ) {
-      wsa += node->nfo();
+    add_wsa(node->gval1() ^ node->gval(), node->nfo(), wsa_array);
+  }
+}
+
+// @brief 差分 WSA 計算用の状態を初期化する．
+// @param[in] tv 基準となるテストベクタ
+// @return tv の WSA を返す．
+//
+// calc_wsa() の計算結果の各ノードの値をそのまま状態として用いる．
+ymuint
+TFsim2::init_wsa(TestVector* tv)
+{
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    mWsaMark[mWsaUndoList[i].mNode->id()] = false;
+  }
+  mWsaUndoList.clear();
+
+  return calc_wsa(tv);
+}
+
+// @brief 入力を反転させた時の WSA の差分を計算する．
+// @param[in] flip_list 反転させる入力番号のリスト
+// @return 現在の状態の WSA からの増分を返す．
+//
+// 1時刻目は反転させた入力から，2時刻目は反転させた外部入力と
+// 値の変化した擬似外部出力に対応する擬似外部入力から
+// イベントドリブンで値を計算し直す．
+// 全ビットに同じパタンが入っているので 0 ビットめだけを見ればよい．
+int
+TFsim2::delta_wsa(const vector<ymuint>& flip_list)
+{
+  ASSERT_COND( mWsaUndoList.empty() );
+
+  // 1時刻目の入力値を反転させる．
+  ymuint npi1 = mNetwork->input_num();
+  vector<SimNode*> pi_list;
+  for (ymuint i = 0; i < flip_list.size(); ++ i) {
+    SimNode* node = mInputArray[flip_list[i]];
+    wsa_record(node);
+    node->set_gval1(~node->gval1());
+    ymuint no = node->nfo();
+    for (ymuint j = 0; j < no; ++ j) {
+      mEventQ.put(node->fanout(j));
+    }
+    if ( flip_list[i] < npi1 ) {
+      pi_list.push_back(node);
+    }
+  }
+
+  // 1時刻目の値の変化を伝搬させる．
+  vector<SimNode*> ppo_list;
+  for ( ; ; ) {
+    SimNode* node = mEventQ.get();
+    if ( node == nullptr ) {
+      break;
+    }
+    PackedValW old_val = node->gval1();
+    wsa_record(node);
+    node->calc_gval1();
+    if ( node->gval1() != old_val ) {
+      ymuint no = node->nfo();
+      for (ymuint j = 0; j < no; ++ j) {
+	mEventQ.put(node->fanout(j));
+      }
+      if ( mPpiMap[node->id()] != nullptr ) {
+	ppo_list.push_back(node);
+      }
     }
   }
 
-  return wsa;
+  // 2時刻目の外部入力は1時刻目の値を保持する．
+  for (ymuint i = 0; i < pi_list.size(); ++ i) {
+    SimNode* inode = pi_list[i];
+    inode->set_gval(inode->gval1());
+    ymuint no = inode->nfo();
+    for (ymuint j = 0; j < no; ++ j) {
+      mEventQ.put(inode->fanout(j));
+    }
+  }
+
+  // 2時刻目のフリップフロップの値を設定する．
+  for (ymuint i = 0; i < ppo_list.size(); ++ i) {
+    SimNode* onode = ppo_list[i];
+    SimNode* inode = mPpiMap[onode->id()];
+    wsa_record(inode);
+    inode->set_gval(onode->gval1());
+    ymuint no = inode->nfo();
+    for (ymuint j = 0; j < no; ++ j) {
+      mEventQ.put(inode->fanout(j));
+    }
+  }
+
+  // 2時刻目の値の変化を伝搬させる．
+  for ( ; ; ) {
+    SimNode* node = mEventQ.get();
+    if ( node == nullptr ) {
+      break;
+    }
+    PackedValW old_val = node->gval();
+    wsa_record(node);
+    node->calc_gval2();
+    if ( node->gval() != old_val ) {
+      ymuint no = node->nfo();
+      for (ymuint j = 0; j < no; ++ j) {
+	mEventQ.put(node->fanout(j));
+      }
+    }
+  }
+
+  // 値を変更した論理ノードについて WSA の増減を求める．
+  int delta = 0;
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    const WsaUndo& undo = mWsaUndoList[i];
+    SimNode* node = undo.mNode;
+    if ( node->nfi() == 0 ) {
+      continue;
+    }
+    PackedVal old_toggle = (undo.mGval1 ^ undo.mGval).word(0) & 1UL;
+    PackedVal new_toggle = (node->gval1() ^ node->gval()).word(0) & 1UL;
+    if ( old_toggle != new_toggle ) {
+      if ( new_toggle ) {
+	delta += node->nfo();
+      }
+      else {
+	delta -= node->nfo();
+      }
+    }
+  }
+
+  return delta;
+}
+
+// @brief 直前の delta_wsa() の結果を確定させる．
+void
+TFsim2::commit_wsa()
+{
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    mWsaMark[mWsaUndoList[i].mNode->id()] = false;
+  }
+  mWsaUndoList.clear();
+}
+
+// @brief 直前の delta_wsa() の結果を取り消す．
+void
+TFsim2::rollback_wsa()
+{
+  for (ymuint i = 0; i < mWsaUndoList.size(); ++ i) {
+    const WsaUndo& undo = mWsaUndoList[i];
+    SimNode* node = undo.mNode;
+    node->set_gval1(undo.mGval1);
+    node->set_gval(undo.mGval);
+    mWsaMark[node->id()] = false;
+  }
+  mWsaUndoList.clear();
+}
+
+// @brief 差分 WSA 計算で値を変更する前のノードの値を記録する．
+// @param[in] node 対象のノード
+void
+TFsim2::wsa_record(SimNode* node)
+{
+  ymuint id = node->id();
+  if ( !mWsaMark[id] ) {
+    mWsaMark[id] = true;
+    WsaUndo undo;
+    undo.mNode = node;
+    undo.mGval1 = node->gval1();
+    undo.mGval = node->gval();
+    mWsaUndoList.push_back(undo);
+  }
 }
 
 END_NAMESPACE_YM_SATPG_TFSIM2
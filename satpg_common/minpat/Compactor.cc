@@ -9,6 +9,7 @@
 
 #include "Compactor.h"
 #include "FgMgr.h"
+#include "KeyHeap.h"
 #include "ym/HashSet.h"
 #include "ym/StopWatch.h"
 
@@ -274,41 +275,46 @@ Compactor::phase1(FgMgr& fgmgr,
   ymuint max_group_id = fgmgr.group_num();
   vector<bool> deleted(max_group_id, false);
 #if 1
-  vector<bool> locked(max_group_id, false);
+  // group_list 上の位置をキーにして要素数の少ない順に取り出すヒープ
+  // 要素数が等しい時は group_list 上で前にあるものが先になる．
+  KeyHeap group_heap;
+  group_heap.init(ng);
+  for (ymuint gpos = 0; gpos < ng; ++ gpos) {
+    ymuint gid = group_list[gpos];
+    group_heap.put(gpos, - static_cast<int>(fgmgr.fault_num(gid)));
+  }
+
+  vector<ymuint> changed_list;
   for (ymuint count = 0; count < ng; ++ count) {
 
     // 要素数が最小のグループを求める．
-    ymuint min_gid = max_group_id;
-    {
-      ymuint min_size = 0;
-      for (ymuint gpos = 0; gpos < ng; ++ gpos) {
-	ymuint gid = group_list[gpos];
-	if ( locked[gid] ) {
-	  continue;
-	}
+    ymuint min_pos = group_heap.pop_top();
+    ymuint min_gid = group_list[min_pos];
 
-	ymuint size = fgmgr.fault_num(gid);
-	if ( min_size == 0 || min_size > size ) {
-	  min_size = size;
-	  min_gid = gid;
+    changed_list.clear();
+    if ( remove_group(fgmgr, min_gid, group_list, count, deleted, changed_list) ) {
+      deleted[min_gid] = true;
+
+      // 故障を受け取ったグループのキーを更新する．
+      for (ymuint i = 0; i < changed_list.size(); ++ i) {
+	ymuint gpos = changed_list[i];
+	if ( group_heap.in_heap(gpos) ) {
+	  ymuint gid = group_list[gpos];
+	  group_heap.put(gpos, - static_cast<int>(fgmgr.fault_num(gid)));
 	}
       }
-      ASSERT_COND( min_gid != max_group_id );
-    }
-
-    if ( remove_group(fgmgr, min_gid, group_list, count, deleted) ) {
-      deleted[min_gid] = true;
     }
-    locked[min_gid] = true;
   }
 #else
   // グループをサイズの昇順にソートする．
   vector<ymuint> tmp_group_list = group_list;
   sort(tmp_group_list.begin(), tmp_group_list.end(), GroupLt(fgmgr));
+  vector<ymuint> changed_list;
   for (ymuint gpos = 0; gpos < ng; ++ gpos) {
     ymuint gid = tmp_group_list[gpos];
 
-    if ( remove_group(fgmgr, gid, tmp_group_list, gpos, deleted) ) {
+    changed_list.clear();
+    if ( remove_group(fgmgr, gid, tmp_group_list, gpos, deleted, changed_list) ) {
       // group_list から gid を除く．
       deleted[gid] = true;
     }
@@ -343,32 +349,40 @@ Compactor::phase1(FgMgr& fgmgr,
 // @param[in] gid0 対象のグループ番号
 // @param[in] group_list グループ番号のリスト
 // @param[in] deleted 削除済みフラグの配列
+// @param[out] changed_list 故障を受け取ったグループの group_list 上の位置のリスト
 // @return 削除できたら true を返す．
 //
 // 削除が成功した場合，gid に含まれていた故障は
 // 他のグループに移動される．
+// 失敗した場合は移動した故障を移動先のグループから取り除く．
 bool
 Compactor::remove_group(FgMgr& fgmgr,
 			ymuint gid0,
 			const vector<ymuint>& group_list,
 			ymuint count,
-			const vector<bool>& deleted)
+			const vector<bool>& deleted,
+			vector<ymuint>& changed_list)
 {
   // グループ数
   ymuint ng = group_list.size();
 
-  // 現在の情報を tmp_group_list にコピーしておく
-  vector<ymuint> tmp_group_list(ng);
+  // 故障の移動先を見つけるための作業用のグループ番号リストを作る．
+  vector<ymuint> cand_list;
+  cand_list.reserve(ng - 1);
   for (ymuint i = 0; i < ng; ++ i) {
-    ymuint gid1 = group_list[i];
-    ymuint gid2 = fgmgr.duplicate_group(gid1);
-    tmp_group_list[i] = gid2;
+    ymuint gid1 = group_list[ng - i - 1];
+    if ( !deleted[gid1] && gid1 != gid0 ) {
+      cand_list.push_back(gid1);
+    }
   }
 
   // gid のグループの故障を他のグループへ移動できるか調べる．
+  // find_group2() は見つけたグループに故障を追加してしまうので，
+  // 元に戻せるように移動先の group_list 上の位置を記録しておく．
   bool red = true;
   ymuint nf = fgmgr.fault_num(gid0);
-  vector<ymuint> move_list(nf);
+  vector<ymuint> move_list;
+  move_list.reserve(nf);
   for (ymuint fpos = 0; fpos < nf; ++ fpos) {
     ymuint fid = fgmgr.fault_id(gid0, fpos);
 
@@ -379,47 +393,32 @@ Compactor::remove_group(FgMgr& fgmgr,
       cout.flush();
     }
 
-    // fid の移動先を見つけるための作業用のグループ番号リストを作る．
-    vector<ymuint> cand_list;
-    {
-      cand_list.reserve(ng - 1);
-      for (ymuint i = 0; i < ng; ++ i) {
-	ymuint gid1 = group_list[ng - i - 1];
-	ymuint gid2 = tmp_group_list[ng - i - 1];
-	if ( !deleted[gid1] && gid1 != gid0 ) {
-	  cand_list.push_back(gid2);
-	}
-      }
-    }
-
     // fid を移動可能なグループを見つける．
     ymuint gid1 = fgmgr.find_group2(fid, cand_list, mFast);
-    if ( gid1 != fgmgr.group_num() ) {
-      // 見つけた．
-      if ( mPrintDetail ) {
-	ymuint ipos = 0;
-	for (ipos = 0; ipos < ng; ++ ipos) {
-	  if ( tmp_group_list[ipos] == gid1 ) {
-	    break;
-	  }
-	}
-	move_list[fpos] = group_list[ipos];
-      }
-    }
-    else {
+    if ( gid1 == fgmgr.group_num() ) {
       // 見つからなかった．
       // このグループの処理は中止する．
       red = false;
       break;
     }
+
+    ymuint ipos = 0;
+    for (ipos = 0; ipos < ng; ++ ipos) {
+      if ( group_list[ipos] == gid1 ) {
+	break;
+      }
+    }
+    move_list.push_back(ipos);
   }
+
   if ( red ) {
-    // 変更を反映させる．
+    vector<bool> changed(ng, false);
+    for (ymuint fpos = 0; fpos < nf; ++ fpos) {
+      changed[move_list[fpos]] = true;
+    }
     for (ymuint i = 0; i < ng; ++ i) {
-      ymuint gid1 = group_list[i];
-      ymuint gid2 = tmp_group_list[i];
-      if ( fgmgr.fault_num(gid1) != fgmgr.fault_num(gid2) ) {
-	fgmgr.replace_group(gid1, gid2);
+      if ( changed[i] ) {
+	changed_list.push_back(i);
       }
     }
     if ( mPrintDetail ) {
@@ -429,16 +428,22 @@ Compactor::remove_group(FgMgr& fgmgr,
       for (ymuint fpos = 0; fpos < nf; ++ fpos) {
 	ymuint fid = fgmgr.fault_id(gid0, fpos);
 	cout << "  MOVE " << fid << " from #" << gid0
-	     << " to #" << move_list[fpos] << endl;
+	     << " to #" << group_list[move_list[fpos]] << endl;
       }
       cout << "  DEL #" << gid0 << endl;
     }
   }
   else {
-    // 変更を破棄する．
+    // 移動した故障を取り除いて元に戻す．
+    vector<vector<ymuint> > del_list_array(ng);
+    for (ymuint fpos = 0; fpos < move_list.size(); ++ fpos) {
+      ymuint fid = fgmgr.fault_id(gid0, fpos);
+      del_list_array[move_list[fpos]].push_back(fid);
+    }
     for (ymuint i = 0; i < ng; ++ i) {
-      ymuint gid2 = tmp_group_list[i];
-      fgmgr.delete_group(gid2);
+      if ( !del_list_array[i].empty() ) {
+	fgmgr.delete_faults(group_list[i], del_list_array[i]);
+      }
     }
   }
   return red;
@@ -91,16 +91,19 @@ private:
   /// @param[in] gid 対象のグループ番号
   /// @param[in] group_list グループ番号のリスト
   /// @param[in] deleted 削除済みフラグの配列
+  /// @param[out] changed_list 故障を受け取ったグループの group_list 上の位置のリスト
   /// @return 削除できたら true を返す．
   ///
   /// 削除が成功した場合，gid に含まれていた故障は
   /// 他のグループに移動される．
+  /// 失敗した場合は移動した故障を移動先のグループから取り除く．
   bool
   remove_group(FgMgr& fgmgr,
 	       ymuint gid,
 	       const vector<ymuint>& group_list,
 	       ymuint count,
-	       const vector<bool>& deleted);
+	       const vector<bool>& deleted,
+	       vector<ymuint>& changed_list);
 
   /// @brief phase-2
   /// @param[in] fmgr 故障グループマネージャ
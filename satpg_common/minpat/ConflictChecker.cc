@@ -23,50 +23,11 @@
 #include "ym/RandGen.h"
 #include "ym/StopWatch.h"
 #include "ym/HashSet.h"
+#include <thread>
 
 
 BEGIN_NAMESPACE_YM_SATPG
 
-BEGIN_NONAMESPACE
-
-// 2つのリストが共通要素を持つとき true を返す．
-// リストはソートされていると仮定する．
-inline
-bool
-check_intersect(const vector<ymuint>& list1,
-		const vector<ymuint>& list2)
-{
-  ymuint n1 = list1.size();
-  ymuint n2 = list2.size();
-  ymuint i1 = 0;
-  ymuint i2 = 0;
-  ymuint v1 = list1[i1];
-  ymuint v2 = list2[i2];
-  for ( ; ; ) {
-    if ( v1 < v2 ) {
-      ++ i1;
-      if ( i1 >= n1 ) {
-	return false;
-      }
-      v1 = list1[i1];
-    }
-    else if ( v1 > v2 ) {
-      ++ i2;
-      if ( i2 >= n2 ) {
-	return false;
-      }
-      v2 = list2[i2];
-    }
-    else {
-      return true;
-    }
-  }
-  return false;
-}
-
-END_NONAMESPACE
-
-
 //////////////////////////////////////////////////////////////////////
 // クラス ConflictChecker
 //////////////////////////////////////////////////////////////////////
@@ -77,15 +38,19 @@ ConflictChecker::ConflictChecker(FaultAnalyzer& analyzer,
 				 Fsim& fsim) :
   mAnalyzer(analyzer),
   mTvMgr(tvmgr),
-  mFsim(fsim)
+  mFsim(fsim),
+  mNextPos(0)
 {
   mVerbose = mAnalyzer.verbose();
+  mThreadNum = 1;
   mMaxNodeId = mAnalyzer.max_node_id();
   mMaxFaultId = mAnalyzer.max_fault_id();
   mFaultDataArray.resize(mMaxFaultId);
   for (ymuint i = 0; i < mMaxFaultId; ++ i) {
     mFaultDataArray[i].mDetCount = 0;
   }
+  mConflictStats.resize(1);
+  mConflictStats[0].clear();
 }
 
 // @brief デストラクタ
@@ -101,52 +66,83 @@ ConflictChecker::set_verbose(int verbose)
   mVerbose = verbose;
 }
 
+// @brief 衝突の解析を行う時のスレッド数を設定する．
+// @param[in] num スレッド数 (0 の場合はハードウェアの並列度)
+void
+ConflictChecker::set_thread_num(ymuint num)
+{
+  if ( num == 0 ) {
+    num = std::thread::hardware_concurrency();
+    if ( num == 0 ) {
+      num = 1;
+    }
+  }
+  mThreadNum = num;
+}
+
 // @brief 故障間の衝突性を調べる．
+//
+// f1 側の故障をスレッドで分担し，各スレッドは見つけた衝突の対を
+// 自分用のリストに記録する．
+// mConflictList への書き込みは全スレッドの終了後にこのスレッドで行う．
 void
 ConflictChecker::analyze_conflict(const vector<ymuint>& fid_list)
 {
   StopWatch local_timer;
   local_timer.start();
 
-  mConflictStats.conf_timer.reset();
-  mConflictStats.conf1_timer.reset();
-  mConflictStats.conf2_timer.reset();
-  mConflictStats.conf3_timer.reset();
-  mConflictStats.conf4_timer.reset();
-  mConflictStats.int1_timer.reset();
-  mConflictStats.int2_timer.reset();
-  mConflictStats.conf_count = 0;
-  mConflictStats.conf1_count = 0;
-  mConflictStats.conf2_count = 0;
-  mConflictStats.conf3_count = 0;
-  mConflictStats.conf4_count = 0;
-  mConflictStats.conf4_check_count = 0;
-  mConflictStats.int1_count = 0;
-  mConflictStats.int2_count = 0;
-
   // シミュレーション結果を用いてコンフリクトチェックのスクリーニングを行う．
   do_fsim(fid_list);
 
   ymuint fault_num = fid_list.size();
-  for (ymuint i1 = 0; i1 < fault_num; ++ i1) {
-    ymuint f1_id = fid_list[i1];
+  ymuint nt = mThreadNum;
+  if ( nt > fault_num ) {
+    nt = fault_num;
+  }
+  if ( nt == 0 ) {
+    nt = 1;
+  }
 
-    if ( mVerbose > 1 ) {
-      cout << "\rCFL: " << setw(6) << i1 << " / " << setw(6) << fault_num;
-      cout.flush();
-    }
+  mConflictStats.clear();
+  mConflictStats.resize(nt);
+  for (ymuint i = 0; i < nt; ++ i) {
+    mConflictStats[i].clear();
+  }
 
-    const vector<ymuint>& ma_conf_list = mFaultDataArray[f1_id].mMaConflictList;
-    for (ymuint i = 0; i < ma_conf_list.size(); ++ i) {
-      ymuint f2_id = ma_conf_list[i];
-      mFaultDataArray[f1_id].mConflictList.push_back(f2_id);
+  mNextPos = 0;
+
+  vector<vector<pair<ymuint, ymuint> > > pair_list_array(nt);
+  if ( nt == 1 ) {
+    conflict_worker(fid_list, mVerbose > 1, pair_list_array[0], mConflictStats[0]);
+  }
+  else {
+    vector<std::thread> thread_list;
+    thread_list.reserve(nt);
+    for (ymuint i = 0; i < nt; ++ i) {
+      // 進捗は最初のスレッドだけが表示する．
+      bool local_verbose = (i == 0) && (mVerbose > 1);
+      thread_list.push_back(std::thread(&ConflictChecker::conflict_worker, this,
+					std::cref(fid_list), local_verbose,
+					std::ref(pair_list_array[i]),
+					std::ref(mConflictStats[i])));
     }
+    for (ymuint i = 0; i < nt; ++ i) {
+      thread_list[i].join();
+    }
+  }
 
-    vector<ymuint>& f2_list = mFaultDataArray[f1_id].mCandList;
-    vector<ymuint> conf_list;
-    analyze_conflict(f1_id, f2_list, conf_list, false, false);
-    for (ymuint i = 0; i < conf_list.size(); ++ i) {
-      ymuint f2_id = conf_list[i];
+  for (ymuint i1 = 0; i1 < fault_num; ++ i1) {
+    ymuint f1_id = fid_list[i1];
+    FaultData& fd = mFaultDataArray[f1_id];
+    const vector<ymuint>& ma_conf_list = fd.mMaConflictList;
+    fd.mConflictList.insert(fd.mConflictList.end(),
+			    ma_conf_list.begin(), ma_conf_list.end());
+  }
+  for (ymuint i = 0; i < nt; ++ i) {
+    const vector<pair<ymuint, ymuint> >& pair_list = pair_list_array[i];
+    for (ymuint j = 0; j < pair_list.size(); ++ j) {
+      ymuint f1_id = pair_list[j].first;
+      ymuint f2_id = pair_list[j].second;
       mFaultDataArray[f1_id].mConflictList.push_back(f2_id);
       mFaultDataArray[f2_id].mConflictList.push_back(f1_id);
     }
@@ -184,7 +180,7 @@ ConflictChecker::analyze_conflict(ymuint f1_id,
   const vector<ymuint>& ma_conf_list = mFaultDataArray[f1_id].mMaConflictList;
   vector<ymuint>& f2_list = mFaultDataArray[f1_id].mCandList;
   vector<ymuint> conf1_list;
-  analyze_conflict(f1_id, f2_list, conf1_list, false, false);
+  analyze_conflict(f1_id, f2_list, conf1_list, false, false, mConflictStats[0]);
 
   conf_list.clear();
   conf_list.reserve(ma_conf_list.size() + conf1_list.size());
@@ -215,15 +211,53 @@ ConflictChecker::estimate_conflict(const vector<ymuint>& fid_list,
   }
 }
 
+// @brief analyze_conflict(fid_list) のワーカースレッドの本体
+// @param[in] fid_list 故障番号のリスト
+// @param[in] local_verbose 進捗を表示する時 true にするフラグ
+// @param[out] pair_list 衝突している故障番号の対のリスト
+// @param[inout] stats このスレッド用の統計情報
+//
+// mFaultDataArray はここでは読むだけなのでロックは必要ない．
+void
+ConflictChecker::conflict_worker(const vector<ymuint>& fid_list,
+				 bool local_verbose,
+				 vector<pair<ymuint, ymuint> >& pair_list,
+				 ConflictStats& stats)
+{
+  ymuint fault_num = fid_list.size();
+  vector<ymuint> conf_list;
+  for ( ; ; ) {
+    ymuint i1 = mNextPos.fetch_add(1);
+    if ( i1 >= fault_num ) {
+      break;
+    }
+    ymuint f1_id = fid_list[i1];
+
+    if ( local_verbose ) {
+      cout << "\rCFL: " << setw(6) << i1 << " / " << setw(6) << fault_num;
+      cout.flush();
+    }
+
+    const vector<ymuint>& f2_list = mFaultDataArray[f1_id].mCandList;
+    conf_list.clear();
+    analyze_conflict(f1_id, f2_list, conf_list, false, false, stats);
+    for (ymuint i = 0; i < conf_list.size(); ++ i) {
+      ymuint f2_id = conf_list[i];
+      pair_list.push_back(make_pair(f1_id, f2_id));
+    }
+  }
+}
+
 // @brief 1つの故障と複数の故障間の衝突性を調べる．
 void
 ConflictChecker::analyze_conflict(ymuint f1_id,
 				  const vector<ymuint>& f2_list,
 				  vector<ymuint>& conf_list,
 				  bool simple,
-				  bool local_verbose)
+				  bool local_verbose,
+				  ConflictStats& stats)
 {
-  mConflictStats.conf_timer.start();
+  stats.conf_timer.start();
 
   const FaultInfo& fi1 = mAnalyzer.fault_info(f1_id);
   const NodeValList& suf_list1 = fi1.sufficient_assignment();
@@ -254,43 +288,43 @@ ConflictChecker::analyze_conflict(ymuint f1_id,
     const NodeValList& suf_list2 = fi2.sufficient_assignment();
     const NodeValList& ma_list2 = fi2.mandatory_assignment();
 
-    mConflictStats.int2_timer.start();
+    stats.int2_timer.start();
     SatBool3 sat_stat = gval_cnf.check_sat(suf_list2);
     if ( sat_stat == kB3True ) {
       // f2 の十分割当のもとで f1 が検出できれば f1 と f2 はコンフリクトしない．
-      ++ mConflictStats.int2_count;
-      mConflictStats.int2_timer.stop();
+      ++ stats.int2_count;
+      stats.int2_timer.stop();
       continue;
     }
-    mConflictStats.int2_timer.stop();
+    stats.int2_timer.stop();
 
     if ( fi2.single_cube() ) {
       if ( sat_stat == kB3False ) {
-	++ mConflictStats.conf_count;
-	++ mConflictStats.conf3_count;
+	++ stats.conf_count;
+	++ stats.conf3_count;
 	conf_list.push_back(f2_id);
       }
       // f2 の十分割当と必要割当が等しければ上のチェックで終わり．
       continue;
     }
 
-    mConflictStats.conf3_timer.start();
+    stats.conf3_timer.start();
     if ( gval_cnf.check_sat(ma_list2) == kB3False ) {
       // f2 の必要割当のもとで f1 が検出できなければ f1 と f2 はコンフリクトしている．
-      ++ mConflictStats.conf_count;
-      ++ mConflictStats.conf3_count;
+      ++ stats.conf_count;
+      ++ stats.conf3_count;
       conf_list.push_back(f2_id);
-      mConflictStats.conf3_timer.stop();
+      stats.conf3_timer.stop();
       continue;
     }
-    mConflictStats.conf3_timer.stop();
+    stats.conf3_timer.stop();
 
     if ( simple ) {
       continue;
     }
 
-    mConflictStats.conf4_timer.start();
-    ++ mConflictStats.conf4_check_count;
+    stats.conf4_timer.start();
+    ++ stats.conf4_check_count;
     {
       GvalCnf gval_cnf(mMaxNodeId, string(), string(), nullptr);
 
@@ -316,12 +350,12 @@ ConflictChecker::analyze_conflict(ymuint f1_id,
 
       SatBool3 sat_stat = gval_cnf.check_sat();
       if ( sat_stat == kB3False ) {
-	++ mConflictStats.conf_count;
-	++ mConflictStats.conf4_count;
+	++ stats.conf_count;
+	++ stats.conf4_count;
 	conf_list.push_back(f2_id);
       }
     }
-    mConflictStats.conf4_timer.stop();
+    stats.conf4_timer.stop();
   }
 #else
   StructSat struct_sat(mMaxNodeId);
@@ -345,43 +379,43 @@ ConflictChecker::analyze_conflict(ymuint f1_id,
     const NodeValList& suf_list2 = fi2.sufficient_assignment();
     const NodeValList& ma_list2 = fi2.mandatory_assignment();
 
-    mConflictStats.int2_timer.start();
+    stats.int2_timer.start();
     SatBool3 sat_stat = struct_sat.check_sat(suf_list2);
     if ( sat_stat == kB3True ) {
       // f2 の十分割当のもとで f1 が検出できれば f1 と f2 はコンフリクトしない．
-      ++ mConflictStats.int2_count;
-      mConflictStats.int2_timer.stop();
+      ++ stats.int2_count;
+      stats.int2_timer.stop();
       continue;
     }
-    mConflictStats.int2_timer.stop();
+    stats.int2_timer.stop();
 
     if ( fi2.single_cube() ) {
       if ( sat_stat == kB3False ) {
-	++ mConflictStats.conf_count;
-	++ mConflictStats.conf3_count;
+	++ stats.conf_count;
+	++ stats.conf3_count;
 	conf_list.push_back(f2_id);
       }
       // f2 の十分割当と必要割当が等しければ上のチェックで終わり．
       continue;
     }
 
-    mConflictStats.conf3_timer.start();
+    stats.conf3_timer.start();
     if ( struct_sat.check_sat(ma_list2) == kB3False ) {
       // f2 の必要割当のもとで f1 が検出できなければ f1 と f2 はコンフリクトしている．
-      ++ mConflictStats.conf_count;
-      ++ mConflictStats.conf3_count;
+      ++ stats.conf_count;
+      ++ stats.conf3_count;
       conf_list.push_back(f2_id);
-      mConflictStats.conf3_timer.stop();
+      stats.conf3_timer.stop();
       continue;
     }
-    mConflictStats.conf3_timer.stop();
+    stats.conf3_timer.stop();
 
     if ( simple ) {
       continue;
     }
 
-    mConflictStats.conf4_timer.start();
-    ++ mConflictStats.conf4_check_count;
+    stats.conf4_timer.start();
+    ++ stats.conf4_check_count;
     {
       StructSat struct_sat(mMaxNodeId);
 
@@ -401,16 +435,16 @@ ConflictChecker::analyze_conflict(ymuint f1_id,
 
       SatBool3 sat_stat = struct_sat.check_sat();
       if ( sat_stat == kB3False ) {
-	++ mConflictStats.conf_count;
-	++ mConflictStats.conf4_count;
+	++ stats.conf_count;
+	++ stats.conf4_count;
 	conf_list.push_back(f2_id);
       }
     }
-    mConflictStats.conf4_timer.stop();
+    stats.conf4_timer.stop();
   }
 #endif
 
-  mConflictStats.conf_timer.stop();
+  stats.conf_timer.stop();
 
   if ( mVerbose > 0 && local_verbose ) {
     if ( mVerbose > 1 ) {
@@ -424,15 +458,62 @@ ConflictChecker::analyze_conflict(ymuint f1_id,
 void
 ConflictChecker::print_conflict_stats(ostream& s)
 {
-  s << "Total    " << setw(6) << mConflictStats.conf_count  << " conflicts" << endl;
-  s << "Total    " << setw(6) << mConflictStats.conf3_count << " conflicts (single ma_list)" << endl;
-  s << "Total    " << setw(6) << mConflictStats.conf4_count << " conflicts (exact) / "
-       << setw(6) << mConflictStats.conf4_check_count << endl;
-  s << "Total    " << setw(6) << mConflictStats.int2_count  << " suf_list intersection check" << endl;
-  s << "CPU time (conflict check)    " << mConflictStats.conf_timer.time() << endl;
-  s << "CPU time (single conflict)   " << mConflictStats.conf3_timer.time() << endl;
-  s << "CPU time (exact conflict)    " << mConflictStats.conf4_timer.time() << endl;
-  s << "CPU time (single suf_list)   " << mConflictStats.int2_timer.time() << endl;
+  ymuint conf_count = 0;
+  ymuint conf3_count = 0;
+  ymuint conf4_count = 0;
+  ymuint conf4_check_count = 0;
+  ymuint int2_count = 0;
+  USTime conf_time;
+  USTime conf3_time;
+  USTime conf4_time;
+  USTime int2_time;
+  for (ymuint i = 0; i < mConflictStats.size(); ++ i) {
+    const ConflictStats& stats = mConflictStats[i];
+    conf_count += stats.conf_count;
+    conf3_count += stats.conf3_count;
+    conf4_count += stats.conf4_count;
+    conf4_check_count += stats.conf4_check_count;
+    int2_count += stats.int2_count;
+    conf_time += stats.conf_timer.time();
+    conf3_time += stats.conf3_timer.time();
+    conf4_time += stats.conf4_timer.time();
+    int2_time += stats.int2_timer.time();
+  }
+
+  s << "Total    " << setw(6) << conf_count  << " conflicts" << endl;
+  s << "Total    " << setw(6) << conf3_count << " conflicts (single ma_list)" << endl;
+  s << "Total    " << setw(6) << conf4_count << " conflicts (exact) / "
+       << setw(6) << conf4_check_count << endl;
+  s << "Total    " << setw(6) << int2_count  << " suf_list intersection check" << endl;
+  s << "CPU time (conflict check)    " << conf_time << endl;
+  s << "CPU time (single conflict)   " << conf3_time << endl;
+  s << "CPU time (exact conflict)    " << conf4_time << endl;
+  s << "CPU time (single suf_list)   " << int2_time << endl;
+  if ( mConflictStats.size() > 1 ) {
+    s << "(CPU times are summed over " << mConflictStats.size() << " threads)" << endl;
+  }
+}
+
+// @brief 内容をクリアする．
+void
+ConflictChecker::ConflictStats::clear()
+{
+  conf_count = 0;
+  conf1_count = 0;
+  conf2_count = 0;
+  conf3_count = 0;
+  conf4_count = 0;
+  conf4_check_count = 0;
+  int1_count = 0;
+  int2_count = 0;
+
+  conf_timer.reset();
+  conf1_timer.reset();
+  conf2_timer.reset();
+  conf3_timer.reset();
+  conf4_timer.reset();
+  int1_timer.reset();
+  int2_timer.reset();
 }
 
 // @brief 故障シミュレーションを行い，故障検出パタンを記録する．
@@ -559,7 +640,6 @@ ConflictChecker::record_pat(const vector<pair<ymuint, PackedVal> >& det_list,
       const FaultInfo& fi1 = mAnalyzer.fault_info(f1_id);
       const NodeValList& pi_suf_list1 = fi1.pi_sufficient_assignment();
       const NodeValList& ma_list1 = fi1.mandatory_assignment();
-      const vector<ymuint>& input_list1 = mAnalyzer.input_list(f1_id);
       for (ymuint j = 0; j < fid_list.size(); ++ j) {
 	ymuint f2_id = fid_list[j];
 	if ( f2_id == f1_id ) {
@@ -570,9 +650,7 @@ ConflictChecker::record_pat(const vector<pair<ymuint, PackedVal> >& det_list,
 	  continue;
 	}
 
-	const vector<ymuint>& input_list2 = mAnalyzer.input_list(f2_id);
-	bool intersect = check_intersect(input_list1, input_list2);
-	if ( !intersect ) {
+	if ( !mAnalyzer.check_input_intersect(f1_id, f2_id) ) {
 	  // 共通部分を持たない故障は独立
 	  continue;
 	}
@@ -13,6 +13,7 @@
 #include "PackedVal.h"
 #include "ym/RandGen.h"
 #include "ym/StopWatch.h"
+#include <atomic>
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -48,6 +49,14 @@ public:
   void
   set_verbose(int verbose);
 
+  /// @brief 衝突の解析を行う時のスレッド数を設定する．
+  /// @param[in] num スレッド数 (0 の場合はハードウェアの並列度)
+  ///
+  /// 2 以上の場合は f1 側の故障をスレッドで分担する．
+  /// SAT ソルバは各スレッドで個別に作られる．
+  void
+  set_thread_num(ymuint num);
+
   /// @brief 衝突の解析を行う．
   void
   analyze_conflict(const vector<ymuint>& fid_list);
@@ -79,6 +88,56 @@ public:
 		    vector<ymuint>& conf_num_array);
 
 
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられるデータ構造
+  //////////////////////////////////////////////////////////////////////
+
+  // 故障ごとのデータ
+  struct FaultData
+  {
+    ymuint mDetCount;
+
+    // 衝突候補の故障番号リスト
+    vector<ymuint> mCandList;
+
+    ymuint mCandListSize;
+
+    vector<ymuint> mMaConflictList;
+
+    // 衝突している故障のリスト
+    vector<ymuint> mConflictList;
+  };
+
+  // analyze_conflict 用の統計情報
+  //
+  // スレッドごとに一つずつ用いる．
+  struct ConflictStats
+  {
+    /// @brief 内容をクリアする．
+    void
+    clear();
+
+    // コンフリクト回数
+    ymuint conf_count;
+    ymuint conf1_count;
+    ymuint conf2_count;
+    ymuint conf3_count;
+    ymuint conf4_count;
+    ymuint conf4_check_count;
+    ymuint int1_count;
+    ymuint int2_count;
+
+    StopWatch conf_timer;
+    StopWatch conf1_timer;
+    StopWatch conf2_timer;
+    StopWatch conf3_timer;
+    StopWatch conf4_timer;
+    StopWatch int1_timer;
+    StopWatch int2_timer;
+  };
+
+
 private:
   //////////////////////////////////////////////////////////////////////
   // 内部で用いられる関数
@@ -90,12 +149,25 @@ private:
   /// @param[out] f1 と衝突する故障のリスト
   /// @param[in] simple 高速化ヒューリスティック
   /// @param[in] local_verbose 出力制御フラグ
+  /// @param[inout] stats 統計情報
   void
   analyze_conflict(ymuint f1_id,
 		   const vector<ymuint>& f2_list,
 		   vector<ymuint>& conf_list,
 		   bool simple,
-		   bool local_verbose);
+		   bool local_verbose,
+		   ConflictStats& stats);
+
+  /// @brief analyze_conflict(fid_list) のワーカースレッドの本体
+  /// @param[in] fid_list 故障番号のリスト
+  /// @param[in] local_verbose 進捗を表示する時 true にするフラグ
+  /// @param[out] pair_list 衝突している故障番号の対のリスト
+  /// @param[inout] stats このスレッド用の統計情報
+  void
+  conflict_worker(const vector<ymuint>& fid_list,
+		  bool local_verbose,
+		  vector<pair<ymuint, ymuint> >& pair_list,
+		  ConflictStats& stats);
 
   /// @brief 故障シミュレーションの後処理
   ymuint
@@ -103,32 +175,12 @@ private:
 	     const vector<ymuint>& fid_list);
 
   /// @brief analyze_conflict の統計情報を出力する．
+  ///
+  /// 全スレッドの統計情報を合計して出力する．
   void
   print_conflict_stats(ostream& s);
 
 
-private:
-  //////////////////////////////////////////////////////////////////////
-  // 内部で用いられるデータ構造
-  //////////////////////////////////////////////////////////////////////
-
-  // 故障ごとのデータ
-  struct FaultData
-  {
-    ymuint mDetCount;
-
-    // 衝突候補の故障番号リスト
-    vector<ymuint> mCandList;
-
-    ymuint mCandListSize;
-
-    vector<ymuint> mMaConflictList;
-
-    // 衝突している故障のリスト
-    vector<ymuint> mConflictList;
-  };
-
-
 private:
   //////////////////////////////////////////////////////////////////////
   // データメンバ
@@ -146,6 +198,9 @@ private:
   // 故障シミュレータ
   Fsim& mFsim;
 
+  // スレッド数
+  ymuint mThreadNum;
+
   // 最大ノード番号
   ymuint mMaxNodeId;
 
@@ -158,26 +213,11 @@ private:
   // 故障ごとのデータ配列
   vector<FaultData> mFaultDataArray;
 
-  // analyze_conflict 用の統計情報
-  struct {
-    // コンフリクト回数
-    ymuint conf_count;
-    ymuint conf1_count;
-    ymuint conf2_count;
-    ymuint conf3_count;
-    ymuint conf4_count;
-    ymuint conf4_check_count;
-    ymuint int1_count;
-    ymuint int2_count;
+  // analyze_conflict(fid_list) で次に処理する故障の位置
+  std::atomic<ymuint> mNextPos;
 
-    StopWatch conf_timer;
-    StopWatch conf1_timer;
-    StopWatch conf2_timer;
-    StopWatch conf3_timer;
-    StopWatch conf4_timer;
-    StopWatch int1_timer;
-    StopWatch int2_timer;
-  } mConflictStats;
+  // スレッドごとの analyze_conflict 用の統計情報
+  vector<ConflictStats> mConflictStats;
 
 };
 
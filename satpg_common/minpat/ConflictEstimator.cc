@@ -31,41 +31,6 @@ BEGIN_NAMESPACE_YM_SATPG
 
 BEGIN_NONAMESPACE
 
-// 2つのリストが共通要素を持つとき true を返す．
-// リストはソートされていると仮定する．
-inline
-bool
-check_intersect(const vector<ymuint>& list1,
-		const vector<ymuint>& list2)
-{
-  ymuint n1 = list1.size();
-  ymuint n2 = list2.size();
-  ymuint i1 = 0;
-  ymuint i2 = 0;
-  ymuint v1 = list1[i1];
-  ymuint v2 = list2[i2];
-  for ( ; ; ) {
-    if ( v1 < v2 ) {
-      ++ i1;
-      if ( i1 >= n1 ) {
-	return false;
-      }
-      v1 = list1[i1];
-    }
-    else if ( v1 > v2 ) {
-      ++ i2;
-      if ( i2 >= n2 ) {
-	return false;
-      }
-      v2 = list2[i2];
-    }
-    else {
-      return true;
-    }
-  }
-  return false;
-}
-
 // パタン番号リストの包含関係を調べる．
 // 0 bit: list1 のみの要素がある．
 // 1 bit: list2 のみの要素がある．
@@ -731,16 +696,13 @@ ConflictChecker::record_pat(const vector<ymuint>& det_list,
     if ( fd.mDetCount == 1 ) {
       // 初めて検出された場合
       // 構造的に独立でない故障を候補にする．
-      const vector<ymuint>& input_list1 = mAnalyzer.input_list(f_id);
       for (ymuint j = 0; j < fault_list.size(); ++ j) {
 	const TpgFault* f2 = fault_list[j];
 	ymuint f2_id = f2->id();
 	if ( f2_id == f_id ) {
 	  continue;
 	}
-	const vector<ymuint>& input_list2 = mAnalyzer.input_list(f2_id);
-	bool intersect = check_intersect(input_list1, input_list2);
-	if ( !intersect ) {
+	if ( !mAnalyzer.check_input_intersect(f_id, f2_id) ) {
 	  // 共通部分を持たない故障は独立
 	  continue;
 	}
@@ -38,6 +38,18 @@ DetOp::operator()(const TpgFault* f,
   mDetList.push_back(make_pair(f_id, dpat));
 }
 
+// @brief 故障を検出したときの処理(多ワード版)
+// @param[in] f 故障
+// @param[in] dpat 検出したパタンを表すビットベクタ
+//
+// DetOp は kPvBitLen 個以下のパタンでのみ用いる．
+void
+DetOp::operator()(const TpgFault* f,
+		  const PackedValW& dpat)
+{
+  ASSERT_NOT_REACHED;
+}
+
 // @brief 検出された故障のID番号のリストを返す．
 const vector<pair<ymuint, PackedVal> >&
 DetOp::det_list()
@@ -44,6 +44,14 @@ public:
   operator()(const TpgFault* f,
 	     PackedVal dpat);
 
+  /// @brief 故障を検出したときの処理(多ワード版)
+  /// @param[in] f 故障
+  /// @param[in] dpat 検出したパタンを表すビットベクタ
+  virtual
+  void
+  operator()(const TpgFault* f,
+	     const PackedValW& dpat);
+
   /// @brief 検出された故障のID番号とビットベクタの対のリストを返す．
   const vector<pair<ymuint, PackedVal> >&
   det_list();
@@ -16,6 +16,8 @@
 #include "Fsim.h"
 #include "DetOp.h"
 #include "StructSat.h"
+#include "DomSolver.h"
+#include "TpgNode.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -70,41 +72,6 @@ struct FaultGt
 
 };
 
-// 2つのリストが共通要素を持つとき true を返す．
-// リストはソートされていると仮定する．
-inline
-bool
-check_intersect(const vector<ymuint>& list1,
-		const vector<ymuint>& list2)
-{
-  ymuint n1 = list1.size();
-  ymuint n2 = list2.size();
-  ymuint i1 = 0;
-  ymuint i2 = 0;
-  ymuint v1 = list1[i1];
-  ymuint v2 = list2[i2];
-  for ( ; ; ) {
-    if ( v1 < v2 ) {
-      ++ i1;
-      if ( i1 >= n1 ) {
-	return false;
-      }
-      v1 = list1[i1];
-    }
-    else if ( v1 > v2 ) {
-      ++ i2;
-      if ( i2 >= n2 ) {
-	return false;
-      }
-      v2 = list2[i2];
-    }
-    else {
-      return true;
-    }
-  }
-  return false;
-}
-
 const TpgNode*
 common_node(const TpgNode* node1,
 	    const TpgNode* node2)
@@ -332,15 +299,12 @@ DomChecker::do_fsim(const vector<ymuint>& fid_list)
   for (ymuint i1 = 0; i1 < nf; ++ i1) {
     ymuint f1_id = fid_list[i1];
     FaultData& fd1 = mFaultDataArray[f1_id];
-    const vector<ymuint>& input_list1 = mAnalyzer.input_list(f1_id);
 
     vector<ymuint>& dst_list = fd1.mDomCandList1;
     ymuint wpos = 0;
     for (ymuint rpos = 0; rpos < dst_list.size(); ++ rpos) {
       ymuint f2_id = dst_list[rpos];
-      const vector<ymuint>& input_list2 = mAnalyzer.input_list(f2_id);
-      bool intersect = check_intersect(input_list1, input_list2);
-      if ( !intersect ) {
+      if ( !mAnalyzer.check_input_intersect(f1_id, f2_id) ) {
 	// 共通部分を持たない故障は独立
 	continue;
       }
@@ -367,15 +331,13 @@ DomChecker::do_fsim(const vector<ymuint>& fid_list)
   for (ymuint i = 0; i < nf; ++ i) {
     ymuint f1_id = tmp_fid_list[i];
     FaultData& fd1 = mFaultDataArray[f1_id];
-    const vector<ymuint>& input_list1_2 = mAnalyzer.input_list2(f1_id);
 
     const vector<ymuint>& cand_list = fd1.mDomCandList1;
     for (ymuint j = 0; j < cand_list.size(); ++ j) {
       ymuint f2_id = cand_list[j];
       FaultData& fd2 = mFaultDataArray[f2_id];
-      const vector<ymuint>& input_list2_2 = mAnalyzer.input_list2(f2_id);
       // TFI が共通部分をもつかどうかでリストを分ける．
-      if ( check_intersect(input_list1_2, input_list2_2) ) {
+      if ( mAnalyzer.check_input2_intersect(f1_id, f2_id) ) {
 	fd2.mDomCandList2[0].push_back(f1_id);
       }
       else {
@@ -476,6 +438,9 @@ DomChecker::record_dom_cand(const vector<pair<ymuint, PackedVal> >& det_list)
 // @param[in] src_list 対象の故障のリスト
 // @param[in] idx 故障候補リストのインデックス
 // @param[in] dst_list 支配されていない故障のリスト
+//
+// 被支配故障の候補を FFR ごとにまとめて，FFR ごとに一つの
+// DomSolver を使いまわす．
 void
 DomChecker::get_dom_faults1(const vector<ymuint>& src_list,
 			    ymuint idx,
@@ -486,93 +451,119 @@ DomChecker::get_dom_faults1(const vector<ymuint>& src_list,
 
   ymuint fault_num = src_list.size();
   ymuint cur_num = fault_num;
-  for (ymuint i1 = 0; i1 < fault_num; ++ i1) {
-    ymuint f1_id = src_list[i1];
-    if ( mDomFlag[f1_id] ) {
-      continue;
-    }
 
-    // f1 を支配する可能性のある故障番号のリスト
-    FaultData& fd1 = mFaultDataArray[f1_id];
-    const vector<ymuint>& cand_list = fd1.mDomCandList2[idx];
-    if ( cand_list.empty() ) {
-      continue;
+  // 故障を FFR ごとにまとめる．
+  // FFR の順番は最初に現れた順，FFR 内は src_list の順とする．
+  vector<const TpgNode*> root_list;
+  vector<vector<ymuint> > group_list;
+  {
+    vector<int> group_map(mMaxNodeId, -1);
+    for (ymuint i = 0; i < fault_num; ++ i) {
+      ymuint f_id = src_list[i];
+      const TpgNode* root = mAnalyzer.fault(f_id)->tpg_onode()->ffr_root();
+      int g = group_map[root->id()];
+      if ( g == -1 ) {
+	g = group_list.size();
+	group_map[root->id()] = g;
+	root_list.push_back(root);
+	group_list.push_back(vector<ymuint>());
+      }
+      group_list[g].push_back(f_id);
     }
+  }
 
-    if ( mVerbose > 1 ) {
-      cout << "\rDOM" << (idx + 1) << ": " << setw(6) << i1 << " / " << setw(6) << fault_num
-	   << " / " << setw(6) << cur_num;
-      cout.flush();
-    }
+  ymuint i1 = 0;
+  for (ymuint g = 0; g < group_list.size(); ++ g) {
+    const vector<ymuint>& f1_list = group_list[g];
+    DomSolver* dom_solver = nullptr;
+    for (ymuint k = 0; k < f1_list.size(); ++ k, ++ i1) {
+      ymuint f1_id = f1_list[k];
+      if ( mDomFlag[f1_id] ) {
+	continue;
+      }
 
-    const TpgFault* f1 = mAnalyzer.fault(f1_id);
+      // f1 を支配する可能性のある故障番号のリスト
+      FaultData& fd1 = mFaultDataArray[f1_id];
+      const vector<ymuint>& cand_list = fd1.mDomCandList2[idx];
+      if ( cand_list.empty() ) {
+	continue;
+      }
 
-    StructSat struct_sat(mMaxNodeId);
+      if ( mVerbose > 1 ) {
+	cout << "\rDOM" << (idx + 1) << ": " << setw(6) << i1 << " / " << setw(6) << fault_num
+	     << " / " << setw(6) << cur_num;
+	cout.flush();
+      }
 
-    // f1 を検出しない CNF を作成
-    struct_sat.add_focone(f1, kVal0);
+      const TpgFault* f1 = mAnalyzer.fault(f1_id);
 
-    for (ymuint i2 = 0; i2 < cand_list.size(); ++ i2) {
-      ymuint f2_id = cand_list[i2];
-      if ( mDomFlag[f2_id] ) {
-	continue;
+      if ( dom_solver == nullptr ) {
+	dom_solver = new DomSolver(mMaxNodeId, root_list[g]);
       }
 
-      const FaultInfo& fi2 = mAnalyzer.fault_info(f2_id);
-      const TpgFault* f2 = fi2.fault();
+      for (ymuint i2 = 0; i2 < cand_list.size(); ++ i2) {
+	ymuint f2_id = cand_list[i2];
+	if ( mDomFlag[f2_id] ) {
+	  continue;
+	}
 
-      ++ stats.mSingleSat;
+	const FaultInfo& fi2 = mAnalyzer.fault_info(f2_id);
+	const TpgFault* f2 = fi2.fault();
 
-      // これが f2 の十分割当のもとで成り立ったら支配しない
-      if ( struct_sat.check_sat(fi2.sufficient_assignment()) == kB3True ) {
-	if ( print_dom_detail ) {
-	  cout << "NODOM(1) " << f1->str() << " " << f2->str() << endl;
-	}
-	++ stats.mNoDom;
-	if ( verify_dom_check ) {
-	  bool check = mAnalyzer.check_dominance(f2_id, f1_id);
-	  if ( check ) {
-	    cout << "ERROR in check_dominance(" << f2->str() << ", " << f1->str() << ")[NODOM(1)]" << endl;
-	    exit(1);
+	++ stats.mSingleSat;
+
+	// f2 の十分割当のもとで f1 を検出しない割当があれば支配しない
+	if ( dom_solver->check_undetect(f1, fi2.sufficient_assignment()) == kB3True ) {
+	  if ( print_dom_detail ) {
+	    cout << "NODOM(1) " << f1->str() << " " << f2->str() << endl;
 	  }
+	  ++ stats.mNoDom;
+	  if ( verify_dom_check ) {
+	    bool check = mAnalyzer.check_dominance(f2_id, f1_id);
+	    if ( check ) {
+	      cout << "ERROR in check_dominance(" << f2->str() << ", " << f1->str() << ")[NODOM(1)]" << endl;
+	      exit(1);
+	    }
+	  }
+	  continue;
 	}
-	continue;
-      }
-      if ( fi2.single_cube() ) {
-	// これ以上のチェックは必要ない．
-	if ( print_dom_detail ) {
-	  cout << "DOM(2) " << f1->str() << " " << f2->str() << endl;
-	}
-	mDomFlag[f1_id] = true;
-	mAnalyzer.add_dom_fault(f2_id, f1_id);
-	++ stats.mSingleDom;
-	-- cur_num;
-	if ( verify_dom_check ) {
-	  bool check = mAnalyzer.check_dominance(f2_id, f1_id);
-	  if ( !check ) {
-	    cout << "ERROR in check_dominance(" << f2->str() << ", " << f1->str() << ")[DOM(2)]" << endl;
-	    exit(1);
+	if ( fi2.single_cube() ) {
+	  // これ以上のチェックは必要ない．
+	  if ( print_dom_detail ) {
+	    cout << "DOM(2) " << f1->str() << " " << f2->str() << endl;
+	  }
+	  mDomFlag[f1_id] = true;
+	  mAnalyzer.add_dom_fault(f2_id, f1_id);
+	  ++ stats.mSingleDom;
+	  -- cur_num;
+	  if ( verify_dom_check ) {
+	    bool check = mAnalyzer.check_dominance(f2_id, f1_id);
+	    if ( !check ) {
+	      cout << "ERROR in check_dominance(" << f2->str() << ", " << f1->str() << ")[DOM(2)]" << endl;
+	      exit(1);
+	    }
 	  }
+	  break;
 	}
-	break;
-      }
 
-      // 実際にチェックを行う．
-      ++ stats.mSat;
-      if ( mAnalyzer.check_dominance(f2_id, f1_id) ) {
+	// 実際にチェックを行う．
+	++ stats.mSat;
+	if ( dom_solver->check_dominance(f2, f1) ) {
+	  if ( print_dom_detail ) {
+	    cout << "DOM(3) " << f1->str() << " " << f2->str() << endl;
+	  }
+	  mDomFlag[f1_id] = true;
+	  mAnalyzer.add_dom_fault(f2_id, f1_id);
+	  ++ stats.mDom;
+	  -- cur_num;
+	  break;
+	}
 	if ( print_dom_detail ) {
-	  cout << "DOM(3) " << f1->str() << " " << f2->str() << endl;
+	  cout << "NODOM(4) " << f1->str() << " " << f2->str() << endl;
 	}
-	mDomFlag[f1_id] = true;
-	mAnalyzer.add_dom_fault(f2_id, f1_id);
-	++ stats.mDom;
-	-- cur_num;
-	break;
-      }
-      if ( print_dom_detail ) {
-	cout << "NODOM(4) " << f1->str() << " " << f2->str() << endl;
       }
     }
+    delete dom_solver;
   }
 
   // dom_flag がついた故障を落とす．
@@ -0,0 +1,159 @@
+
+/// @file DomSolver.cc
+/// @brief DomSolver の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "DomSolver.h"
+#include "FoCone.h"
+#include "TpgNode.h"
+#include "TpgFault.h"
+#include "NodeValList.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス DomSolver
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+// @param[in] max_id ノード番号の最大値 + 1
+// @param[in] root 対象の FFR の根のノード
+//
+// root の故障回路の値を正常値の否定に固定し，
+// mNoPropLit が 1 の時に外部出力の値が正常回路と一致するという節を作る．
+// FFR 内の故障を検出しない条件は FFR 内の伝搬条件の否定か
+// mNoPropLit で表される．
+DomSolver::DomSolver(ymuint max_id,
+		     const TpgNode* root) :
+  mStructSat(max_id),
+  mRoot(root)
+{
+  const FoCone* focone = mStructSat.add_focone(root, kValX);
+
+  SatSolver& solver = mStructSat.solver();
+
+  SatLiteral glit(focone->gvar(root));
+  SatLiteral flit(focone->fvar(root));
+  solver.add_clause( glit,  flit);
+  solver.add_clause(~glit, ~flit);
+
+  mNoPropLit = SatLiteral(solver.new_var());
+  ymuint npo = focone->output_num();
+  for (ymuint i = 0; i < npo; ++ i) {
+    const TpgNode* onode = focone->output_node(i);
+    SatLiteral oglit(focone->gvar(onode));
+    SatLiteral oflit(focone->fvar(onode));
+    solver.add_clause(~mNoPropLit, ~oglit,  oflit);
+    solver.add_clause(~mNoPropLit,  oglit, ~oflit);
+  }
+}
+
+// @brief デストラクタ
+DomSolver::~DomSolver()
+{
+}
+
+// @brief 故障を検出しない割当が存在するか調べる．
+// @param[in] f1 対象の故障(FFR 内の故障)
+// @param[in] assign_list 割当リスト
+SatBool3
+DomSolver::check_undetect(const TpgFault* f1,
+			  const NodeValList& assign_list)
+{
+  SatLiteral ulit = undetect_lit(f1);
+
+  vector<SatLiteral> assumptions;
+  assumptions.push_back(ulit);
+  mStructSat.conv_to_assumption(assign_list, assumptions);
+
+  vector<SatBool3> model;
+  return mStructSat.solver().solve(assumptions, model);
+}
+
+// @brief 故障の支配関係を調べる．
+// @param[in] f2 支配故障の候補
+// @param[in] f1 被支配故障の候補(FFR 内の故障)
+// @retval true f2 が f1 を支配している．
+// @retval false f2 が f1 を支配していない．
+//
+// f2 を検出する条件は f2 の FFR 内の伝搬条件と
+// その FFR の根からの伝搬条件に分けて表す．
+// 後者は FFR ごとに一度だけ作られる．
+bool
+DomSolver::check_dominance(const TpgFault* f2,
+			   const TpgFault* f1)
+{
+  SatLiteral ulit = undetect_lit(f1);
+
+  const TpgNode* root2 = f2->tpg_onode()->ffr_root();
+  SatLiteral dlit = detect_lit(root2);
+
+  vector<SatLiteral> assumptions;
+  assumptions.push_back(ulit);
+  assumptions.push_back(dlit);
+
+  NodeValList ffr_cond;
+  mStructSat.add_ffr_condition(root2, f2, ffr_cond);
+  mStructSat.conv_to_assumption(ffr_cond, assumptions);
+
+  vector<SatBool3> model;
+  SatBool3 sat_stat = mStructSat.solver().solve(assumptions, model);
+  return sat_stat == kB3False;
+}
+
+// @brief f1 を検出しない条件を表すリテラルを返す．
+// @param[in] f1 対象の故障(FFR 内の故障)
+SatLiteral
+DomSolver::undetect_lit(const TpgFault* f1)
+{
+  std::unordered_map<ymuint, SatLiteral>::iterator p = mUndetLitMap.find(f1->id());
+  if ( p != mUndetLitMap.end() ) {
+    return p->second;
+  }
+
+  ASSERT_COND( f1->tpg_onode()->ffr_root() == mRoot );
+
+  NodeValList ffr_cond;
+  mStructSat.add_ffr_condition(mRoot, f1, ffr_cond);
+  vector<SatLiteral> cond_lits;
+  mStructSat.conv_to_assumption(ffr_cond, cond_lits);
+
+  // ulit -> (~ffr_cond | mNoPropLit)
+  SatLiteral ulit(mStructSat.solver().new_var());
+  vector<SatLiteral> tmp_lits;
+  tmp_lits.reserve(cond_lits.size() + 2);
+  tmp_lits.push_back(~ulit);
+  tmp_lits.push_back(mNoPropLit);
+  for (ymuint i = 0; i < cond_lits.size(); ++ i) {
+    tmp_lits.push_back(~cond_lits[i]);
+  }
+  mStructSat.solver().add_clause(tmp_lits);
+
+  mUndetLitMap.insert(make_pair(f1->id(), ulit));
+  return ulit;
+}
+
+// @brief node の故障差が外部出力まで伝搬する条件を表すリテラルを返す．
+// @param[in] node 対象のノード
+SatLiteral
+DomSolver::detect_lit(const TpgNode* node)
+{
+  std::unordered_map<ymuint, SatLiteral>::iterator p = mDetLitMap.find(node->id());
+  if ( p != mDetLitMap.end() ) {
+    return p->second;
+  }
+
+  SatVarId cvar = mStructSat.solver().new_var();
+  mStructSat.add_focone(node, cvar);
+  SatLiteral dlit(cvar);
+
+  mDetLitMap.insert(make_pair(node->id(), dlit));
+  return dlit;
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,112 @@
+#ifndef DOMSOLVER_H
+#define DOMSOLVER_H
+
+/// @file DomSolver.h
+/// @brief DomSolver のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "StructSat.h"
+#include "ym/SatBool3.h"
+#include <unordered_map>
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class DomSolver DomSolver.h "DomSolver.h"
+/// @brief 1つの FFR 内の故障を対象に支配関係を調べるクラス
+///
+/// 一つの SAT ソルバを使いまわし，各故障の検出しない条件と
+/// 検出する条件を制御用の変数の仮定で切り替える．
+/// 学習節はそれ以降の問題でもそのまま用いられる．
+//////////////////////////////////////////////////////////////////////
+class DomSolver
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] max_id ノード番号の最大値 + 1
+  /// @param[in] root 対象の FFR の根のノード
+  DomSolver(ymuint max_id,
+	    const TpgNode* root);
+
+  /// @brief デストラクタ
+  ~DomSolver();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 故障を検出しない割当が存在するか調べる．
+  /// @param[in] f1 対象の故障(FFR 内の故障)
+  /// @param[in] assign_list 割当リスト
+  ///
+  /// assign_list のもとで f1 を検出しない割当があれば kB3True を返す．
+  SatBool3
+  check_undetect(const TpgFault* f1,
+		 const NodeValList& assign_list);
+
+  /// @brief 故障の支配関係を調べる．
+  /// @param[in] f2 支配故障の候補
+  /// @param[in] f1 被支配故障の候補(FFR 内の故障)
+  /// @retval true f2 が f1 を支配している．
+  /// @retval false f2 が f1 を支配していない．
+  ///
+  /// f2 を検出して f1 を検出しない割当が存在しない時に支配していると判定する．
+  bool
+  check_dominance(const TpgFault* f2,
+		  const TpgFault* f1);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief f1 を検出しない条件を表すリテラルを返す．
+  /// @param[in] f1 対象の故障(FFR 内の故障)
+  ///
+  /// 初めて呼ばれた時に節を追加する．
+  SatLiteral
+  undetect_lit(const TpgFault* f1);
+
+  /// @brief node の故障差が外部出力まで伝搬する条件を表すリテラルを返す．
+  /// @param[in] node 対象のノード
+  ///
+  /// 初めて呼ばれた時に fault cone を追加する．
+  SatLiteral
+  detect_lit(const TpgNode* node);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // SAT ソルバ
+  StructSat mStructSat;
+
+  // 対象の FFR の根のノード
+  const TpgNode* mRoot;
+
+  // mRoot の故障差が外部出力に伝搬しないことを表すリテラル
+  SatLiteral mNoPropLit;
+
+  // 故障番号をキーにして undetect_lit() のリテラルを入れるハッシュ表
+  std::unordered_map<ymuint, SatLiteral> mUndetLitMap;
+
+  // ノード番号をキーにして detect_lit() のリテラルを入れるハッシュ表
+  std::unordered_map<ymuint, SatLiteral> mDetLitMap;
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // DOMSOLVER_H
@@ -20,6 +20,7 @@
 #include "StructSat.h"
 #include "FoCone.h"
 #include "ModelValMap.h"
+#include "Extractor.h"
 
 #include "BackTracer.h"
 
@@ -53,15 +54,18 @@ mark_tfo(const TpgNode* node,
   }
 }
 
+// 印をつけたノードの番号は mark_list に入れる．
 void
 mark_tfi(const TpgNode* node,
-	 HashSet<ymuint>& tfi_mark,
+	 vector<bool>& tfi_mark,
+	 vector<ymuint>& mark_list,
 	 vector<ymuint>& input_list)
 {
-  if ( tfi_mark.check(node->id()) ) {
+  if ( tfi_mark[node->id()] ) {
     return;
   }
-  tfi_mark.add(node->id());
+  tfi_mark[node->id()] = true;
+  mark_list.push_back(node->id());
 
   if ( node->is_input() ) {
     input_list.push_back(node->input_id());
@@ -70,7 +74,104 @@ mark_tfi(const TpgNode* node,
     ymuint ni = node->fanin_num();
     for (ymuint i = 0; i < ni; ++ i) {
       const TpgNode* inode = node->fanin(i);
-      mark_tfi(inode, tfi_mark, input_list);
+      mark_tfi(inode, tfi_mark, mark_list, input_list);
+    }
+  }
+}
+
+// mark_tfi() でつけた印を消す．
+void
+clear_mark(vector<bool>& tfi_mark,
+	   vector<ymuint>& mark_list)
+{
+  for (ymuint i = 0; i < mark_list.size(); ++ i) {
+    tfi_mark[mark_list[i]] = false;
+  }
+  mark_list.clear();
+}
+
+// 3値でゲートの出力値を計算する．
+Val3
+eval3(const TpgNode* node,
+      const vector<Val3>& val_array)
+{
+  if ( !node->is_logic() ) {
+    if ( node->is_output() && node->fanin_num() == 1 ) {
+      // 出力ノードはファンインの値をそのまま伝える．
+      return val_array[node->fanin(0)->id()];
+    }
+    return kValX;
+  }
+
+  ymuint ni = node->fanin_num();
+  Val3 cval = node->cval();
+  if ( cval != kValX ) {
+    // AND/NAND/OR/NOR
+    Val3 nval = node->nval();
+    bool all_nval = true;
+    for (ymuint i = 0; i < ni; ++ i) {
+      Val3 ival = val_array[node->fanin(i)->id()];
+      if ( ival == cval ) {
+	return node->coval();
+      }
+      if ( ival != nval ) {
+	all_nval = false;
+      }
+    }
+    return all_nval ? node->noval() : kValX;
+  }
+
+  // BUFF/NOT/XOR/XNOR
+  Val3 val = kVal0;
+  for (ymuint i = 0; i < ni; ++ i) {
+    val = val ^ val_array[node->fanin(i)->id()];
+  }
+  switch ( node->gate_type() ) {
+  case kGateBUFF:
+  case kGateXOR:
+    return val;
+
+  case kGateNOT:
+  case kGateXNOR:
+    return ~val;
+
+  default:
+    break;
+  }
+  return kValX;
+}
+
+// assign_list の値から前向きの3値含意を行う．
+// 値の決まったノードは val_array に値が書き込まれ，node_list に追加される．
+void
+imply3(const NodeValList& assign_list,
+       vector<Val3>& val_array,
+       vector<const TpgNode*>& node_list)
+{
+  ymuint start = node_list.size();
+  ymuint n = assign_list.size();
+  for (ymuint i = 0; i < n; ++ i) {
+    NodeVal nv = assign_list[i];
+    const TpgNode* node = nv.node();
+    if ( val_array[node->id()] == kValX ) {
+      val_array[node->id()] = nv.val() ? kVal1 : kVal0;
+      node_list.push_back(node);
+    }
+  }
+
+  for (ymuint rpos = start; rpos < node_list.size(); ++ rpos) {
+    const TpgNode* node = node_list[rpos];
+    ymuint nfo = node->fanout_num();
+    for (ymuint i = 0; i < nfo; ++ i) {
+      const TpgNode* onode = node->fanout(i);
+      if ( val_array[onode->id()] != kValX ) {
+	continue;
+      }
+      Val3 oval = eval3(onode, val_array);
+      if ( oval != kValX ) {
+	val_array[onode->id()] = oval;
+	node_list.push_back(onode);
+      }
     }
   }
 }
@@ -124,11 +225,17 @@ FaultAnalyzer::init(const TpgNetwork& network,
   mMaxNodeId = network.node_num();
   mMaxFaultId = network.max_fault_id();
 
-  mInputListArray.clear();
-  mInputListArray.resize(mMaxNodeId);
+  mInputSupport.init(network.input_num2());
+
+  mSupportIdArray.clear();
+  mSupportIdArray.resize(mMaxFaultId, 0);
 
-  mInputList2Array.clear();
-  mInputList2Array.resize(mMaxNodeId);
+  mSupport2IdArray.clear();
+  mSupport2IdArray.resize(mMaxFaultId, 0);
+
+  vector<bool> tfi_mark(mMaxNodeId, false);
+  vector<ymuint> mark_list;
+  vector<ymuint> input_list;
 
   mFaultInfoArray.clear();
   mFaultInfoArray.resize(mMaxFaultId);
@@ -141,6 +248,8 @@ FaultAnalyzer::init(const TpgNetwork& network,
   ymuint f_abt = 0;
 
   vector<bool> det_flag(mMaxFaultId, false);
+  vector<const TpgFault*> fault_list;
+  vector<SatBool3> stat_list;
   for (ymuint i = 0; i < nn; ++ i) {
     if ( verbose() > 1 ) {
       cout << "\r" << setw(6) << i << " / " << setw(6) << nn;
@@ -148,34 +257,44 @@ FaultAnalyzer::init(const TpgNetwork& network,
     }
 
     const TpgNode* node = network.active_node(i);
-    if ( node->ffr_root() == node ) {
+    if ( node->ffr_root() != node ) {
+      // 故障は FFR の根でまとめて解析する．
+      continue;
+    }
+
+    // 故障箇所の TFO に印をつける．
+    HashSet<ymuint> tfo_mark;
+    ymuint support_id;
+    ymuint support2_id;
+    {
       // 故障箇所の TFI of TFI を node_set に記録する．
       vector<const TpgNode*> tfo_list;
-      HashSet<ymuint> tfo_mark;
       mark_tfo(node, tfo_mark, tfo_list);
 
-      // tfo_list の TFI に含まれる外部入力を mInputListArray に入れる．
-      vector<ymuint>& input_list = mInputListArray[node->id()];
-      HashSet<ymuint> tfi_mark;
+      // tfo_list の TFI に含まれる外部入力の集合を登録する．
+      input_list.clear();
       for (ymuint i = 0; i < tfo_list.size(); ++ i) {
 	const TpgNode* node = tfo_list[i];
-	mark_tfi(node, tfi_mark, input_list);
+	mark_tfi(node, tfi_mark, mark_list, input_list);
       }
-      // ソートしておく．
-      sort(input_list.begin(), input_list.end());
-
-      // 故障箇所の TFI に含まれる入力番号を mInputList2Array に入れる．
-      HashSet<ymuint> tfi_mark2;
-      vector<ymuint>& input_list2 = mInputList2Array[node->id()];
-      mark_tfi(node, tfi_mark2, input_list2);
-      // ソートしておく．
-      sort(input_list2.begin(), input_list2.end());
+      clear_mark(tfi_mark, mark_list);
+      support_id = mInputSupport.reg_set(input_list);
+
+      // 故障箇所の TFI に含まれる外部入力の集合を登録する．
+      input_list.clear();
+      mark_tfi(node, tfi_mark, mark_list, input_list);
+      clear_mark(tfi_mark, mark_list);
+      support2_id = mInputSupport.reg_set(input_list);
     }
 
-    ymuint nf = node->fault_num();
+    analyze_ffr(node, tfo_mark, tvmgr, fault_list, stat_list);
+
+    ymuint nf = fault_list.size();
     for (ymuint j = 0; j < nf; ++ j) {
-      const TpgFault* fault = node->fault(j);
-      SatBool3 stat = analyze_fault(fault, tvmgr);
+      const TpgFault* fault = fault_list[j];
+      SatBool3 stat = stat_list[j];
+      mSupportIdArray[fault->id()] = support_id;
+      mSupport2IdArray[fault->id()] = support2_id;
       ++ f_all;
       switch ( stat ) {
       case kB3True:
@@ -265,41 +384,98 @@ FaultAnalyzer::init(const TpgNetwork& network,
   }
 }
 
-// @brief 故障の解析を行う．
-// @param[in] fault 故障
+// @brief FFR 内の故障の解析を行う．
+// @param[in] root FFR の根のノード
+// @param[in] tfo_mark root の TFO の印
 // @param[in] tvmgr テストベクタのマネージャ
-SatBool3
-FaultAnalyzer::analyze_fault(const TpgFault* fault,
-			     TvMgr& tvmgr)
+// @param[out] fault_list 解析した故障のリスト
+// @param[out] stat_list fault_list の各故障の結果のリスト
+//
+// SAT ソルバは root の出力に故障差を挿入した1つのインスタンスを共有し，
+// 個々の故障は FFR 内の伝搬条件を仮定として与えることで活性化する．
+void
+FaultAnalyzer::analyze_ffr(const TpgNode* root,
+			   const HashSet<ymuint>& tfo_mark,
+			   TvMgr& tvmgr,
+			   vector<const TpgFault*>& fault_list,
+			   vector<SatBool3>& stat_list)
 {
-  ymuint f_id = fault->id();
-  FaultInfo& fi = mFaultInfoArray[f_id];
+  fault_list.clear();
+  root->get_ffr_faults(fault_list);
 
-  fi.mFault = fault;
+  ymuint nf = fault_list.size();
+  stat_list.clear();
+  stat_list.resize(nf, kB3X);
+  if ( nf == 0 ) {
+    return;
+  }
 
   StructSat struct_sat(mMaxNodeId);
-  const FoCone* focone = struct_sat.add_focone(fault, kVal1);
+  const FoCone* focone = struct_sat.add_focone(root, kVal1);
+
+  // root から外部出力までの必須割当
+  // root の dominator の side input は非制御値でなければならない．
+  NodeValList dom_list;
+  {
+    for (const TpgNode* dom = root->imm_dom(); dom != nullptr; dom = dom->imm_dom()) {
+      if ( !dom->is_logic() ) {
+	continue;
+      }
+      Val3 nval = dom->nval();
+      if ( nval == kValX ) {
+	continue;
+      }
+      ymuint ni = dom->fanin_num();
+      for (ymuint i = 0; i < ni; ++ i) {
+	const TpgNode* inode = dom->fanin(i);
+	if ( !tfo_mark.check(inode->id()) ) {
+	  dom_list.add(inode, nval == kVal1);
+	}
+      }
+    }
+    dom_list.sort();
+  }
+
+  BackTracer backtracer(mMaxNodeId);
+  vector<Val3> val_array(mMaxNodeId, kValX);
+  vector<const TpgNode*> val_node_list;
+  for (ymuint i = 0; i < nf; ++ i) {
+    const TpgFault* fault = fault_list[i];
+    ymuint f_id = fault->id();
+    FaultInfo& fi = mFaultInfoArray[f_id];
+
+    fi.mFault = fault;
+
+    // FFR 内の故障活性化&伝搬条件
+    NodeValList ffr_cond;
+    struct_sat.add_ffr_condition(root, fault, ffr_cond);
+    ffr_cond.sort();
+
+    vector<SatBool3> sat_model;
+    SatBool3 sat_stat = struct_sat.check_sat(ffr_cond, sat_model);
+    stat_list[i] = sat_stat;
+    if ( sat_stat != kB3True ) {
+      continue;
+    }
+
+    ModelValMap val_map(focone->gvar_map(), focone->fvar_map(), sat_model);
 
-  vector<SatBool3> sat_model;
-  SatBool3 sat_stat = struct_sat.check_sat(sat_model);
-  if ( sat_stat == kB3True ) {
     // 割当結果から十分割当を求める．
     NodeValList& suf_list = fi.mSufficientAssignment;
-    focone->get_suf_list(sat_model, fault, suf_list);
-    NodeValList& pi_suf_list = fi.mPiSufficientAssignment;
     {
-      ModelValMap val_map(focone->gvar_map(), focone->fvar_map(), sat_model);
-
-      BackTracer backtracer(mMaxNodeId);
-      backtracer(fault->tpg_onode(), focone->output_list(), val_map, pi_suf_list);
-      pi_suf_list.sort();
+      Extractor extractor(val_map);
+      extractor(root, suf_list);
+      suf_list.merge(ffr_cond);
     }
+    NodeValList& pi_suf_list = fi.mPiSufficientAssignment;
+    backtracer(root, focone->output_list(), val_map, pi_suf_list);
+    pi_suf_list.sort();
 
     // テストベクタを作る．
     TestVector* tv = tvmgr.new_vector();
     ymuint npi = pi_suf_list.size();
-    for (ymuint i = 0; i < npi; ++ i) {
-      NodeVal nv = pi_suf_list[i];
+    for (ymuint j = 0; j < npi; ++ j) {
+      NodeVal nv = pi_suf_list[j];
       const TpgNode* node = nv.node();
       ASSERT_COND ( node->is_input() );
       ymuint id = node->input_id();
@@ -316,28 +492,44 @@ FaultAnalyzer::analyze_fault(const TpgFault* fault,
     fi.mTestVector = tv;
 
     // 必要割当を求める．
+    // FFR 内の条件と dominator の side input の条件は構造的に必須なので
+    // それらから3値の含意で値の決まるものも含めて SAT を使わずに判定する．
+    NodeValList known_list = ffr_cond;
+    known_list.merge(dom_list);
+    imply3(known_list, val_array, val_node_list);
+
     NodeValList& ma_list = fi.mMandatoryAssignment;
     ymuint n = suf_list.size();
-    for (ymuint i = 0; i < n; ++ i) {
-      NodeVal nv = suf_list[i];
-
-      NodeValList list1;
+    for (ymuint j = 0; j < n; ++ j) {
+      NodeVal nv = suf_list[j];
       const TpgNode* node = nv.node();
       bool val = nv.val();
+      Val3 ival = val_array[node->id()];
+      if ( ival != kValX ) {
+	if ( ival == (val ? kVal1 : kVal0) ) {
+	  ma_list.add(node, val);
+	}
+	continue;
+      }
+
+      NodeValList list1;
       list1.add(node, !val);
-      if ( struct_sat.check_sat(list1) == kB3False ) {
+      if ( struct_sat.check_sat(ffr_cond, list1) == kB3False ) {
 	// node の値を反転したら検出できなかった．
 	// -> この割当は必須割当
 	ma_list.add(node, val);
       }
     }
 
+    for (ymuint j = 0; j < val_node_list.size(); ++ j) {
+      val_array[val_node_list[j]->id()] = kValX;
+    }
+    val_node_list.clear();
+
     if ( suf_list.size() == ma_list.size() ) {
       fi.mSingleCube = true;
     }
   }
-
-  return sat_stat;
 }
 
 // @brief 故障の情報をクリアする．
@@ -397,28 +589,28 @@ FaultAnalyzer::fault_info(ymuint fid) const
   return mFaultInfoArray[fid];
 }
 
-// @brief 故障のTFOのTFIに含まれる入力番号のリスト返す．
-// @param[in] fid 故障番号
-const vector<ymuint>&
-FaultAnalyzer::input_list(ymuint fid) const
+// @brief 2つの故障のTFOのTFIが共通の入力を含む時 true を返す．
+// @param[in] f1_id, f2_id 対象の故障番号
+bool
+FaultAnalyzer::check_input_intersect(ymuint f1_id,
+				     ymuint f2_id) const
 {
-  ASSERT_COND( fid < mMaxFaultId );
-  const TpgFault* fault = mFaultInfoArray[fid].fault();
-  const TpgNode* node = fault->tpg_onode();
-  const TpgNode* ffr_root = node->ffr_root();
-  return mInputListArray[ffr_root->id()];
+  ASSERT_COND( f1_id < mMaxFaultId );
+  ASSERT_COND( f2_id < mMaxFaultId );
+  return mInputSupport.check_intersect(mSupportIdArray[f1_id],
+				       mSupportIdArray[f2_id]);
 }
 
-// @brief 故障のTFIに含まれる入力番号のリスト返す．
-// @param[in] fid 故障番号
-const vector<ymuint>&
-FaultAnalyzer::input_list2(ymuint fid) const
+// @brief 2つの故障のTFIが共通の入力を含む時 true を返す．
+// @param[in] f1_id, f2_id 対象の故障番号
+bool
+FaultAnalyzer::check_input2_intersect(ymuint f1_id,
+				      ymuint f2_id) const
 {
-  ASSERT_COND( fid < mMaxFaultId );
-  const TpgFault* fault = mFaultInfoArray[fid].fault();
-  const TpgNode* node = fault->tpg_onode();
-  const TpgNode* ffr_root = node->ffr_root();
-  return mInputList2Array[ffr_root->id()];
+  ASSERT_COND( f1_id < mMaxFaultId );
+  ASSERT_COND( f2_id < mMaxFaultId );
+  return mInputSupport.check_intersect(mSupport2IdArray[f1_id],
+				       mSupport2IdArray[f2_id]);
 }
 
 // @brief 等価故障を記録する．
@@ -12,9 +12,11 @@
 #include "satpg.h"
 #include "NodeValList.h"
 #include "FaultInfo.h"
+#include "InputSupport.h"
 #include "ym/RandGen.h"
 #include "ym/SatBool3.h"
 #include "ym/StopWatch.h"
+#include "ym/HashSet.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -91,15 +93,19 @@ public:
   clear_fault_info(ymuint fid,
 		   TvMgr& tv_mgr);
 
-  /// @brief 故障のTFOのTFIに含まれる入力番号のリスト返す．
-  /// @param[in] fid 故障番号
-  const vector<ymuint>&
-  input_list(ymuint fid) const;
+  /// @brief 2つの故障のTFOのTFIが共通の入力を含む時 true を返す．
+  /// @param[in] f1_id, f2_id 対象の故障番号
+  ///
+  /// false の場合2つの故障は構造的に独立である．
+  bool
+  check_input_intersect(ymuint f1_id,
+			ymuint f2_id) const;
 
-  /// @brief 故障のTFIに含まれる入力番号のリスト返す．
-  /// @param[in] fid 故障番号
-  const vector<ymuint>&
-  input_list2(ymuint fid) const;
+  /// @brief 2つの故障のTFIが共通の入力を含む時 true を返す．
+  /// @param[in] f1_id, f2_id 対象の故障番号
+  bool
+  check_input2_intersect(ymuint f1_id,
+			 ymuint f2_id) const;
 
   /// @brief 等価故障を記録する．
   void
@@ -156,12 +162,18 @@ private:
   // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
-  /// @brief 故障の解析を行う．
-  /// @param[in] fault 故障
+  /// @brief FFR 内の故障の解析を行う．
+  /// @param[in] root FFR の根のノード
+  /// @param[in] tfo_mark root の TFO の印
   /// @param[in] tvmgr テストベクタのマネージャ
-  SatBool3
-  analyze_fault(const TpgFault* fault,
-		TvMgr& tvmgr);
+  /// @param[out] fault_list 解析した故障のリスト
+  /// @param[out] stat_list fault_list の各故障の結果のリスト
+  void
+  analyze_ffr(const TpgNode* root,
+	      const HashSet<ymuint>& tfo_mark,
+	      TvMgr& tvmgr,
+	      vector<const TpgFault*>& fault_list,
+	      vector<SatBool3>& stat_list);
 
 
 private:
@@ -184,11 +196,15 @@ private:
   // 故障番号リスト
   vector<ymuint> mOrigFidList;
 
-  // ノードごとに関係する入力の番号のリストを収める配列
-  vector<vector<ymuint> > mInputListArray;
+  // 関係する入力の集合を収める表
+  // FFR の根ごとに TFO の TFI と TFI に含まれる入力の集合を登録する．
+  InputSupport mInputSupport;
+
+  // 故障番号をキーにして TFO の TFI に含まれる入力の集合番号を収める配列
+  vector<ymuint> mSupportIdArray;
 
-  // ノードごとに関係する入力の番号のリストを収める配列
-  vector<vector<ymuint> > mInputList2Array;
+  // 故障番号をキーにして TFI に含まれる入力の集合番号を収める配列
+  vector<ymuint> mSupport2IdArray;
 
   // 故障ごとの情報を収める配列
   vector<FaultInfo> mFaultInfoArray;
@@ -8,17 +8,34 @@
 
 
 #include "FgMgrBase.h"
+#include "GroupSolver.h"
 
 #include "StructSat.h"
 #include "FoCone.h"
 
 #include "TpgFault.h"
 
+#include <thread>
+#include <algorithm>
+
 
 BEGIN_NAMESPACE_YM_SATPG
 
 bool verify_add_fault = false;
 
+BEGIN_NONAMESPACE
+
+// 同時に保持するグループソルバの最大数
+const ymuint kMaxSolverNum = 128;
+
+// グループソルバを作り直すまでに許す取り消しの回数
+const ymuint kMaxRetractNum = 64;
+
+// find_group2 で並列に調べる最小のグループ数
+const ymuint kMinParallelGroupNum = 16;
+
+END_NONAMESPACE
+
 //////////////////////////////////////////////////////////////////////
 // クラス FgMgr
 //////////////////////////////////////////////////////////////////////
@@ -55,7 +72,9 @@ FgMgr::print_group_list(ostream& s,
 FgMgrBase::FgMgrBase(ymuint max_node_id,
 		     const FaultAnalyzer& analyzer) :
   mMaxNodeId(max_node_id),
-  mAnalyzer(analyzer)
+  mAnalyzer(analyzer),
+  mThreadNum(1),
+  mSolverStamp(0)
 {
   clear_count();
 }
@@ -76,6 +95,20 @@ FgMgrBase::clear()
   mGroupList.clear();
 }
 
+// @brief find_group2 で用いるスレッド数を設定する．
+// @param[in] num スレッド数 (0 の場合はハードウェアの並列度)
+void
+FgMgrBase::set_thread_num(ymuint num)
+{
+  if ( num == 0 ) {
+    num = std::thread::hardware_concurrency();
+    if ( num == 0 ) {
+      num = 1;
+    }
+  }
+  mThreadNum = num;
+}
+
 // @brief 現在のグループ数を返す．
 ymuint
 FgMgrBase::group_num() const
@@ -310,6 +343,8 @@ FgMgrBase::find_group(ymuint fid0,
 // @return 見つかったグループ番号を返す．
 //
 // 見つからない場合は group_num() を返す．
+// スレッド数が 2 以上の時は複数のグループを並列に調べるが，
+// その場合も group_list の順で最初に両立したグループが選ばれる．
 ymuint
 FgMgrBase::find_group2(ymuint fid0,
 		       const vector<ymuint>& group_list,
@@ -318,171 +353,353 @@ FgMgrBase::find_group2(ymuint fid0,
   StopWatch local_timer;
   local_timer.start();
 
-  StructSat struct_sat0(max_node_id());
+  ymuint ng = group_list.size();
+  vector<Probe> probe_list(ng);
+  ymuint ans_pos = ng;
+
+  ymuint nt = mThreadNum;
+  if ( nt > ng ) {
+    nt = ng;
+  }
+  if ( nt > 1 && ng >= kMinParallelGroupNum ) {
+    mNextPos = 0;
+    mWinPos = ng;
+
+    vector<std::thread> thread_list;
+    thread_list.reserve(nt);
+    for (ymuint i = 0; i < nt; ++ i) {
+      thread_list.push_back(std::thread(&FgMgrBase::probe_worker, this,
+					fid0, std::cref(group_list), fast,
+					std::ref(probe_list)));
+    }
+    for (ymuint i = 0; i < nt; ++ i) {
+      thread_list[i].join();
+    }
+    ans_pos = mWinPos;
+
+    // ans_pos より後ろで正式に調べたグループのソルバは
+    // 逐次的に調べた場合には使われない履歴を持つので捨てる．
+    for (ymuint i = ans_pos + 1; i < ng; ++ i) {
+      if ( probe_list[i].mChecked ) {
+	_fault_group(group_list[i])->clear_solver();
+      }
+    }
+  }
+  else {
+    StructSat struct_sat0(max_node_id());
+    make_probe_cnf(fid0, struct_sat0);
+    for (ymuint i = 0; i < ng; ++ i) {
+      Probe& probe = probe_list[i];
+      probe_group(fid0, group_list[i], struct_sat0, fast, probe);
+      if ( probe.mStatus != kProbeFail ) {
+	ans_pos = i;
+	break;
+      }
+    }
+  }
 
+  // 衝突キャッシュと統計データは逐次的に調べた場合と同じものだけを反映させる．
+  // ans_pos より後ろの結果は並列版で先回りして調べたものなので捨てる．
+  ymuint end = (ans_pos < ng) ? ans_pos + 1 : ng;
+  for (ymuint i = 0; i < end; ++ i) {
+    const Probe& probe = probe_list[i];
+    if ( probe.mConflict ) {
+      add_conflict_cache(group_list[i], fid0);
+    }
+    if ( !probe.mChecked ) {
+      continue;
+    }
+    ++ mCheckCount;
+    mFsum += probe.mFnum;
+    if ( mFmax < probe.mFnum ) {
+      mFmax = probe.mFnum;
+    }
+    ++ mMnum;
+
+    FaultGroup* fg = _fault_group(group_list[i]);
+    fg->set_solver_stamp(mSolverStamp);
+    ++ mSolverStamp;
+  }
+
+  ymuint ans_gid = group_num();
+  if ( ans_pos < ng ) {
+    ans_gid = group_list[ans_pos];
+    commit_probe(fid0, ans_gid, probe_list[ans_pos]);
+  }
+
+  trim_solvers();
+
+  local_timer.stop();
+  mCheckTime += local_timer.time();
+
+  return ans_gid;
+}
+
+// @brief find_group2 の簡易検査用の CNF を作る．
+// @param[in] fid0 対象の故障番号
+// @param[in] struct_sat0 CNF を追加するソルバ
+// @return fid0 の fault cone を返す．
+//
+// fid0 が single cube の場合は nullptr を返す．
+const FoCone*
+FgMgrBase::make_probe_cnf(ymuint fid0,
+			  StructSat& struct_sat0)
+{
   const FaultInfo& fi0 = _fault_info(fid0);
 
   // fi0 の必要割当を追加
-  const NodeValList ma_list0 = fi0.mandatory_assignment();
-  struct_sat0.add_assignments(ma_list0);
+  struct_sat0.add_assignments(fi0.mandatory_assignment());
 
   const FoCone* focone0 = nullptr;
   if ( !fi0.single_cube() ) {
     // f0 を検出する CNF を生成
-    const TpgFault* f0 = fi0.fault();
-    focone0 = struct_sat0.add_focone(f0, kVal1);
+    focone0 = struct_sat0.add_focone(fi0.fault(), kVal1);
   }
+  return focone0;
+}
 
-  ymuint ans_gid = group_num();
-  for (ymuint i = 0; i < group_list.size(); ++ i) {
-    ymuint gid = group_list[i];
+// @brief 1つのグループに故障を追加できるか調べる．
+// @param[in] fid0 対象の故障番号
+// @param[in] gid グループ番号
+// @param[in] struct_sat0 make_probe_cnf() で作ったソルバ
+// @param[in] fast 高速ヒューリスティック
+// @param[out] probe 結果を格納する構造体
+//
+// gid 以外のグループには触らないので，異なるグループなら
+// 複数のスレッドから同時に呼んでもよい．
+// 衝突キャッシュへの登録は probe.mConflict に記録するだけで，
+// 実際の登録は find_group2() が行う．
+// 両立した場合は fid0 をグループのソルバに保留したままにする．
+void
+FgMgrBase::probe_group(ymuint fid0,
+		       ymuint gid,
+		       StructSat& struct_sat0,
+		       bool fast,
+		       Probe& probe)
+{
+  if ( check_conflict_cache(gid, fid0) ) {
+    return;
+  }
 
-    if ( check_conflict_cache(gid, fid0) ) {
-      continue;
-    }
+  const FaultInfo& fi0 = _fault_info(fid0);
+  const NodeValList& ma_list0 = fi0.mandatory_assignment();
+  FaultGroup* fg = _fault_group(gid);
 
-    { // グループの十分割当が成り立っていたら両立している．
-      const NodeValList& suf_list1 = sufficient_assignment(gid);
-      vector<SatBool3> sat_model;
-      if ( struct_sat0.check_sat(suf_list1, sat_model) == kB3True ) {
-	FaultGroup* fg = _fault_group(gid);
-	if ( fi0.single_cube() ) {
-	  fg->add_fault(fid0, ma_list0, ma_list0);
-	}
-	else {
-	  NodeValList suf_list;
-	  focone0->get_suf_list(sat_model, _fault(fid0), suf_list);
-	  fg->add_fault(fid0, suf_list, ma_list0);
-	}
-	if ( verify_add_fault) {
-	  StructSat struct_sat(max_node_id());
-	  // mSufList 単独で充足可能か調べておく．
-	  if ( struct_sat.check_sat(fg->sufficient_assignment()) != kB3True ) {
-	    cout << "Error in FaultGroup::add_fault(2)" << endl
-		 << "  mSufList inconsistent" << endl;
-	  }
-	  if ( !check_sufficient_assignment(gid) ) {
-	    cout << "Error in sufficient_assignment at add_fault(2)" << endl;
-	  }
-	}
-	ans_gid = gid;
-	break;
-      }
-    }
-    if ( fast ) {
-      continue;
+  // 必要割当同士が矛盾していたら SAT を使うまでもなく衝突している．
+  if ( check_conflict(ma_list0, fg->mandatory_assignment()) ) {
+    probe.mConflict = true;
+    return;
+  }
+
+  // fid0 の必要割当とグループの十分割当が矛盾していたら
+  // 十分割当のもとでの検査は成功しないので省略する．
+  if ( !check_conflict(ma_list0, fg->sufficient_assignment()) ) {
+    // グループの十分割当が成り立っていたら両立している．
+    if ( struct_sat0.check_sat(fg->sufficient_assignment()) == kB3True ) {
+      probe.mStatus = kProbeSuf;
+      return;
     }
+  }
+  if ( fast ) {
+    return;
+  }
 
-    { // グループの必要割当が成り立たなかったら衝突している．
-      const NodeValList& ma_list1 = mandatory_assignment(gid);
-      if ( struct_sat0.check_sat(ma_list1) == kB3False ) {
-	add_conflict_cache(gid, fid0);
-	continue;
-      }
+  { // グループの必要割当が成り立たなかったら衝突している．
+    if ( struct_sat0.check_sat(fg->mandatory_assignment()) == kB3False ) {
+      probe.mConflict = true;
+      return;
     }
+  }
 
-    ++ mCheckCount;
+  // 簡易検査ではわからなかったので正式に調べる．
+  // グループのソルバには既に故障の検出条件が入っているので
+  // fid0 の検出条件のみを試しに加える．
+  probe.mChecked = true;
+  GroupSolver* solver = _group_solver(fg);
 
-    // 簡易検査ではわからなかったので正式に調べる．
-    StructSat struct_sat(max_node_id());
+  ymuint fnum = fi0.single_cube() ? 0 : 1;
+  ymuint nf = fg->fault_num();
+  for (ymuint i = 0; i < nf; ++ i) {
+    ymuint fid1 = fg->fault_id(i);
+    if ( !_fault_info(fid1).single_cube() ) {
+      ++ fnum;
+    }
+  }
+  probe.mFnum = fnum;
 
-    // fid0 の必要割当を追加
-    struct_sat.add_assignments(ma_list0);
-    // グループの必要割当を追加
-    struct_sat.add_assignments(mandatory_assignment(gid));
+  // 結果の反映は commit_probe() で行う．
+  if ( solver->check_fault(fid0, probe.mModel) ) {
+    probe.mStatus = kProbeFull;
+  }
+  else {
+    probe.mConflict = true;
+    solver->retract_fault();
+  }
+}
 
-    ymuint fnum = 0;
+// @brief probe_group() の結果に従って故障をグループに追加する．
+// @param[in] fid0 対象の故障番号
+// @param[in] gid グループ番号
+// @param[in] probe probe_group() の結果
+void
+FgMgrBase::commit_probe(ymuint fid0,
+			ymuint gid,
+			const Probe& probe)
+{
+  FaultGroup* fg = _fault_group(gid);
+  const FaultInfo& fi0 = _fault_info(fid0);
 
-    const FoCone* focone0 = nullptr;
-    if ( !fi0.single_cube() ) {
-      // fid0 を検出する条件を追加
-      const TpgFault* f0 = fi0.fault();
-      focone0 = struct_sat.add_focone(f0, kVal1);
-      ++ fnum;
-    }
+  NodeValList suf_list0;
+  if ( probe.mStatus == kProbeFull ) {
+    ++ mFoundCount;
 
-    ymuint nf = fault_num(gid);
-    vector<const FoCone*> focone_array(nf);
+    // probe_group() で保留した fid0 をグループのソルバで確定させる．
+    GroupSolver* solver = fg->solver();
+    ASSERT_COND( solver != nullptr && solver->has_pending() );
+
+    const vector<SatBool3>& sat_model = probe.mModel;
+    ymuint nf = fg->fault_num();
     for (ymuint i = 0; i < nf; ++ i) {
-      ymuint fid1 = fault_id(gid, i);
-      const FaultInfo& fi1 = _fault_info(fid1);
-      if ( !fi1.single_cube() ) {
-	// fid1 の検出条件を生成
-	const TpgFault* f1 = fi1.fault();
-	focone_array[i] = struct_sat.add_focone(f1, kVal1);
-	++ fnum;
+      ymuint fid1 = fg->fault_id(i);
+      if ( !_fault_info(fid1).single_cube() ) {
+	NodeValList suf_list;
+	solver->get_suf_list(i, sat_model, suf_list);
+	fg->set_suf_list(i, suf_list);
       }
     }
+    solver->get_suf_list(nf, sat_model, suf_list0);
+    solver->commit_fault();
 
-    mFsum += fnum;
-    if ( mFmax < fnum ) {
-      mFmax = fnum;
+    fg->update();
+
+    if ( verify_add_fault ) {
+      StructSat struct_sat(max_node_id());
+      // mSufList 単独で充足可能か調べておく．
+      if ( struct_sat.check_sat(fg->sufficient_assignment()) != kB3True ) {
+	cout << "Error in FaultGroup::update()" << endl
+	     << "  mSufList inconsistent" << endl;
+      }
+      if ( !check_sufficient_assignment(gid) ) {
+	cout << "Error in sufficient_assignment at updatet()" << endl;
+      }
     }
-    ++ mMnum;
+  }
 
+  else if ( fi0.single_cube() ) {
+    suf_list0 = fi0.mandatory_assignment();
+  }
+  else {
+    StructSat struct_sat0(max_node_id());
+    const FoCone* focone0 = make_probe_cnf(fid0, struct_sat0);
     vector<SatBool3> sat_model;
-    if ( struct_sat.check_sat(sat_model) == kB3True ) {
-      ++ mFoundCount;
-
-      FaultGroup* fg = _fault_group(gid);
-
-      for (ymuint i = 0; i < nf; ++ i) {
-	ymuint fid1 = fg->fault_id(i);
-	const FaultInfo& fi1 = _fault_info(fid1);
-	if ( !fi1.single_cube() ) {
-	  NodeValList suf_list;
-	  focone_array[i]->get_suf_list(sat_model, fi1.fault(), suf_list);
-	  fg->set_suf_list(i, suf_list);
-	}
-      }
+    SatBool3 stat = struct_sat0.check_sat(fg->sufficient_assignment(), sat_model);
+    ASSERT_COND( stat == kB3True );
+    focone0->get_suf_list(sat_model, fi0.fault(), suf_list0);
+  }
 
-      fg->update();
+  fg->add_fault(fid0, suf_list0, fi0.mandatory_assignment());
 
-      if ( verify_add_fault ) {
-	StructSat struct_sat(max_node_id());
-	// mSufList 単独で充足可能か調べておく．
-	if ( struct_sat.check_sat(fg->sufficient_assignment()) != kB3True ) {
-	  cout << "Error in FaultGroup::update()" << endl
-	       << "  mSufList inconsistent" << endl;
-	}
-	if ( !check_sufficient_assignment(gid) ) {
-	  cout << "Error in sufficient_assignment at updatet()" << endl;
-	}
-      }
+  if ( verify_add_fault ) {
+    StructSat struct_sat(max_node_id());
+    // mSufList 単独で充足可能か調べておく．
+    if ( struct_sat.check_sat(fg->sufficient_assignment()) != kB3True ) {
+      cout << "Error in FaultGroup::add_fault(2)" << endl
+	   << "  mSufList inconsistent" << endl;
+    }
+    if ( !check_sufficient_assignment(gid) ) {
+      cout << "Error in sufficient_assignment at add_fault(2)" << endl;
+    }
+  }
+}
 
-      if ( fi0.single_cube() ) {
-	fg->add_fault(fid0, ma_list0, ma_list0);
-      }
-      else {
-	NodeValList suf_list;
-	focone0->get_suf_list(sat_model, _fault(fid0), suf_list);
-	fg->add_fault(fid0, suf_list, ma_list0);
-      }
-      ans_gid = gid;
-
-      if ( verify_add_fault ) {
-	StructSat struct_sat(max_node_id());
-	// mSufList 単独で充足可能か調べておく．
-	if ( struct_sat.check_sat(fg->sufficient_assignment()) != kB3True ) {
-	  cout << "Error in FaultGroup::update()" << endl
-	       << "  mSufList inconsistent" << endl;
-	}
-	if ( !check_sufficient_assignment(gid) ) {
-	  cout << "Error in sufficient_assignment at updatet()" << endl;
-	}
-      }
+// @brief find_group2 の並列版のワーカースレッドの本体
+// @param[in] fid0 対象の故障番号
+// @param[in] group_list 探索対象のグループ番号のリスト
+// @param[in] fast 高速ヒューリスティック
+// @param[out] probe_list 各グループの結果を格納するリスト
+//
+// group_list の先頭から順に取り出して調べる．
+// 両立するグループが見つかったらそれより後ろのグループは調べない．
+void
+FgMgrBase::probe_worker(ymuint fid0,
+			const vector<ymuint>& group_list,
+			bool fast,
+			vector<Probe>& probe_list)
+{
+  // 簡易検査用のソルバはスレッドごとに作る．
+  StructSat struct_sat0(max_node_id());
+  make_probe_cnf(fid0, struct_sat0);
 
+  for ( ; ; ) {
+    ymuint pos = mNextPos.fetch_add(1);
+    if ( pos >= mWinPos ) {
       break;
     }
-    else {
-      add_conflict_cache(gid, fid0);
+    Probe& probe = probe_list[pos];
+    probe_group(fid0, group_list[pos], struct_sat0, fast, probe);
+    if ( probe.mStatus != kProbeFail ) {
+      // mWinPos を pos まで下げる．
+      ymuint win_pos = mWinPos;
+      while ( pos < win_pos && !mWinPos.compare_exchange_weak(win_pos, pos) ) {
+	;
+      }
     }
   }
+}
 
-  local_timer.stop();
-  mCheckTime += local_timer.time();
+// @brief 故障グループのソルバを返す．
+// @param[in] fg 故障グループ
+//
+// ソルバがなければ作り，グループの故障との同期をとる．
+GroupSolver*
+FgMgrBase::_group_solver(FaultGroup* fg)
+{
+  GroupSolver* solver = fg->solver();
+  if ( solver != nullptr && solver->retract_num() > kMaxRetractNum ) {
+    // 無効化された fault cone が溜まりすぎたので作り直す．
+    fg->clear_solver();
+    solver = nullptr;
+  }
 
-  return ans_gid;
+  if ( solver == nullptr ) {
+    solver = new GroupSolver(max_node_id(), mAnalyzer);
+    fg->set_solver(solver);
+  }
+
+  // ソルバの故障リストはグループの故障リストの先頭部分になっている．
+  ymuint nf = fg->fault_num();
+  ASSERT_COND( solver->fault_num() <= nf );
+  for (ymuint i = solver->fault_num(); i < nf; ++ i) {
+    solver->add_fault(fg->fault_id(i));
+  }
+
+  return solver;
+}
+
+// @brief 保持しているグループソルバの数を制限する．
+//
+// kMaxSolverNum を超えた分だけ，最も長く使われていないものから捨てる．
+void
+FgMgrBase::trim_solvers()
+{
+  // (スタンプ, グループ番号) のリスト
+  vector<pair<ymuint, ymuint> > stamp_list;
+  for (ymuint i = 0; i < mGroupList.size(); ++ i) {
+    FaultGroup* fg = mGroupList[i];
+    if ( fg != nullptr && fg->solver() != nullptr ) {
+      stamp_list.push_back(make_pair(fg->solver_stamp(), i));
+    }
+  }
+  if ( stamp_list.size() <= kMaxSolverNum ) {
+    return;
+  }
+
+  // 古い方から n 個を先頭に集める．
+  ymuint n = stamp_list.size() - kMaxSolverNum;
+  nth_element(stamp_list.begin(), stamp_list.begin() + n, stamp_list.end());
+  for (ymuint i = 0; i < n; ++ i) {
+    mGroupList[stamp_list[i].second]->clear_solver();
+  }
 }
 
 // @brief 新しいグループを作る．
@@ -617,11 +834,14 @@ FgMgrBase::FaultGroup::FaultGroup(ymuint id) :
   mId(id)
 {
   mCplxNum = 0;
+  mSolver = nullptr;
+  mSolverStamp = 0;
 }
 
 // @brief デストラクタ
 FgMgrBase::FaultGroup::~FaultGroup()
 {
+  delete mSolver;
 }
 
 // @brief ID番号を返す．
@@ -690,6 +910,9 @@ FgMgrBase::FaultGroup::copy(const FaultGroup& dst)
   mSufList = dst.mSufList;
   mMaList = dst.mMaList;
 
+  // ソルバは必要になった時に作り直す．
+  clear_solver();
+
   mConflictCache.clear();
   for (HashSetIterator<ymuint> p = dst.mConflictCache.begin();
        p != dst.mConflictCache.end(); ++ p) {
@@ -743,6 +966,9 @@ FgMgrBase::FaultGroup::delete_faults(const vector<ymuint>& fid_list)
 
   mConflictCache.clear();
 
+  // 取り除いた故障の条件はソルバから消せないので作り直す．
+  clear_solver();
+
   update();
 }
 
@@ -769,6 +995,44 @@ FgMgrBase::FaultGroup::update()
   }
 }
 
+// @brief ソルバを返す．
+GroupSolver*
+FgMgrBase::FaultGroup::solver() const
+{
+  return mSolver;
+}
+
+// @brief ソルバを設定する．
+// @param[in] solver ソルバ
+void
+FgMgrBase::FaultGroup::set_solver(GroupSolver* solver)
+{
+  delete mSolver;
+  mSolver = solver;
+}
+
+// @brief ソルバを削除する．
+void
+FgMgrBase::FaultGroup::clear_solver()
+{
+  delete mSolver;
+  mSolver = nullptr;
+}
+
+// @brief ソルバを最後に使った時刻を返す．
+ymuint
+FgMgrBase::FaultGroup::solver_stamp() const
+{
+  return mSolverStamp;
+}
+
+// @brief ソルバを最後に使った時刻を設定する．
+void
+FgMgrBase::FaultGroup::set_solver_stamp(ymuint stamp)
+{
+  mSolverStamp = stamp;
+}
+
 
 //////////////////////////////////////////////////////////////////////
 // クラス FgMgrBase::FaultData
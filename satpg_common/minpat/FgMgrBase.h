@@ -15,10 +15,15 @@
 #include "FaultInfo.h"
 #include "ym/HashSet.h"
 #include "ym/USTime.h"
+#include <atomic>
 
 
 BEGIN_NAMESPACE_YM_SATPG
 
+class GroupSolver;
+class StructSat;
+class FoCone;
+
 //////////////////////////////////////////////////////////////////////
 /// @class FgMgrBase FgMgrBase.h "FgMgrBase.h"
 /// @brief fault group manager
@@ -54,6 +59,16 @@ public:
   void
   clear();
 
+  /// @brief find_group2 で用いるスレッド数を設定する．
+  /// @param[in] num スレッド数 (0 の場合はハードウェアの並列度)
+  ///
+  /// 2 以上の場合は1つの故障に対して複数のグループを並列に調べる．
+  /// 選ばれるグループは逐次的に調べた場合と同じになる．
+  /// fast でない場合の十分割当はグループのソルバの SAT の解から求めるので，
+  /// ソルバの作り直しの時期によっては異なる割当になることがある．
+  void
+  set_thread_num(ymuint num);
+
   /// @brief 現在のグループ数を返す．
   virtual
   ymuint
@@ -173,6 +188,13 @@ public:
   const NodeValList&
   mandatory_assignment(ymuint gid) const;
 
+  /// @brief [デバッグ用] グループのソルバを返す．
+  /// @param[in] gid グループ番号 ( 0 <= gid < group_num() )
+  ///
+  /// 作られていない場合には nullptr を返す．
+  const GroupSolver*
+  group_solver(ymuint gid) const;
+
   /// @brief 複数故障の検出検査回数
   ymuint
   mfault_num() const;
@@ -236,6 +258,17 @@ private:
   const FaultGroup*
   _fault_group(ymuint gid) const;
 
+  /// @brief 故障グループのソルバを返す．
+  /// @param[in] fg 故障グループ
+  ///
+  /// ソルバがなければ作り，グループの故障との同期をとる．
+  GroupSolver*
+  _group_solver(FaultGroup* fg);
+
+  /// @brief 保持しているグループソルバの数を制限する．
+  void
+  trim_solvers();
+
   /// @brief 衝突キャッシュに登録する
   void
   add_conflict_cache(ymuint gid,
@@ -333,6 +366,31 @@ private:
     void
     update();
 
+    /// @brief ソルバを返す．
+    ///
+    /// 作られていない場合には nullptr を返す．
+    GroupSolver*
+    solver() const;
+
+    /// @brief ソルバを設定する．
+    /// @param[in] solver ソルバ
+    ///
+    /// 以前のソルバは削除される．
+    void
+    set_solver(GroupSolver* solver);
+
+    /// @brief ソルバを削除する．
+    void
+    clear_solver();
+
+    /// @brief ソルバを最後に使った時刻を返す．
+    ymuint
+    solver_stamp() const;
+
+    /// @brief ソルバを最後に使った時刻を設定する．
+    void
+    set_solver_stamp(ymuint stamp);
+
 
   private:
     //////////////////////////////////////////////////////////////////////
@@ -385,6 +443,51 @@ private:
     // 衝突する故障の集合
     HashSet<ymuint> mConflictCache;
 
+    // 故障リストに対応するソルバ
+    GroupSolver* mSolver;
+
+    // mSolver を最後に使った時刻
+    ymuint mSolverStamp;
+
+  };
+
+  // find_group2 で1つのグループを調べた結果の種類
+  enum ProbeStatus {
+    // 両立しない(あるいは調べなかった)
+    kProbeFail,
+    // グループの十分割当のもとで両立した
+    kProbeSuf,
+    // グループのソルバで両立した
+    kProbeFull
+  };
+
+  // find_group2 で1つのグループを調べた結果を表す構造体
+  struct Probe
+  {
+    // コンストラクタ
+    Probe() :
+      mStatus(kProbeFail),
+      mChecked(false),
+      mFnum(0),
+      mConflict(false)
+    {
+    }
+
+    // 結果の種類
+    ProbeStatus mStatus;
+
+    // 正式な検査を行った時 true となるフラグ
+    bool mChecked;
+
+    // 正式な検査で考慮した故障数
+    ymuint mFnum;
+
+    // 衝突キャッシュに登録すべき時 true となるフラグ
+    bool mConflict;
+
+    // kProbeFull の時の SAT の解
+    vector<SatBool3> mModel;
+
   };
 
 
@@ -393,6 +496,52 @@ private:
   // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief find_group2 の簡易検査用の CNF を作る．
+  /// @param[in] fid0 対象の故障番号
+  /// @param[in] struct_sat0 CNF を追加するソルバ
+  /// @return fid0 の fault cone を返す．
+  const FoCone*
+  make_probe_cnf(ymuint fid0,
+		 StructSat& struct_sat0);
+
+  /// @brief 1つのグループに故障を追加できるか調べる．
+  /// @param[in] fid0 対象の故障番号
+  /// @param[in] gid グループ番号
+  /// @param[in] struct_sat0 make_probe_cnf() で作ったソルバ
+  /// @param[in] fast 高速ヒューリスティック
+  /// @param[out] probe 結果を格納する構造体
+  ///
+  /// グループの内容は変更しない．
+  /// kProbeFull の場合は fid0 をグループのソルバに保留したまま返す．
+  void
+  probe_group(ymuint fid0,
+	      ymuint gid,
+	      StructSat& struct_sat0,
+	      bool fast,
+	      Probe& probe);
+
+  /// @brief probe_group() の結果に従って故障をグループに追加する．
+  /// @param[in] fid0 対象の故障番号
+  /// @param[in] gid グループ番号
+  /// @param[in] probe probe_group() の結果
+  ///
+  /// kProbeFull の場合はグループのソルバに保留した故障を確定させる．
+  void
+  commit_probe(ymuint fid0,
+	       ymuint gid,
+	       const Probe& probe);
+
+  /// @brief find_group2 の並列版のワーカースレッドの本体
+  /// @param[in] fid0 対象の故障番号
+  /// @param[in] group_list 探索対象のグループ番号のリスト
+  /// @param[in] fast 高速ヒューリスティック
+  /// @param[out] probe_list 各グループの結果を格納するリスト
+  void
+  probe_worker(ymuint fid0,
+	       const vector<ymuint>& group_list,
+	       bool fast,
+	       vector<Probe>& probe_list);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -408,6 +557,18 @@ private:
   // 故障グループの配列
   vector<FaultGroup*> mGroupList;
 
+  // find_group2 で用いるスレッド数
+  ymuint mThreadNum;
+
+  // ソルバの使用時刻を表すカウンタ
+  ymuint mSolverStamp;
+
+  // 並列版の find_group2 で次に調べる位置
+  std::atomic<ymuint> mNextPos;
+
+  // 並列版の find_group2 で両立した最小の位置
+  std::atomic<ymuint> mWinPos;
+
   ymuint mMnum;
 
   ymuint mFsum;
@@ -489,6 +650,18 @@ FgMgrBase::mandatory_assignment(ymuint gid) const
   return fg->mandatory_assignment();
 }
 
+// @brief [デバッグ用] グループのソルバを返す．
+// @param[in] gid グループ番号 ( 0 <= gid < group_num() )
+//
+// 作られていない場合には nullptr を返す．
+inline
+const GroupSolver*
+FgMgrBase::group_solver(ymuint gid) const
+{
+  const FaultGroup* fg = _fault_group(gid);
+  return fg->solver();
+}
+
 // @brief 衝突キャッシュに登録する
 inline
 void
@@ -0,0 +1,157 @@
+
+/// @file GroupSolver.cc
+/// @brief GroupSolver の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "GroupSolver.h"
+#include "FaultAnalyzer.h"
+#include "FaultInfo.h"
+#include "FoCone.h"
+#include "TpgNode.h"
+#include "TpgFault.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス GroupSolver
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+// @param[in] max_node_id ノード番号の最大値 + 1
+// @param[in] analyzer 故障解析器
+GroupSolver::GroupSolver(ymuint max_node_id,
+			 const FaultAnalyzer& analyzer) :
+  mStructSat(max_node_id),
+  mAnalyzer(analyzer),
+  mPendVar(kSatVarIdIllegal),
+  mPending(false),
+  mRetractNum(0)
+{
+}
+
+// @brief デストラクタ
+GroupSolver::~GroupSolver()
+{
+}
+
+// @brief 故障を無条件で追加する．
+// @param[in] fid 故障番号
+void
+GroupSolver::add_fault(ymuint fid)
+{
+  ASSERT_COND( !mPending );
+
+  const FaultInfo& fi = mAnalyzer.fault_info(fid);
+
+  // fid の必要割当を追加
+  mStructSat.add_assignments(fi.mandatory_assignment());
+
+  const FoCone* focone = nullptr;
+  if ( !fi.single_cube() ) {
+    // fid を検出する条件を追加
+    focone = mStructSat.add_focone(fi.fault(), kVal1);
+  }
+
+  mFidList.push_back(fid);
+  mFoConeList.push_back(focone);
+}
+
+// @brief 故障を試しに追加する．
+// @param[in] fid 故障番号
+// @param[out] sat_model 両立していた場合の SAT の解
+// @retval true 両立していた．
+// @retval false 両立しなかった．
+bool
+GroupSolver::check_fault(ymuint fid,
+			 vector<SatBool3>& sat_model)
+{
+  ASSERT_COND( !mPending );
+
+  const FaultInfo& fi = mAnalyzer.fault_info(fid);
+  SatSolver& solver = mStructSat.solver();
+
+  vector<SatLiteral> assumptions;
+  const FoCone* focone = nullptr;
+  mPendVar = kSatVarIdIllegal;
+  mPendCond.clear();
+  if ( !fi.single_cube() ) {
+    // fid を検出する条件を mPendVar で制御する形で追加
+    const TpgFault* fault = fi.fault();
+    mPendVar = solver.new_var();
+    focone = mStructSat.add_focone(fault->tpg_onode(), mPendVar);
+    assumptions.push_back(SatLiteral(mPendVar));
+
+    // 故障の活性化条件も仮定として与える．
+    mStructSat.add_fault_condition(fault, mPendCond);
+    mStructSat.conv_to_assumption(mPendCond, assumptions);
+  }
+  mStructSat.conv_to_assumption(fi.mandatory_assignment(), assumptions);
+
+  mFidList.push_back(fid);
+  mFoConeList.push_back(focone);
+  mPending = true;
+
+  return solver.solve(assumptions, sat_model) == kB3True;
+}
+
+// @brief 保留中の故障を確定する．
+void
+GroupSolver::commit_fault()
+{
+  ASSERT_COND( mPending );
+
+  // 仮定を確定させる．
+  if ( mPendVar != kSatVarIdIllegal ) {
+    mStructSat.solver().add_clause(SatLiteral(mPendVar));
+    mStructSat.add_assignments(mPendCond);
+  }
+  const FaultInfo& fi = mAnalyzer.fault_info(mFidList.back());
+  mStructSat.add_assignments(fi.mandatory_assignment());
+
+  mPending = false;
+}
+
+// @brief 保留中の故障を取り消す．
+void
+GroupSolver::retract_fault()
+{
+  ASSERT_COND( mPending );
+
+  if ( mPendVar != kSatVarIdIllegal ) {
+    // 追加した検出条件を無効化する．
+    mStructSat.solver().add_clause(~SatLiteral(mPendVar));
+    ++ mRetractNum;
+  }
+
+  mFidList.pop_back();
+  mFoConeList.pop_back();
+  mPending = false;
+}
+
+// @brief 故障の十分割当を求める．
+// @param[in] pos 位置番号 ( 0 <= pos <= fault_num() )
+// @param[in] sat_model check_fault() で得られた SAT の解
+// @param[out] suf_list 十分割当リスト
+void
+GroupSolver::get_suf_list(ymuint pos,
+			  const vector<SatBool3>& sat_model,
+			  NodeValList& suf_list) const
+{
+  ASSERT_COND( pos < mFidList.size() );
+
+  const FaultInfo& fi = mAnalyzer.fault_info(mFidList[pos]);
+  const FoCone* focone = mFoConeList[pos];
+  if ( focone == nullptr ) {
+    suf_list = fi.mandatory_assignment();
+  }
+  else {
+    focone->get_suf_list(sat_model, fi.fault(), suf_list);
+  }
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,183 @@
+#ifndef GROUPSOLVER_H
+#define GROUPSOLVER_H
+
+/// @file GroupSolver.h
+/// @brief GroupSolver のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "StructSat.h"
+#include "NodeValList.h"
+#include "ym/SatBool3.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+class FaultAnalyzer;
+
+//////////////////////////////////////////////////////////////////////
+/// @class GroupSolver GroupSolver.h "GroupSolver.h"
+/// @brief 1つの故障グループの両立性を調べるインクリメンタルな SAT ソルバ
+///
+/// グループに含まれる故障の検出条件は一度だけ CNF に加えられ，
+/// 故障がグループに加わるごとに追加されていく．
+/// 新しい故障の検出条件は制御用の変数で有効化して仮定のもとで試し，
+/// 確定する場合はその変数を 1 に，取り消す場合は 0 に固定する．
+//////////////////////////////////////////////////////////////////////
+class GroupSolver
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] max_node_id ノード番号の最大値 + 1
+  /// @param[in] analyzer 故障解析器
+  GroupSolver(ymuint max_node_id,
+	      const FaultAnalyzer& analyzer);
+
+  /// @brief デストラクタ
+  ~GroupSolver();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 登録されている故障数を返す．
+  ymuint
+  fault_num() const;
+
+  /// @brief 登録されている故障番号を返す．
+  /// @param[in] pos 位置番号 ( 0 <= pos < fault_num() )
+  ymuint
+  fault_id(ymuint pos) const;
+
+  /// @brief 取り消された検出条件の数を返す．
+  ymuint
+  retract_num() const;
+
+  /// @brief 故障を無条件で追加する．
+  /// @param[in] fid 故障番号
+  ///
+  /// 既にグループに含まれている故障の検出条件を加える時に用いる．
+  void
+  add_fault(ymuint fid);
+
+  /// @brief 故障を試しに追加する．
+  /// @param[in] fid 故障番号
+  /// @param[out] sat_model 両立していた場合の SAT の解
+  /// @retval true 両立していた．
+  /// @retval false 両立しなかった．
+  ///
+  /// 結果に関わらず fid は保留状態となり，commit_fault() か
+  /// retract_fault() が呼ばれるまで次の check_fault() は呼べない．
+  bool
+  check_fault(ymuint fid,
+	      vector<SatBool3>& sat_model);
+
+  /// @brief 保留中の故障を確定する．
+  ///
+  /// check_fault() が true を返した時のみ呼べる．
+  void
+  commit_fault();
+
+  /// @brief 保留中の故障を取り消す．
+  void
+  retract_fault();
+
+  /// @brief 保留中の故障があるとき true を返す．
+  bool
+  has_pending() const;
+
+  /// @brief 故障の十分割当を求める．
+  /// @param[in] pos 位置番号 ( 0 <= pos <= fault_num() )
+  /// @param[in] sat_model check_fault() で得られた SAT の解
+  /// @param[out] suf_list 十分割当リスト
+  ///
+  /// pos == fault_num() の時は保留中の故障を表す．
+  /// single cube の故障の場合は必要割当をそのまま返す．
+  void
+  get_suf_list(ymuint pos,
+	       const vector<SatBool3>& sat_model,
+	       NodeValList& suf_list) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // SAT ソルバ
+  StructSat mStructSat;
+
+  // 故障解析器
+  const FaultAnalyzer& mAnalyzer;
+
+  // 故障番号のリスト
+  vector<ymuint> mFidList;
+
+  // mFidList の故障に対応する fault cone のリスト
+  // single cube の故障の場合は nullptr となる．
+  // 保留中の故障があるときはどちらのリストも末尾がその故障になる．
+  vector<const FoCone*> mFoConeList;
+
+  // 保留中の故障の検出条件を制御する変数
+  SatVarId mPendVar;
+
+  // 保留中の故障の活性化条件
+  NodeValList mPendCond;
+
+  // 保留中の故障があるとき true となるフラグ
+  bool mPending;
+
+  // 取り消された検出条件の数
+  ymuint mRetractNum;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief 登録されている故障数を返す．
+inline
+ymuint
+GroupSolver::fault_num() const
+{
+  return mPending ? mFidList.size() - 1 : mFidList.size();
+}
+
+// @brief 登録されている故障番号を返す．
+// @param[in] pos 位置番号 ( 0 <= pos < fault_num() )
+inline
+ymuint
+GroupSolver::fault_id(ymuint pos) const
+{
+  ASSERT_COND( pos < fault_num() );
+  return mFidList[pos];
+}
+
+// @brief 取り消された検出条件の数を返す．
+inline
+ymuint
+GroupSolver::retract_num() const
+{
+  return mRetractNum;
+}
+
+// @brief 保留中の故障があるとき true を返す．
+inline
+bool
+GroupSolver::has_pending() const
+{
+  return mPending;
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // GROUPSOLVER_H
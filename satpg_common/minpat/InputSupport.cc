@@ -0,0 +1,101 @@
+
+/// @file InputSupport.cc
+/// @brief InputSupport の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "InputSupport.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス InputSupport
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+InputSupport::InputSupport() :
+  mWordNum(0)
+{
+}
+
+// @brief デストラクタ
+InputSupport::~InputSupport()
+{
+}
+
+// @brief 初期化する．
+// @param[in] input_num 入力数
+void
+InputSupport::init(ymuint input_num)
+{
+  mWordNum = (input_num + kPvBitLen - 1) / kPvBitLen;
+  mBitArray.clear();
+  mStartArray.clear();
+  mEndArray.clear();
+  mHashTable.clear();
+}
+
+// @brief 集合を登録する．
+// @param[in] input_list 入力番号のリスト
+// @return 集合の番号を返す．
+ymuint
+InputSupport::reg_set(const vector<ymuint>& input_list)
+{
+  // 新しい集合の分の領域を確保してビットベクタを作る．
+  ymuint id = set_num();
+  ymuint base = id * mWordNum;
+  mBitArray.resize(base + mWordNum, kPvAll0);
+  PackedVal* bv = &mBitArray[base];
+  for (ymuint i = 0; i < input_list.size(); ++ i) {
+    ymuint pos = input_list[i];
+    ASSERT_COND( pos / kPvBitLen < mWordNum );
+    bv[pos / kPvBitLen] |= (1UL << (pos % kPvBitLen));
+  }
+
+  ymuint start = 0;
+  while ( start < mWordNum && bv[start] == kPvAll0 ) {
+    ++ start;
+  }
+  ymuint end = mWordNum;
+  while ( end > start && bv[end - 1] == kPvAll0 ) {
+    -- end;
+  }
+
+  PackedVal hash = start;
+  for (ymuint i = start; i < end; ++ i) {
+    hash = hash * 1048583UL + bv[i];
+  }
+
+  // 同じ内容の集合が既にあればそれを用いる．
+  typedef std::unordered_multimap<PackedVal, ymuint>::const_iterator Iter;
+  std::pair<Iter, Iter> range = mHashTable.equal_range(hash);
+  for (Iter p = range.first; p != range.second; ++ p) {
+    ymuint id1 = p->second;
+    if ( mStartArray[id1] != start || mEndArray[id1] != end ) {
+      continue;
+    }
+    const PackedVal* bv1 = &mBitArray[id1 * mWordNum];
+    bool found = true;
+    for (ymuint i = start; i < end; ++ i) {
+      if ( bv1[i] != bv[i] ) {
+	found = false;
+	break;
+      }
+    }
+    if ( found ) {
+      mBitArray.resize(base);
+      return id1;
+    }
+  }
+
+  mStartArray.push_back(start);
+  mEndArray.push_back(end);
+  mHashTable.insert(make_pair(hash, id));
+  return id;
+}
+
+END_NAMESPACE_YM_SATPG
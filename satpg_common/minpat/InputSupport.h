@@ -0,0 +1,135 @@
+#ifndef INPUTSUPPORT_H
+#define INPUTSUPPORT_H
+
+/// @file InputSupport.h
+/// @brief InputSupport のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "PackedVal.h"
+#include <unordered_map>
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class InputSupport InputSupport.h "InputSupport.h"
+/// @brief 入力番号の集合をビットベクタで保持する表
+///
+/// 集合は登録した順に番号で区別される．
+/// 同じ内容の集合は一つだけ保持して同じ番号を返す．
+/// 各集合は 0 でないワードの範囲を覚えているので，
+/// 共通部分の判定はその範囲の重なった部分のワードだけを調べればよい．
+//////////////////////////////////////////////////////////////////////
+class InputSupport
+{
+public:
+
+  /// @brief コンストラクタ
+  InputSupport();
+
+  /// @brief デストラクタ
+  ~InputSupport();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 初期化する．
+  /// @param[in] input_num 入力数
+  ///
+  /// 登録されている集合は削除される．
+  void
+  init(ymuint input_num);
+
+  /// @brief 集合を登録する．
+  /// @param[in] input_list 入力番号のリスト
+  /// @return 集合の番号を返す．
+  ///
+  /// input_list はソートされていなくてもよい．
+  ymuint
+  reg_set(const vector<ymuint>& input_list);
+
+  /// @brief 登録されている集合の数を返す．
+  ymuint
+  set_num() const;
+
+  /// @brief 2つの集合が共通要素を持つ時 true を返す．
+  /// @param[in] id1, id2 集合の番号
+  bool
+  check_intersect(ymuint id1,
+		  ymuint id2) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 1つの集合を表すワード数
+  ymuint mWordNum;
+
+  // 全ての集合のビットベクタを並べた配列
+  vector<PackedVal> mBitArray;
+
+  // 集合ごとの 0 でない最初のワード位置
+  vector<ymuint> mStartArray;
+
+  // 集合ごとの 0 でない最後のワード位置 + 1
+  vector<ymuint> mEndArray;
+
+  // ハッシュ値をキーにして集合の番号を入れるハッシュ表
+  std::unordered_multimap<PackedVal, ymuint> mHashTable;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief 登録されている集合の数を返す．
+inline
+ymuint
+InputSupport::set_num() const
+{
+  return mStartArray.size();
+}
+
+// @brief 2つの集合が共通要素を持つ時 true を返す．
+// @param[in] id1, id2 集合の番号
+inline
+bool
+InputSupport::check_intersect(ymuint id1,
+			      ymuint id2) const
+{
+  ymuint start = mStartArray[id1];
+  ymuint end = mEndArray[id1];
+  if ( id1 == id2 ) {
+    return start < end;
+  }
+  if ( start < mStartArray[id2] ) {
+    start = mStartArray[id2];
+  }
+  if ( end > mEndArray[id2] ) {
+    end = mEndArray[id2];
+  }
+  const PackedVal* bv1 = &mBitArray[id1 * mWordNum];
+  const PackedVal* bv2 = &mBitArray[id2 * mWordNum];
+  for (ymuint i = start; i < end; ++ i) {
+    if ( (bv1[i] & bv2[i]) != kPvAll0 ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // INPUTSUPPORT_H
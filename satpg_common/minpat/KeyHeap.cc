@@ -0,0 +1,146 @@
+
+/// @file KeyHeap.cc
+/// @brief KeyHeap の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "KeyHeap.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+// クラス KeyHeap
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+KeyHeap::KeyHeap()
+{
+}
+
+// @brief デストラクタ
+KeyHeap::~KeyHeap()
+{
+}
+
+// @brief 初期化する．
+// @param[in] n 要素番号の最大値 + 1
+void
+KeyHeap::init(ymuint n)
+{
+  mKey.clear();
+  mKey.resize(n, 0);
+  mHeapPos.clear();
+  mHeapPos.resize(n, -1);
+  mHeap.clear();
+  mHeap.reserve(n);
+}
+
+// @brief 空にする．
+void
+KeyHeap::clear()
+{
+  for (ymuint i = 0; i < mHeap.size(); ++ i) {
+    mHeapPos[mHeap[i]] = -1;
+  }
+  mHeap.clear();
+}
+
+// @brief 要素のキーを設定する．
+// @param[in] id 要素番号
+// @param[in] key キー
+void
+KeyHeap::put(ymuint id,
+	     int key)
+{
+  if ( !in_heap(id) ) {
+    mKey[id] = key;
+    ymuint pos = mHeap.size();
+    mHeap.push_back(id);
+    mHeapPos[id] = pos;
+    move_up(pos);
+    return;
+  }
+
+  int old_key = mKey[id];
+  mKey[id] = key;
+  if ( key > old_key ) {
+    move_up(mHeapPos[id]);
+  }
+  else if ( key < old_key ) {
+    move_down(mHeapPos[id]);
+  }
+}
+
+// @brief 要素をヒープから取り除く．
+// @param[in] id 要素番号
+void
+KeyHeap::remove(ymuint id)
+{
+  if ( !in_heap(id) ) {
+    return;
+  }
+
+  ymuint pos = mHeapPos[id];
+  mHeapPos[id] = -1;
+  ymuint last = mHeap.back();
+  mHeap.pop_back();
+  if ( last == id ) {
+    return;
+  }
+
+  // 末尾の要素を空いた位置に入れて上下に動かす．
+  set(last, pos);
+  move_up(pos);
+  move_down(mHeapPos[last]);
+}
+
+// @brief 引数の位置にある要素を適当な位置まで上げてゆく
+// @param[in] pos 対象の要素の位置
+void
+KeyHeap::move_up(ymuint pos)
+{
+  ymuint id = mHeap[pos];
+  while ( pos > 0 ) {
+    ymuint pos_p = (pos - 1) >> 1;
+    ymuint id_p = mHeap[pos_p];
+    if ( !before(id, id_p) ) {
+      break;
+    }
+    set(id_p, pos);
+    pos = pos_p;
+  }
+  set(id, pos);
+}
+
+// @brief 引数の位置にある要素を適当な位置まで沈めてゆく
+// @param[in] pos 対象の要素の位置
+void
+KeyHeap::move_down(ymuint pos)
+{
+  ymuint n = mHeap.size();
+  ymuint id = mHeap[pos];
+  for ( ; ; ) {
+    ymuint pos_l = pos + pos + 1;
+    if ( pos_l >= n ) {
+      break;
+    }
+    ymuint pos_r = pos_l + 1;
+    ymuint pos_c = pos_l;
+    if ( pos_r < n && before(mHeap[pos_r], mHeap[pos_l]) ) {
+      pos_c = pos_r;
+    }
+    ymuint id_c = mHeap[pos_c];
+    if ( !before(id_c, id) ) {
+      break;
+    }
+    set(id_c, pos);
+    pos = pos_c;
+  }
+  set(id, pos);
+}
+
+END_NAMESPACE_YM_SATPG
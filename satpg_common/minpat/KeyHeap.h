@@ -0,0 +1,232 @@
+#ifndef KEYHEAP_H
+#define KEYHEAP_H
+
+/// @file KeyHeap.h
+/// @brief KeyHeap のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class KeyHeap KeyHeap.h "KeyHeap.h"
+/// @brief 整数のキーを持つ要素の位置付きヒープ木
+///
+/// 要素は 0 から始まる番号で表し，キーの最も大きい要素を先頭に置く．
+/// キーが等しい場合には番号の小さい方を先に置く．
+/// 各要素のヒープ上の位置を持っているので，ヒープに入っている要素の
+/// キーの変更や削除を O(log n) で行える．
+/// 最小のものを取り出したい場合にはキーの符号を反転させて用いる．
+//////////////////////////////////////////////////////////////////////
+class KeyHeap
+{
+public:
+
+  /// @brief コンストラクタ
+  KeyHeap();
+
+  /// @brief デストラクタ
+  ~KeyHeap();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 初期化する．
+  /// @param[in] n 要素番号の最大値 + 1
+  ///
+  /// ヒープは空になる．
+  void
+  init(ymuint n);
+
+  /// @brief 空にする．
+  void
+  clear();
+
+  /// @brief 要素が空の時 true を返す．
+  bool
+  empty() const;
+
+  /// @brief ヒープに入っている要素数を返す．
+  ymuint
+  size() const;
+
+  /// @brief 要素がヒープに入っている時 true を返す．
+  /// @param[in] id 要素番号
+  bool
+  in_heap(ymuint id) const;
+
+  /// @brief 要素のキーを設定する．
+  /// @param[in] id 要素番号
+  /// @param[in] key キー
+  ///
+  /// 要素がヒープに入っていなければ追加する．
+  void
+  put(ymuint id,
+      int key);
+
+  /// @brief 要素をヒープから取り除く．
+  /// @param[in] id 要素番号
+  ///
+  /// 要素がヒープに入っていなければなにもしない．
+  void
+  remove(ymuint id);
+
+  /// @brief 先頭の要素を返す．
+  ///
+  /// ヒープは空であってはならない．
+  ymuint
+  top() const;
+
+  /// @brief 先頭の要素を取り出す．
+  ///
+  /// 該当の要素はヒープから取り除かれる．
+  ymuint
+  pop_top();
+
+  /// @brief 要素のキーを返す．
+  /// @param[in] id 要素番号
+  int
+  key(ymuint id) const;
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief id1 が id2 よりも先頭に近くあるべき時 true を返す．
+  bool
+  before(ymuint id1,
+	 ymuint id2) const;
+
+  /// @brief 引数の位置にある要素を適当な位置まで上げてゆく
+  /// @param[in] pos 対象の要素の位置
+  void
+  move_up(ymuint pos);
+
+  /// @brief 引数の位置にある要素を適当な位置まで沈めてゆく
+  /// @param[in] pos 対象の要素の位置
+  void
+  move_down(ymuint pos);
+
+  /// @brief 要素を配列にセットする．
+  /// @param[in] id 要素番号
+  /// @param[in] pos 位置
+  ///
+  /// mHeap と mHeapPos の一貫性を保つためにはこの関数を使うこと．
+  void
+  set(ymuint id,
+      ymuint pos);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 要素番号をキーにしてキーを入れる配列
+  vector<int> mKey;
+
+  // 要素番号をキーにしてヒープ上の位置を入れる配列
+  // ヒープに入っていない時は -1
+  vector<int> mHeapPos;
+
+  // ヒープ用の配列
+  vector<ymuint> mHeap;
+
+};
+
+
+//////////////////////////////////////////////////////////////////////
+// インライン関数の定義
+//////////////////////////////////////////////////////////////////////
+
+// @brief 要素が空の時 true を返す．
+inline
+bool
+KeyHeap::empty() const
+{
+  return mHeap.empty();
+}
+
+// @brief ヒープに入っている要素数を返す．
+inline
+ymuint
+KeyHeap::size() const
+{
+  return mHeap.size();
+}
+
+// @brief 要素がヒープに入っている時 true を返す．
+// @param[in] id 要素番号
+inline
+bool
+KeyHeap::in_heap(ymuint id) const
+{
+  return mHeapPos[id] >= 0;
+}
+
+// @brief 先頭の要素を返す．
+inline
+ymuint
+KeyHeap::top() const
+{
+  ASSERT_COND( !empty() );
+  return mHeap[0];
+}
+
+// @brief 先頭の要素を取り出す．
+inline
+ymuint
+KeyHeap::pop_top()
+{
+  ymuint id = top();
+  remove(id);
+  return id;
+}
+
+// @brief 要素のキーを返す．
+// @param[in] id 要素番号
+inline
+int
+KeyHeap::key(ymuint id) const
+{
+  return mKey[id];
+}
+
+// @brief id1 が id2 よりも先頭に近くあるべき時 true を返す．
+inline
+bool
+KeyHeap::before(ymuint id1,
+		ymuint id2) const
+{
+  int key1 = mKey[id1];
+  int key2 = mKey[id2];
+  if ( key1 != key2 ) {
+    return key1 > key2;
+  }
+  return id1 < id2;
+}
+
+// @brief 要素を配列にセットする．
+inline
+void
+KeyHeap::set(ymuint id,
+	     ymuint pos)
+{
+  mHeap[pos] = id;
+  mHeapPos[id] = pos;
+}
+
+END_NAMESPACE_YM_SATPG
+
+#endif // KEYHEAP_H
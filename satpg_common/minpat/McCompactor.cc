@@ -9,9 +9,12 @@
 
 #include "McCompactor.h"
 #include "McOp.h"
+#include "McHeuristic.h"
 #include "Fsim.h"
 #include "TpgFault.h"
+#include "PackedValW.h"
 #include "ym/MinCov.h"
+#include <thread>
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -21,11 +24,18 @@ BEGIN_NAMESPACE_YM_SATPG
 //////////////////////////////////////////////////////////////////////
 
 // @brief コンストラクタ
+// @param[in] network 対象のネットワーク
 // @param[in] fsim 故障シミュレータ
-McCompactor::McCompactor(Fsim& fsim) :
-  mFsim(fsim)
+McCompactor::McCompactor(const TpgNetwork& network,
+			 Fsim& fsim) :
+  mNetwork(network),
+  mFsim(fsim),
+  mNextPos(0)
 {
   mVerbose = 0;
+  mThreadNum = 1;
+  mHeuristic = false;
+  mTimeLimit = 0.0;
 }
 
 // @brief デストラクタ
@@ -41,6 +51,31 @@ McCompactor::set_verbose(ymuint verbose)
   mVerbose = verbose;
 }
 
+// @brief 被覆行列を作る時のスレッド数を設定する．
+// @param[in] num スレッド数
+void
+McCompactor::set_thread_num(ymuint num)
+{
+  if ( num == 0 ) {
+    num = std::thread::hardware_concurrency();
+    if ( num == 0 ) {
+      num = 1;
+    }
+  }
+  mThreadNum = num;
+}
+
+// @brief 最小被覆問題の解法を設定する．
+// @param[in] heuristic true の時はヒューリスティックで解く．
+// @param[in] time_limit ヒューリスティックの局所探索の制限時間(秒)
+void
+McCompactor::set_heuristic(bool heuristic,
+			   double time_limit)
+{
+  mHeuristic = heuristic;
+  mTimeLimit = time_limit;
+}
+
 // @brief 故障グループを圧縮する．
 // @param[in] fault_list 故障リスト
 // @param[in] orig_tv_list もとのテストセット
@@ -61,28 +96,38 @@ McCompactor::run(const vector<const TpgFault*>& fault_list,
     }
   }
 
-  // 故障番号から fault_list 中の位置を求める表
-  vector<ymuint> row_map(max_fault_id, 0);
+  // 故障番号から fault_list 中の位置 + 1 を求める表
+  // 0 は fault_list に含まれないことを表す．
+  vector<ymuint> row_map(max_fault_id + 1, 0);
   for (ymuint i = 0; i < nf; ++ i) {
     const TpgFault* fault = fault_list[i];
     ymuint fid = fault->id();
-    row_map[fid] = i;
+    row_map[fid] = i + 1;
   }
 
-  mFsim.set_faults(fault_list);
-
   ymuint np = orig_tv_list.size();
-  MinCov mincov;
-  mincov.set_size(nf, np);
-  for (ymuint i = 0; i < np; ++ i) {
-    TestVector* tv = orig_tv_list[i];
-    McOp op(mincov, row_map, i);
-    mFsim.sppfp(tv, op);
+  vector<pair<ymuint, ymuint> > elem_list;
+  if ( mThreadNum > 1 && np > kPvwBitLen ) {
+    make_matrix_mt(fault_list, orig_tv_list, row_map, elem_list);
+  }
+  else {
+    make_matrix(fault_list, orig_tv_list, row_map, elem_list);
   }
 
   // 最終被覆問題を解く
   vector<ymuint32> solution;
-  mincov.exact(solution);
+  if ( mHeuristic ) {
+    McHeuristic heuristic(nf, np, elem_list);
+    heuristic.solve(mTimeLimit, solution);
+  }
+  else {
+    MinCov mincov;
+    mincov.set_size(nf, np);
+    for (ymuint i = 0; i < elem_list.size(); ++ i) {
+      mincov.insert_elem(elem_list[i].first, elem_list[i].second);
+    }
+    mincov.exact(solution);
+  }
 
   // solution の内容から tv_list を作る．
   ymuint n = solution.size();
@@ -94,4 +139,114 @@ McCompactor::run(const vector<const TpgFault*>& fault_list,
   }
 }
 
+// @brief 被覆行列を作る．
+// @param[in] fault_list 故障リスト
+// @param[in] tv_list テストセット
+// @param[in] row_map 故障番号から行番号 + 1 を得る表
+// @param[out] elem_list 要素(行番号, 列番号)のリスト
+void
+McCompactor::make_matrix(const vector<const TpgFault*>& fault_list,
+			 const vector<TestVector*>& tv_list,
+			 const vector<ymuint>& row_map,
+			 vector<pair<ymuint, ymuint> >& elem_list)
+{
+  mFsim.set_faults(fault_list);
+
+  vector<TestVector*> cur_array;
+  cur_array.reserve(kPvwBitLen);
+  ymuint np = tv_list.size();
+  for (ymuint base = 0; base < np; base += kPvwBitLen) {
+    ymuint nb = np - base;
+    if ( nb > kPvwBitLen ) {
+      nb = kPvwBitLen;
+    }
+    cur_array.assign(tv_list.begin() + base, tv_list.begin() + base + nb);
+
+    McOp op(row_map, base, nb, elem_list);
+    mFsim.ppsfp(cur_array, op);
+  }
+}
+
+// @brief 被覆行列を作る(並列版)．
+// @param[in] fault_list 故障リスト
+// @param[in] tv_list テストセット
+// @param[in] row_map 故障番号から行番号 + 1 を得る表
+// @param[out] elem_list 要素(行番号, 列番号)のリスト
+//
+// 各スレッドは自分用の要素のリストを作り，
+// 全スレッドの終了後にこのスレッドで elem_list にまとめる．
+void
+McCompactor::make_matrix_mt(const vector<const TpgFault*>& fault_list,
+			    const vector<TestVector*>& tv_list,
+			    const vector<ymuint>& row_map,
+			    vector<pair<ymuint, ymuint> >& elem_list)
+{
+  ymuint np = tv_list.size();
+  ymuint nt = mThreadNum;
+  ymuint nbatch = (np + kPvwBitLen - 1) / kPvwBitLen;
+  if ( nt > nbatch ) {
+    nt = nbatch;
+  }
+
+  // 故障シミュレータはスレッドごとに用意する．
+  vector<Fsim*> fsim_array(nt);
+  for (ymuint i = 0; i < nt; ++ i) {
+    Fsim* fsim = new_Fsim3();
+    fsim->set_network(mNetwork);
+    fsim->set_faults(fault_list);
+    fsim_array[i] = fsim;
+  }
+
+  mNextPos = 0;
+
+  vector<vector<pair<ymuint, ymuint> > > elem_list_array(nt);
+  vector<std::thread> thread_list;
+  thread_list.reserve(nt);
+  for (ymuint i = 0; i < nt; ++ i) {
+    thread_list.push_back(std::thread(&McCompactor::matrix_worker, this,
+				      fsim_array[i], std::cref(tv_list),
+				      std::cref(row_map),
+				      std::ref(elem_list_array[i])));
+  }
+  for (ymuint i = 0; i < nt; ++ i) {
+    thread_list[i].join();
+  }
+
+  for (ymuint i = 0; i < nt; ++ i) {
+    const vector<pair<ymuint, ymuint> >& elem_list1 = elem_list_array[i];
+    elem_list.insert(elem_list.end(), elem_list1.begin(), elem_list1.end());
+    delete fsim_array[i];
+  }
+}
+
+// @brief make_matrix_mt() のワーカースレッドの本体
+// @param[in] fsim このスレッド用の故障シミュレータ
+// @param[in] tv_list テストセット
+// @param[in] row_map 故障番号から行番号 + 1 を得る表
+// @param[out] elem_list 要素のリスト
+void
+McCompactor::matrix_worker(Fsim* fsim,
+			   const vector<TestVector*>& tv_list,
+			   const vector<ymuint>& row_map,
+			   vector<pair<ymuint, ymuint> >& elem_list)
+{
+  vector<TestVector*> cur_array;
+  cur_array.reserve(kPvwBitLen);
+  ymuint np = tv_list.size();
+  for ( ; ; ) {
+    ymuint base = mNextPos.fetch_add(kPvwBitLen);
+    if ( base >= np ) {
+      break;
+    }
+    ymuint nb = np - base;
+    if ( nb > kPvwBitLen ) {
+      nb = kPvwBitLen;
+    }
+    cur_array.assign(tv_list.begin() + base, tv_list.begin() + base + nb);
+
+    McOp op(row_map, base, nb, elem_list);
+    fsim->ppsfp(cur_array, op);
+  }
+}
+
 END_NAMESPACE_YM_SATPG
@@ -10,6 +10,7 @@
 
 
 #include "satpg.h"
+#include <atomic>
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -23,8 +24,10 @@ class McCompactor
 public:
 
   /// @brief コンストラクタ
+  /// @param[in] network 対象のネットワーク
   /// @param[in] fsim 故障シミュレータ
-  McCompactor(Fsim& fsim);
+  McCompactor(const TpgNetwork& network,
+	      Fsim& fsim);
 
 
   /// @brief デストラクタ
@@ -50,24 +53,92 @@ public:
   void
   set_verbose(ymuint verbose);
 
+  /// @brief 被覆行列を作る時のスレッド数を設定する．
+  /// @param[in] num スレッド数
+  ///
+  /// 2 以上の場合はスレッドごとに3値の故障シミュレータを作って
+  /// パタンを分担する．
+  void
+  set_thread_num(ymuint num);
+
+  /// @brief 最小被覆問題の解法を設定する．
+  /// @param[in] heuristic true の時はヒューリスティックで解く．
+  /// @param[in] time_limit ヒューリスティックの局所探索の制限時間(秒)
+  ///
+  /// heuristic が false の時は厳密解を求める．
+  /// time_limit が 0 以下の場合は局所探索を行わない．
+  void
+  set_heuristic(bool heuristic,
+		double time_limit);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
   // 内部で用いられる関数
   //////////////////////////////////////////////////////////////////////
 
+  /// @brief 被覆行列を作る．
+  /// @param[in] fault_list 故障リスト
+  /// @param[in] tv_list テストセット
+  /// @param[in] row_map 故障番号から行番号 + 1 を得る表
+  /// @param[out] elem_list 要素(行番号, 列番号)のリスト
+  ///
+  /// mFsim.ppsfp() を用いて kPvwBitLen 個ずつパタンを処理する．
+  void
+  make_matrix(const vector<const TpgFault*>& fault_list,
+	      const vector<TestVector*>& tv_list,
+	      const vector<ymuint>& row_map,
+	      vector<pair<ymuint, ymuint> >& elem_list);
+
+  /// @brief 被覆行列を作る(並列版)．
+  /// @param[in] fault_list 故障リスト
+  /// @param[in] tv_list テストセット
+  /// @param[in] row_map 故障番号から行番号 + 1 を得る表
+  /// @param[out] elem_list 要素(行番号, 列番号)のリスト
+  void
+  make_matrix_mt(const vector<const TpgFault*>& fault_list,
+		 const vector<TestVector*>& tv_list,
+		 const vector<ymuint>& row_map,
+		 vector<pair<ymuint, ymuint> >& elem_list);
+
+  /// @brief make_matrix_mt() のワーカースレッドの本体
+  /// @param[in] fsim このスレッド用の故障シミュレータ
+  /// @param[in] tv_list テストセット
+  /// @param[in] row_map 故障番号から行番号 + 1 を得る表
+  /// @param[out] elem_list 要素のリスト
+  void
+  matrix_worker(Fsim* fsim,
+		const vector<TestVector*>& tv_list,
+		const vector<ymuint>& row_map,
+		vector<pair<ymuint, ymuint> >& elem_list);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
+  // 対象のネットワーク
+  const TpgNetwork& mNetwork;
+
   // 故障シミュレータ
   Fsim& mFsim;
 
   // verbose フラグ
   ymuint mVerbose;
 
+  // スレッド数
+  ymuint mThreadNum;
+
+  // ヒューリスティックで解く時 true にするフラグ
+  bool mHeuristic;
+
+  // 局所探索の制限時間(秒)
+  double mTimeLimit;
+
+  // make_matrix_mt() で次に処理するパタンの位置
+  std::atomic<ymuint> mNextPos;
+
 };
 
 END_NAMESPACE_YM_SATPG
@@ -0,0 +1,295 @@
+
+/// @file McHeuristic.cc
+/// @brief McHeuristic の実装ファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "McHeuristic.h"
+#include "ym/StopWatch.h"
+#include <queue>
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+BEGIN_NONAMESPACE
+
+// 貪欲法のヒープ用の比較関数
+// 利得の大きいものを先に，同じなら列番号の小さいものを先にする．
+struct GainLt
+{
+  bool
+  operator()(const pair<ymuint, ymuint>& left,
+	     const pair<ymuint, ymuint>& right) const
+  {
+    if ( left.first != right.first ) {
+      return left.first < right.first;
+    }
+    return left.second > right.second;
+  }
+};
+
+// 局所探索で一度に取り除く列の数
+const ymuint kRemoveNum = 2;
+
+END_NONAMESPACE
+
+
+//////////////////////////////////////////////////////////////////////
+// クラス McHeuristic
+//////////////////////////////////////////////////////////////////////
+
+// @brief コンストラクタ
+// @param[in] row_num 行数
+// @param[in] col_num 列数
+// @param[in] elem_list 要素(行番号, 列番号)のリスト
+McHeuristic::McHeuristic(ymuint row_num,
+			 ymuint col_num,
+			 const vector<pair<ymuint, ymuint> >& elem_list) :
+  mColRows(col_num),
+  mRowCols(row_num),
+  mCoverCount(row_num, 0),
+  mSelected(col_num, false)
+{
+  for (ymuint i = 0; i < elem_list.size(); ++ i) {
+    ymuint row = elem_list[i].first;
+    ymuint col = elem_list[i].second;
+    mColRows[col].push_back(row);
+    mRowCols[row].push_back(col);
+  }
+}
+
+// @brief デストラクタ
+McHeuristic::~McHeuristic()
+{
+}
+
+// @brief 問題を解く．
+// @param[in] time_limit 局所探索の制限時間(秒)
+// @param[out] solution 選ばれた列番号のリスト
+void
+McHeuristic::solve(double time_limit,
+		   vector<ymuint32>& solution)
+{
+  StopWatch timer;
+  timer.start();
+
+  ymuint nc = mColRows.size();
+
+  // 貪欲法で初期解を作る．
+  vector<ymuint> cur_sol;
+  {
+    vector<ymuint> cand_list(nc);
+    for (ymuint i = 0; i < nc; ++ i) {
+      cand_list[i] = i;
+    }
+    greedy(cand_list, cur_sol);
+  }
+  prune(cur_sol);
+
+  vector<ymuint> best_sol = cur_sol;
+
+  // 局所探索で改良する．
+  // 解からランダムに列を取り除いて貪欲法で被覆し直し，
+  // 列数が増えなければその解に移る．
+  vector<ymuint> prev_sol;
+  vector<bool> cand_mark(nc, false);
+  while ( time_limit > 0.0 && timer.time().real_time() < time_limit ) {
+    if ( cur_sol.size() <= kRemoveNum ) {
+      break;
+    }
+
+    prev_sol = cur_sol;
+
+    vector<ymuint> removed_list;
+    for (ymuint k = 0; k < kRemoveNum; ++ k) {
+      ymuint pos = mRandGen.int32() % cur_sol.size();
+      ymuint col = cur_sol[pos];
+      cur_sol[pos] = cur_sol.back();
+      cur_sol.pop_back();
+      deselect_col(col);
+      removed_list.push_back(col);
+      cand_mark[col] = true;
+    }
+
+    // 被覆されなくなった行を被覆できる列を候補にする．
+    // 取り除いた列は最初の貪欲法では用いない．
+    vector<ymuint> cand_list;
+    for (ymuint k = 0; k < kRemoveNum; ++ k) {
+      const vector<ymuint>& row_list = mColRows[removed_list[k]];
+      for (ymuint i = 0; i < row_list.size(); ++ i) {
+	ymuint row = row_list[i];
+	if ( mCoverCount[row] > 0 ) {
+	  continue;
+	}
+	const vector<ymuint>& col_list = mRowCols[row];
+	for (ymuint j = 0; j < col_list.size(); ++ j) {
+	  ymuint col = col_list[j];
+	  if ( !cand_mark[col] ) {
+	    cand_mark[col] = true;
+	    cand_list.push_back(col);
+	  }
+	}
+      }
+    }
+    for (ymuint i = 0; i < cand_list.size(); ++ i) {
+      cand_mark[cand_list[i]] = false;
+    }
+    for (ymuint k = 0; k < kRemoveNum; ++ k) {
+      cand_mark[removed_list[k]] = false;
+    }
+
+    greedy(cand_list, cur_sol);
+    // 取り除いた列でしか被覆できない行が残っている場合
+    greedy(removed_list, cur_sol);
+    prune(cur_sol);
+
+    if ( cur_sol.size() > prev_sol.size() ) {
+      // 悪くなったので元に戻す．
+      replace_state(cur_sol, prev_sol);
+      cur_sol.swap(prev_sol);
+    }
+    else if ( cur_sol.size() < best_sol.size() ) {
+      best_sol = cur_sol;
+    }
+  }
+
+  sort(best_sol.begin(), best_sol.end());
+  solution.clear();
+  solution.reserve(best_sol.size());
+  for (ymuint i = 0; i < best_sol.size(); ++ i) {
+    solution.push_back(best_sol[i]);
+  }
+}
+
+// @brief 列を選んだ時に新たに被覆される行数を返す．
+ymuint
+McHeuristic::gain(ymuint col) const
+{
+  const vector<ymuint>& row_list = mColRows[col];
+  ymuint n = 0;
+  for (ymuint i = 0; i < row_list.size(); ++ i) {
+    if ( mCoverCount[row_list[i]] == 0 ) {
+      ++ n;
+    }
+  }
+  return n;
+}
+
+// @brief 列を選ぶ．
+void
+McHeuristic::select_col(ymuint col)
+{
+  mSelected[col] = true;
+  const vector<ymuint>& row_list = mColRows[col];
+  for (ymuint i = 0; i < row_list.size(); ++ i) {
+    ++ mCoverCount[row_list[i]];
+  }
+}
+
+// @brief 列の選択を取り消す．
+void
+McHeuristic::deselect_col(ymuint col)
+{
+  mSelected[col] = false;
+  const vector<ymuint>& row_list = mColRows[col];
+  for (ymuint i = 0; i < row_list.size(); ++ i) {
+    -- mCoverCount[row_list[i]];
+  }
+}
+
+// @brief 貪欲法で未被覆の行を被覆する．
+// @param[in] cand_list 候補の列のリスト
+// @param[inout] solution 解
+//
+// 利得は単調に減少するのでヒープ上の値が古い場合だけ計算し直す．
+void
+McHeuristic::greedy(const vector<ymuint>& cand_list,
+		    vector<ymuint>& solution)
+{
+  std::priority_queue<pair<ymuint, ymuint>,
+		      vector<pair<ymuint, ymuint> >,
+		      GainLt> queue;
+  for (ymuint i = 0; i < cand_list.size(); ++ i) {
+    ymuint col = cand_list[i];
+    if ( mSelected[col] ) {
+      continue;
+    }
+    ymuint g = gain(col);
+    if ( g > 0 ) {
+      queue.push(make_pair(g, col));
+    }
+  }
+
+  while ( !queue.empty() ) {
+    pair<ymuint, ymuint> top = queue.top();
+    queue.pop();
+    ymuint col = top.second;
+    ymuint g = gain(col);
+    if ( g == 0 ) {
+      continue;
+    }
+    if ( g < top.first ) {
+      queue.push(make_pair(g, col));
+      continue;
+    }
+    select_col(col);
+    solution.push_back(col);
+  }
+}
+
+// @brief 冗長な列を取り除く．
+// @param[inout] solution 解
+void
+McHeuristic::prune(vector<ymuint>& solution)
+{
+  ymuint n = solution.size();
+  vector<bool> del_mark(n, false);
+  bool changed = false;
+  for (ymuint i = n; i > 0; -- i) {
+    ymuint col = solution[i - 1];
+    const vector<ymuint>& row_list = mColRows[col];
+    bool redundant = true;
+    for (ymuint j = 0; j < row_list.size(); ++ j) {
+      if ( mCoverCount[row_list[j]] < 2 ) {
+	redundant = false;
+	break;
+      }
+    }
+    if ( redundant ) {
+      deselect_col(col);
+      del_mark[i - 1] = true;
+      changed = true;
+    }
+  }
+
+  if ( changed ) {
+    ymuint wpos = 0;
+    for (ymuint i = 0; i < n; ++ i) {
+      if ( !del_mark[i] ) {
+	solution[wpos] = solution[i];
+	++ wpos;
+      }
+    }
+    solution.erase(solution.begin() + wpos, solution.end());
+  }
+}
+
+// @brief 選ばれている列を入れ替える．
+// @param[in] old_sol 現在の解
+// @param[in] new_sol 新しい解
+void
+McHeuristic::replace_state(const vector<ymuint>& old_sol,
+			   const vector<ymuint>& new_sol)
+{
+  for (ymuint i = 0; i < old_sol.size(); ++ i) {
+    deselect_col(old_sol[i]);
+  }
+  for (ymuint i = 0; i < new_sol.size(); ++ i) {
+    select_col(new_sol[i]);
+  }
+}
+
+END_NAMESPACE_YM_SATPG
@@ -0,0 +1,123 @@
+﻿#ifndef MCHEURISTIC_H
+#define MCHEURISTIC_H
+
+/// @file McHeuristic.h
+/// @brief McHeuristic のヘッダファイル
+/// @author Yusuke Matsunaga (松永 裕介)
+///
+/// Copyright (C) 2015 Yusuke Matsunaga
+/// All rights reserved.
+
+
+#include "satpg.h"
+#include "ym/RandGen.h"
+
+
+BEGIN_NAMESPACE_YM_SATPG
+
+//////////////////////////////////////////////////////////////////////
+/// @class McHeuristic McHeuristic.h "McHeuristic.h"
+/// @brief 最小被覆問題をヒューリスティックに解くクラス
+///
+/// 貪欲法で初期解を作り，選んだ順の逆順に冗長な列を取り除く．
+/// 制限時間が与えられた場合にはさらに局所探索で解を改良し，
+/// 時間切れの時点での最良解を返す．
+/// どの列にも被覆されない行は無視される．
+//////////////////////////////////////////////////////////////////////
+class McHeuristic
+{
+public:
+
+  /// @brief コンストラクタ
+  /// @param[in] row_num 行数
+  /// @param[in] col_num 列数
+  /// @param[in] elem_list 要素(行番号, 列番号)のリスト
+  McHeuristic(ymuint row_num,
+	      ymuint col_num,
+	      const vector<pair<ymuint, ymuint> >& elem_list);
+
+  /// @brief デストラクタ
+  ~McHeuristic();
+
+
+public:
+  //////////////////////////////////////////////////////////////////////
+  // 外部インターフェイス
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 問題を解く．
+  /// @param[in] time_limit 局所探索の制限時間(秒)
+  /// @param[out] solution 選ばれた列番号のリスト
+  ///
+  /// time_limit が 0 以下の場合は局所探索を行わない．
+  void
+  solve(double time_limit,
+	vector<ymuint32>& solution);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // 内部で用いられる関数
+  //////////////////////////////////////////////////////////////////////
+
+  /// @brief 列を選んだ時に新たに被覆される行数を返す．
+  ymuint
+  gain(ymuint col) const;
+
+  /// @brief 列を選ぶ．
+  void
+  select_col(ymuint col);
+
+  /// @brief 列の選択を取り消す．
+  void
+  deselect_col(ymuint col);
+
+  /// @brief 貪欲法で未被覆の行を被覆する．
+  /// @param[in] cand_list 候補の列のリスト
+  /// @param[inout] solution 解
+  ///
+  /// 選ばれた列は solution の末尾に追加される．
+  void
+  greedy(const vector<ymuint>& cand_list,
+	 vector<ymuint>& solution);
+
+  /// @brief 冗長な列を取り除く．
+  /// @param[inout] solution 解
+  ///
+  /// 末尾の列から順に調べる．
+  void
+  prune(vector<ymuint>& solution);
+
+  /// @brief 選ばれている列を入れ替える．
+  /// @param[in] old_sol 現在の解
+  /// @param[in] new_sol 新しい解
+  void
+  replace_state(const vector<ymuint>& old_sol,
+		const vector<ymuint>& new_sol);
+
+
+private:
+  //////////////////////////////////////////////////////////////////////
+  // データメンバ
+  //////////////////////////////////////////////////////////////////////
+
+  // 列ごとの被覆する行のリスト
+  vector<vector<ymuint> > mColRows;
+
+  // 行ごとの被覆する列のリスト
+  vector<vector<ymuint> > mRowCols;
+
+  // 行ごとの被覆している選択された列の数
+  vector<ymuint> mCoverCount;
+
+  // 列ごとの選択されているかを表す印
+  vector<bool> mSelected;
+
+  // 乱数発生器
+  RandGen mRandGen;
+
+};
+
+END_NAMESPACE_YM_SATPG
+
+#endif // MCHEURISTIC_H
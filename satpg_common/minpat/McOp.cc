@@ -19,15 +19,18 @@ BEGIN_NAMESPACE_YM_SATPG
 //////////////////////////////////////////////////////////////////////
 
 // @brief コンストラクタ
-// @param[in] mincov 最小被覆問題のオブジェクト
-// @param[in] row_map 故障番号から行番号を得る表
-// @param[in] col_pos 列番号
-McOp::McOp(MinCov& mincov,
-	   const vector<ymuint>& row_map,
-	   ymuint col_pos) :
-  mMinCov(mincov),
+// @param[in] row_map 故障番号から行番号 + 1 を得る表
+// @param[in] col_base 0 ビット目のパタンに対応する列番号
+// @param[in] col_num パタン数
+// @param[out] elem_list 要素を追加するリスト
+McOp::McOp(const vector<ymuint>& row_map,
+	   ymuint col_base,
+	   ymuint col_num,
+	   vector<pair<ymuint, ymuint> >& elem_list) :
   mRowMap(row_map),
-  mColPos(col_pos)
+  mColBase(col_base),
+  mColNum(col_num),
+  mElemList(elem_list)
 {
 }
 
@@ -44,9 +47,37 @@ McOp::operator()(const TpgFault* f,
 		 PackedVal dpat)
 {
   ymuint row_pos = mRowMap[f->id()];
-  if ( row_pos > 0 ) {
-    -- row_pos;
-    mMinCov.insert_elem(row_pos, mColPos);
+  if ( row_pos == 0 ) {
+    return;
+  }
+  -- row_pos;
+
+  // mColNum 以降のビットはダミーのパタンなので無視する．
+  ymuint n = mColNum < kPvBitLen ? mColNum : kPvBitLen;
+  for (ymuint b = 0; b < n; ++ b) {
+    if ( (dpat >> b) & 1UL ) {
+      mElemList.push_back(make_pair(row_pos, mColBase + b));
+    }
+  }
+}
+
+// @brief 故障を検出したときの処理(多ワード版)
+// @param[in] f 故障
+// @param[in] dpat 検出したパタンを表すビットベクタ
+void
+McOp::operator()(const TpgFault* f,
+		 const PackedValW& dpat)
+{
+  ymuint row_pos = mRowMap[f->id()];
+  if ( row_pos == 0 ) {
+    return;
+  }
+  -- row_pos;
+
+  for (ymuint b = 0; b < mColNum; ++ b) {
+    if ( dpat.check_bit(b) ) {
+      mElemList.push_back(make_pair(row_pos, mColBase + b));
+    }
   }
 }
 
@@ -10,13 +10,16 @@
 
 
 #include "FsimOp.h"
-#include "ym/MinCov.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG
 
 //////////////////////////////////////////////////////////////////////
 // @class McOp McOp.h "McOp.h"
+// @brief 最小被覆問題の行列要素を記録する FsimOp
+//
+// ppsfp() の j ビット目のパタンを col_base + j 番目の列に対応させ，
+// 検出された (行番号, 列番号) の組を elem_list に追加する．
 //////////////////////////////////////////////////////////////////////
 class McOp :
   public FsimOp
@@ -24,12 +27,16 @@ class McOp :
 public:
 
   /// @brief コンストラクタ
-  /// @param[in] mincov 最小被覆問題のオブジェクト
-  /// @param[in] row_map 故障番号から行番号を得る表
-  /// @param[in] col_pos 列番号
-  McOp(MinCov& mincov,
-       const vector<ymuint>& row_map,
-       ymuint col_pos);
+  /// @param[in] row_map 故障番号から行番号 + 1 を得る表
+  /// @param[in] col_base 0 ビット目のパタンに対応する列番号
+  /// @param[in] col_num パタン数
+  /// @param[out] elem_list 要素を追加するリスト
+  ///
+  /// row_map の値が 0 の故障は無視される．
+  McOp(const vector<ymuint>& row_map,
+       ymuint col_base,
+       ymuint col_num,
+       vector<pair<ymuint, ymuint> >& elem_list);
 
   /// @brief デストラクタ
   virtual
@@ -49,6 +56,14 @@ public:
   operator()(const TpgFault* f,
 	     PackedVal dpat);
 
+  /// @brief 故障を検出したときの処理(多ワード版)
+  /// @param[in] f 故障
+  /// @param[in] dpat 検出したパタンを表すビットベクタ
+  virtual
+  void
+  operator()(const TpgFault* f,
+	     const PackedValW& dpat);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -61,14 +76,17 @@ private:
   // データメンバ
   //////////////////////////////////////////////////////////////////////
 
-  // 最小被覆問題
-  MinCov& mMinCov;
-
   // 行番号を得るための表
   const vector<ymuint>& mRowMap;
 
-  // 列番号
-  ymuint mColPos;
+  // 0 ビット目に対応する列番号
+  ymuint mColBase;
+
+  // パタン数
+  ymuint mColNum;
+
+  // 要素のリスト
+  vector<pair<ymuint, ymuint> >& mElemList;
 
 };
 
@@ -32,6 +32,9 @@ MinPatBase::MinPatBase(bool group_dominance)
 {
   mVerbose = 0;
   mGroupDominance = group_dominance;
+  mThreadNum = 1;
+  mMcHeuristic = false;
+  mMcTimeLimit = 0.0;
 }
 
 // @brief デストラクタ
@@ -131,6 +134,7 @@ MinPatBase::run(TpgNetwork& network,
   local_timer.start();
 
   FgMgrBase fgmgr(mMaxNodeId, mAnalyzer);
+  fgmgr.set_thread_num(mThreadNum);
   vector<ymuint> group_list;
   ymuint nf = fault_num();
 
@@ -140,6 +144,7 @@ MinPatBase::run(TpgNetwork& network,
     // 最初のグループを作る．
     ymuint gid = fgmgr.new_group(fid);
     group_list.push_back(gid);
+    set_group(fid, gid);
   }
 
   // 未処理の故障がある限り以下の処理を繰り返す．
@@ -159,9 +164,10 @@ MinPatBase::run(TpgNetwork& network,
     if ( gid == fgmgr.group_num() ) {
       // 見つからなかった．
       // 新たなグループを作る．
-      ymuint gid = fgmgr.new_group(fid);
+      gid = fgmgr.new_group(fid);
       group_list.push_back(gid);
     }
+    set_group(fid, gid);
   }
 
   local_timer.stop();
@@ -228,8 +234,10 @@ MinPatBase::run(TpgNetwork& network,
     local_timer.reset();
     local_timer.start();
 
-    McCompactor compactor(fsim3);
+    McCompactor compactor(network, fsim3);
     compactor.set_verbose(verbose());
+    compactor.set_thread_num(mThreadNum);
+    compactor.set_heuristic(mMcHeuristic, mMcTimeLimit);
 
     vector<TestVector*> new_tv_list;
     compactor.run(fault_list, tv_list, new_tv_list);
@@ -279,6 +287,25 @@ MinPatBase::verbose() const
   return mVerbose;
 }
 
+// @brief スレッド数を設定する．
+// @param[in] num スレッド数 (0 の場合はハードウェアの並列度)
+void
+MinPatBase::set_thread_num(ymuint num)
+{
+  mThreadNum = num;
+}
+
+// @brief 最小被覆圧縮の解法を設定する．
+// @param[in] heuristic true の時はヒューリスティックで解く．
+// @param[in] time_limit 局所探索の制限時間(秒)
+void
+MinPatBase::set_mc_heuristic(bool heuristic,
+			     double time_limit)
+{
+  mMcHeuristic = heuristic;
+  mMcTimeLimit = time_limit;
+}
+
 // @brief 故障を追加するグループを選ぶ．
 // @param[in] fgmgr 故障グループを管理するオブジェクト
 // @param[in] fid 故障番号
@@ -301,6 +328,15 @@ MinPatBase::find_group(FgMgr& fgmgr,
   return gid;
 }
 
+// @brief 故障が追加されたグループを通知する．
+// @param[in] fid 故障番号
+// @param[in] gid グループ番号
+void
+MinPatBase::set_group(ymuint fid,
+		      ymuint gid)
+{
+}
+
 // @brief 故障解析器を返す．
 FaultAnalyzer&
 MinPatBase::analyzer()
@@ -308,6 +344,13 @@ MinPatBase::analyzer()
   return mAnalyzer;
 }
 
+// @brief スレッド数を返す．
+ymuint
+MinPatBase::thread_num() const
+{
+  return mThreadNum;
+}
+
 // @brief テストパタンを作る．
 // @param[in] gid グループ番号
 // @param[in] network ネットワーク
@@ -77,6 +77,20 @@ public:
   int
   verbose() const;
 
+  /// @brief スレッド数を設定する．
+  /// @param[in] num スレッド数 (0 の場合はハードウェアの並列度)
+  virtual
+  void
+  set_thread_num(ymuint num);
+
+  /// @brief 最小被覆圧縮の解法を設定する．
+  /// @param[in] heuristic true の時はヒューリスティックで解く．
+  /// @param[in] time_limit 局所探索の制限時間(秒)
+  virtual
+  void
+  set_mc_heuristic(bool heuristic,
+		   double time_limit);
+
 
 protected:
   //////////////////////////////////////////////////////////////////////
@@ -129,10 +143,28 @@ protected:
 	     ymuint fid,
 	     const vector<ymuint>& group_list);
 
+  /// @brief 故障が追加されたグループを通知する．
+  /// @param[in] fid 故障番号
+  /// @param[in] gid グループ番号
+  ///
+  /// get_first_fault()/get_next_fault() で選ばれた故障が
+  /// グループに追加されるたびに呼ばれる．
+  /// デフォルト実装はなにもしない．
+  virtual
+  void
+  set_group(ymuint fid,
+	    ymuint gid);
+
   /// @brief 故障解析器を返す．
   FaultAnalyzer&
   analyzer();
 
+  /// @brief スレッド数を返す．
+  ///
+  /// set_thread_num() で設定された値をそのまま返す．
+  ymuint
+  thread_num() const;
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -160,6 +192,15 @@ private:
   // verbose フラグ
   int mVerbose;
 
+  // スレッド数
+  ymuint mThreadNum;
+
+  // 最小被覆圧縮をヒューリスティックで行う時 true にするフラグ
+  bool mMcHeuristic;
+
+  // 最小被覆圧縮の局所探索の制限時間(秒)
+  double mMcTimeLimit;
+
   // group dominance フラグ
   bool mGroupDominance;
 
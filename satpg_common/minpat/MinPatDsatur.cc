@@ -87,14 +87,21 @@ MinPatDsatur::init(const vector<ymuint>& fid_list,
     fs.mPatNum = checker.det_count(fid);
     fs.mSelected = false;
     fs.mConflictNum = 0;
-    fs.mConflictMap.resize(1, false);
-    fs.mPendingNum = 0;
-    fs.mPendingMap.resize(1, false);
+    fs.mConflictSet.clear();
+    fs.mLogPos = 0;
     mFaultMap[fid] = i;
   }
   mFaultNum = nf;
   mRemainNum = nf;
 
+  mGroupLog.clear();
+  mLastLogPos.clear();
+  mSaturHeap.init(nf);
+  mBoundHeap.init(nf);
+  for (ymuint i = 0; i < nf; ++ i) {
+    update_key(i);
+  }
+
   mSimpleConfNum = 0;
   mSatConfNum = 0;
   mCompatNum = 0;
@@ -134,8 +141,9 @@ MinPatDsatur::get_first_fault()
       min_pos = i;
     }
   }
-  mPrevGid = 0;
   mFaultStructList[min_pos].mSelected = true;
+  mSaturHeap.remove(min_pos);
+  mBoundHeap.remove(min_pos);
   -- mRemainNum;
   return min_fid;
 }
@@ -157,91 +165,41 @@ MinPatDsatur::get_next_fault(FgMgr& fgmgr,
     return 0;
   }
 
-  // 飽和度最大の故障を選ぶ．
-  ymuint ng = fgmgr.group_num();
-  ymuint fault_num = mFaultStructList.size();
-
-  ymuint max_pos = 0;
-
-  bool first = true;
-  ymuint max_satur = 0;
-  for (ymuint i = 0; i < fault_num; ++ i) {
-    FaultStruct& fs = mFaultStructList[i];
-    if ( fs.mSelected ) {
-      continue;
-    }
-    if ( !fs.mConflictMap[mPrevGid] && !fs.mPendingMap[mPrevGid] ) {
-      fs.mPendingMap[mPrevGid] = true;
-      ++ fs.mPendingNum;
-    }
-    if ( first || max_satur < fs.mConflictNum ) {
-      first = false;
-      max_satur = fs.mConflictNum;
-      max_pos = i;
-    }
+  // 前回の故障が追加されたグループを履歴に加える．
+  // これで全ての故障の飽和度の上界が 1 増える．
+  if ( mLastLogPos.size() <= mPrevGid ) {
+    mLastLogPos.resize(mPrevGid + 1, 0);
   }
+  mLastLogPos[mPrevGid] = mGroupLog.size();
+  mGroupLog.push_back(mPrevGid);
+  ymuint log_size = mGroupLog.size();
+
+  // 飽和度最大の故障を選ぶ．
+  ymuint max_pos = mSaturHeap.top();
+  ymuint max_satur = mFaultStructList[max_pos].mConflictNum;
 
+  // 飽和度の上界が max_satur を越えている故障を調べ直す．
   for ( ; ; ) {
-    ymuint max2 = max_satur;
-    ymuint max2_pos = 0;
-    for (ymuint i = 0; i < fault_num; ++ i) {
-      FaultStruct& fs = mFaultStructList[i];
-      if ( fs.mSelected ) {
-	continue;
-      }
-      if ( max2 < fs.mConflictNum + fs.mPendingNum ) {
-	max2 = fs.mConflictNum + fs.mPendingNum;
-	max2_pos = i;
-      }
-    }
-    if ( max2 > max_satur ) {
-      ymuint slack = max2 - max_satur;
-      FaultStruct& fs = mFaultStructList[max2_pos];
-
-      StructSat struct_sat(mMaxNodeId);
-
-      ymuint fid = fs.mFaultId;
-      const TpgFault* fault = analyzer().fault(fid);
-      struct_sat.add_focone(fault, kVal1);
-
-      const NodeValList& ma_list = analyzer().fault_info(fid).mandatory_assignment();
-      for (ymuint gid = 0; gid < ng; ++ gid) {
-	if ( fs.mPendingMap[gid] ) {
-	  fs.mPendingMap[gid] = false;
-	  -- fs.mPendingNum;
-	  const NodeValList& suf_list0 = fgmgr.sufficient_assignment(gid);
-	  if ( struct_sat.check_sat(ma_list) == kB3False ) {
-	    ++ fs.mConflictNum;
-	    fs.mConflictMap[gid] = true;
-	    ++ mSimpleConfNum;
-	  }
-	  else if ( struct_sat.check_sat(suf_list0) == kB3False ) {
-	    ++ fs.mConflictNum;
-	    fs.mConflictMap[gid] = true;
-	    ++ mSatConfNum;
-	  }
-	  else {
-	    ++ mCompatNum;
-	    -- slack;
-	    if ( slack == 0 ) {
-	      break;
-	    }
-	  }
-	}
-      }
-      if ( slack > 0 ) {
-	max_satur = fs.mConflictNum;
-	max_pos = max2_pos;
-      }
-    }
-    else {
+    ymuint pos2 = mBoundHeap.top();
+    const FaultStruct& fs = mFaultStructList[pos2];
+    ymuint bound = fs.mConflictNum + (log_size - fs.mLogPos);
+    if ( bound <= max_satur ) {
       break;
     }
+    update_satur(fgmgr, pos2, max_satur);
+    if ( fs.mConflictNum > max_satur ) {
+      max_satur = fs.mConflictNum;
+      max_pos = pos2;
+    }
   }
 
-  mFaultStructList[max_pos].mSelected = true;
+  FaultStruct& fs = mFaultStructList[max_pos];
+  fs.mSelected = true;
+  fs.mConflictSet.clear();
+  mSaturHeap.remove(max_pos);
+  mBoundHeap.remove(max_pos);
   -- mRemainNum;
-  return mFaultStructList[max_pos].mFaultId;
+  return fs.mFaultId;
 }
 
 // @brief 故障を追加するグループを選ぶ．
@@ -255,20 +213,90 @@ MinPatDsatur::find_group(FgMgr& fgmgr,
 			 ymuint fid,
 			 const vector<ymuint>& group_list)
 {
-  ymuint gid = MinPatBase::find_group(fgmgr, fid, group_list);
+  return MinPatBase::find_group(fgmgr, fid, group_list);
+}
+
+// @brief 故障が追加されたグループを通知する．
+// @param[in] fid 故障番号
+// @param[in] gid グループ番号
+void
+MinPatDsatur::set_group(ymuint fid,
+			ymuint gid)
+{
   mPrevGid = gid;
-  ymuint ng = fgmgr.group_num();
-  if ( gid == ng ) {
-    for (ymuint i = 0; i < mFaultStructList.size(); ++ i) {
-      FaultStruct& fs = mFaultStructList[i];
-      if ( fs.mSelected ) {
-	continue;
+}
+
+// @brief 故障の未処理の履歴を調べて飽和度を更新する．
+// @param[in] fgmgr 故障グループを管理するオブジェクト
+// @param[in] pos 故障の位置
+// @param[in] limit 飽和度の上界をこの値まで下げたら打ち切る．
+//
+// 同じグループが後でもう一度変更されている履歴は飛ばす．
+// 既に衝突しているグループは調べ直す必要がない．
+// グループには故障が追加されるだけなので衝突が解消されることはない．
+void
+MinPatDsatur::update_satur(FgMgr& fgmgr,
+			   ymuint pos,
+			   ymuint limit)
+{
+  FaultStruct& fs = mFaultStructList[pos];
+  ymuint log_size = mGroupLog.size();
+  ymuint bound = fs.mConflictNum + (log_size - fs.mLogPos);
+
+  StructSat* struct_sat = nullptr;
+  ymuint fid = fs.mFaultId;
+  const NodeValList& ma_list = analyzer().fault_info(fid).mandatory_assignment();
+  while ( fs.mLogPos < log_size && bound > limit ) {
+    ymuint lpos = fs.mLogPos;
+    ++ fs.mLogPos;
+    ymuint gid = mGroupLog[lpos];
+    if ( mLastLogPos[gid] != lpos || fs.mConflictSet.check(gid) ) {
+      -- bound;
+      continue;
+    }
+
+    bool conflict = false;
+    if ( check_conflict(ma_list, fgmgr.mandatory_assignment(gid)) ) {
+      conflict = true;
+      ++ mSimpleConfNum;
+    }
+    else {
+      if ( struct_sat == nullptr ) {
+	struct_sat = new StructSat(mMaxNodeId);
+	const TpgFault* fault = analyzer().fault(fid);
+	struct_sat->add_focone(fault, kVal1);
+      }
+      const NodeValList& suf_list0 = fgmgr.sufficient_assignment(gid);
+      if ( struct_sat->check_sat(suf_list0) == kB3False ) {
+	conflict = true;
+	++ mSatConfNum;
       }
-      fs.mConflictMap.resize(ng + 1, false);
-      fs.mPendingMap.resize(ng + 1, false);
+    }
+
+    if ( conflict ) {
+      ++ fs.mConflictNum;
+      fs.mConflictSet.add(gid);
+    }
+    else {
+      ++ mCompatNum;
+      -- bound;
     }
   }
-  return ng;
+  delete struct_sat;
+
+  update_key(pos);
+}
+
+// @brief 故障のヒープ上のキーを更新する．
+// @param[in] pos 故障の位置
+void
+MinPatDsatur::update_key(ymuint pos)
+{
+  const FaultStruct& fs = mFaultStructList[pos];
+  int satur = fs.mConflictNum;
+  int lpos = fs.mLogPos;
+  mSaturHeap.put(pos, satur);
+  mBoundHeap.put(pos, satur - lpos);
 }
 
 END_NAMESPACE_YM_SATPG
@@ -11,6 +11,8 @@
 
 #include "MinPatBase.h"
 #include "FaultAnalyzer.h"
+#include "KeyHeap.h"
+#include "ym/HashSet.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -18,6 +20,14 @@ BEGIN_NAMESPACE_YM_SATPG
 //////////////////////////////////////////////////////////////////////
 /// @class MinPatDsatur MinPatDsatur.h "MinPatDsatur.h"
 /// @brief 'Dsatur' っぽい MinPat
+///
+/// 故障の飽和度は衝突しているグループ数とする．
+/// グループに故障が追加されるとそのグループとの衝突を調べ直す必要が
+/// あるが，これはグループの変更履歴 mGroupLog に記録するだけにしておき，
+/// 各故障は mGroupLog のどこまでを調べたかを持つ．
+/// 未処理の履歴の数を加えたものが飽和度の上界となるので，
+/// 飽和度と上界をそれぞれキーにしたヒープを用いて，上界が現在の最大の
+/// 飽和度を越える故障だけを調べ直す．
 //////////////////////////////////////////////////////////////////////
 class MinPatDsatur :
   public MinPatBase
@@ -89,6 +99,28 @@ private:
 	     ymuint fid,
 	     const vector<ymuint>& group_list);
 
+  /// @brief 故障が追加されたグループを通知する．
+  /// @param[in] fid 故障番号
+  /// @param[in] gid グループ番号
+  virtual
+  void
+  set_group(ymuint fid,
+	    ymuint gid);
+
+  /// @brief 故障の未処理の履歴を調べて飽和度を更新する．
+  /// @param[in] fgmgr 故障グループを管理するオブジェクト
+  /// @param[in] pos 故障の位置
+  /// @param[in] limit 飽和度の上界をこの値まで下げたら打ち切る．
+  void
+  update_satur(FgMgr& fgmgr,
+	       ymuint pos,
+	       ymuint limit);
+
+  /// @brief 故障のヒープ上のキーを更新する．
+  /// @param[in] pos 故障の位置
+  void
+  update_key(ymuint pos);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -110,14 +142,11 @@ private:
     // 衝突数
     ymuint mConflictNum;
 
-    // 衝突したグループ番号のマップ
-    vector<bool> mConflictMap;
+    // 衝突したグループ番号の集合
+    HashSet<ymuint> mConflictSet;
 
-    // ペンディング数
-    ymuint mPendingNum;
-
-    // ペンディングしているグループ番号のマップ
-    vector<bool> mPendingMap;
+    // mGroupLog 上の処理済みの位置
+    ymuint mLogPos;
   };
 
 
@@ -144,9 +173,22 @@ private:
   // 未処理の故障数
   ymuint mRemainNum;
 
-  // 前回更新されたグループ番号
+  // 前回選んだ故障が追加されたグループ番号
   ymuint mPrevGid;
 
+  // 変更されたグループ番号を順に記録したもの
+  vector<ymuint> mGroupLog;
+
+  // グループ番号をキーにして mGroupLog 上の最後の位置を入れる配列
+  vector<ymuint> mLastLogPos;
+
+  // 衝突数をキーにした未選択の故障のヒープ
+  KeyHeap mSaturHeap;
+
+  // 衝突数 - mLogPos をキーにした未選択の故障のヒープ
+  // mGroupLog.size() を加えたものが飽和度の上界となる．
+  KeyHeap mBoundHeap;
+
   ymuint mSimpleConfNum;
   ymuint mSatConfNum;
   ymuint mCompatNum;
@@ -64,6 +64,7 @@ MinPatDsatur2::init(const vector<ymuint>& fid_list,
   }
 
   ConflictChecker checker2(analyzer(), tvmgr, fsim2);
+  checker2.set_thread_num(thread_num());
   checker2.analyze_conflict(mDomFidList);
 
   ymuint nf = mDomFidList.size();
@@ -47,6 +47,13 @@ public:
   operator()(const TpgFault* f,
 	     PackedVal dpat);
 
+  /// @brief 故障を検出したときの処理(多ワード版)
+  /// @param[in] f 故障
+  virtual
+  void
+  operator()(const TpgFault* f,
+	     const PackedValW& dpat);
+
   /// @brief det_flag を下ろす．
   void
   clear_det_flag();
@@ -96,6 +103,16 @@ FopVer::operator()(const TpgFault* fault,
   mDetSet.add(fault->id());
 }
 
+// @brief 故障を検出したときの処理(多ワード版)
+// @param[in] f 故障
+void
+FopVer::operator()(const TpgFault* fault,
+		   const PackedValW& dpat)
+{
+  mFsim.set_skip(fault);
+  mDetSet.add(fault->id());
+}
+
 // @brief det_flag を下ろす．
 void
 FopVer::clear_det_flag()
@@ -44,6 +44,25 @@ FopRtpg::operator()(const TpgFault* f,
   for (ymuint i = 0; i < kPvBitLen; ++ i) {
     if ( dpat & (1UL << i) ) {
       ++ mCount[i];
+      mPosList.push_back(i);
+      break;
+    }
+  }
+}
+
+// @brief 故障を検出したときの処理(多ワード版)
+// @param[in] f 故障
+// @param[in] dpat 検出したパタンを表すビットベクタ
+void
+FopRtpg::operator()(const TpgFault* f,
+		    const PackedValW& dpat)
+{
+  mFaultList.push_back(f);
+  mFsim.set_skip(f);
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+    if ( dpat.check_bit(i) ) {
+      ++ mCount[i];
+      mPosList.push_back(i);
       break;
     }
   }
@@ -55,15 +74,17 @@ FopRtpg::init()
 {
   clear_count();
   mFaultList.clear();
+  mPosList.clear();
 }
 
 // @brief 検出回数をクリアする．
 void
 FopRtpg::clear_count()
 {
-  for (ymuint i = 0; i < kPvBitLen; ++ i) {
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
     mCount[i] = 0;
   }
+  mLastPos = mFaultList.size();
 }
 
 /// @brief 検出回数を得る．
@@ -81,4 +102,26 @@ FopRtpg::fault_list() const
   return mFaultList;
 }
 
+// @brief 直前のシミュレーションで bitpos 以降のパタンによって
+// 検出された故障を取り除く．
+// @param[in] bitpos ビット位置
+void
+FopRtpg::drop_faults(ymuint bitpos)
+{
+  ymuint wpos = mLastPos;
+  for (ymuint rpos = mLastPos; rpos < mFaultList.size(); ++ rpos) {
+    ymuint pos = mPosList[rpos];
+    if ( pos < bitpos ) {
+      mFaultList[wpos] = mFaultList[rpos];
+      mPosList[wpos] = pos;
+      ++ wpos;
+    }
+    else {
+      mCount[pos] = 0;
+    }
+  }
+  mFaultList.erase(mFaultList.begin() + wpos, mFaultList.end());
+  mPosList.erase(mPosList.begin() + wpos, mPosList.end());
+}
+
 END_NAMESPACE_YM_SATPG
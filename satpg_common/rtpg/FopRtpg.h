@@ -45,6 +45,14 @@ public:
   operator()(const TpgFault* f,
 	     PackedVal dpat);
 
+  /// @brief 故障を検出したときの処理(多ワード版)
+  /// @param[in] f 故障
+  /// @param[in] dpat 検出したパタンを表すビットベクタ
+  virtual
+  void
+  operator()(const TpgFault* f,
+	     const PackedValW& dpat);
+
   /// @brief 初期化する．
   void
   init();
@@ -62,6 +70,14 @@ public:
   const vector<const TpgFault*>&
   fault_list() const;
 
+  /// @brief 直前のシミュレーションで bitpos 以降のパタンによって
+  /// 検出された故障を取り除く．
+  /// @param[in] bitpos ビット位置
+  ///
+  /// 故障はそれを検出した最初のパタンで判断する．
+  void
+  drop_faults(ymuint bitpos);
+
 
 private:
   //////////////////////////////////////////////////////////////////////
@@ -72,11 +88,17 @@ private:
   Fsim& mFsim;
 
   // 検出回数
-  ymuint32 mCount[kPvBitLen];
+  ymuint32 mCount[kPvwBitLen];
 
   // 検出された故障のリスト
   vector<const TpgFault*> mFaultList;
 
+  // mFaultList の故障を検出した最初のパタンのビット位置
+  vector<ymuint> mPosList;
+
+  // 直前のシミュレーションで検出された故障の mFaultList 上の開始位置
+  ymuint mLastPos;
+
 };
 
 END_NAMESPACE_YM_SATPG
@@ -49,7 +49,7 @@ RtpgImpl::init(ymuint32 seed)
 }
 
 // @brief RTPGを行なう．
-// @param[in] fault_list 故障リスト
+// @param[in] fmgr 故障マネージャ
 // @param[in] tvmgr テストベクタマネージャ
 // @param[in] fsim 故障シミュレータ
 // @param[in] min_f 1回のシミュレーションで検出する故障数の下限
@@ -58,8 +58,13 @@ RtpgImpl::init(ymuint32 seed)
 // @param[out] det_fault_list 検出された故障のリスト
 // @param[out] tvlist テストベクタのリスト
 // @param[out] stats 実行結果の情報を格納する変数
+//
+// 故障シミュレーションは kPvwBitLen 個のパタンをまとめて行うが，
+// min_f と max_i は従来どおり kPvBitLen 個のパタンを1回のシミュレーション
+// とみなして判定する．途中で打ち切った場合，それ以降のパタンと
+// それらで検出された故障は無かったものとして扱う．
 void
-RtpgImpl::run(const vector<const TpgFault*>& fault_list,
+RtpgImpl::run(const FaultMgr& fmgr,
 	      TvMgr& tvmgr,
 	      Fsim& fsim,
 	      ymuint min_f,
@@ -73,22 +78,22 @@ RtpgImpl::run(const vector<const TpgFault*>& fault_list,
 
   local_timer.start();
 
-  ymuint fnum = fault_list.size();
+  ymuint fnum = fmgr.remain_num();
   ymuint undet_i = 0;
   ymuint epat_num = 0;
   ymuint total_det_count = 0;
 
-  TestVector* tv_array[kPvBitLen];
-  for (ymuint i = 0; i < kPvBitLen; ++ i) {
+  TestVector* tv_array[kPvwBitLen];
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
     tv_array[i] = tvmgr.new_vector();
   }
 
   vector<TestVector*> cur_array;
-  cur_array.reserve(kPvBitLen);
+  cur_array.reserve(kPvwBitLen);
 
   FopRtpg op(fsim);
 
-  fsim.set_faults(fault_list);
+  fsim.set_faults(fmgr);
   op.init();
 
   ymuint pat_num = 0;
@@ -98,7 +103,7 @@ RtpgImpl::run(const vector<const TpgFault*>& fault_list,
       tv->set_from_random(mRandGen);
       cur_array.push_back(tv);
       ++ pat_num;
-      if ( cur_array.size() < kPvBitLen ) {
+      if ( cur_array.size() < kPvwBitLen ) {
 	continue;
       }
     }
@@ -110,44 +115,65 @@ RtpgImpl::run(const vector<const TpgFault*>& fault_list,
 
     fsim.ppsfp(cur_array, op);
 
-    ymuint det_count = 0;
-    for (ymuint i = 0; i < cur_array.size(); ++ i) {
-      ymuint det_count1 = op.count(i);
-      if ( det_count1 > 0 ) {
-	det_count += det_count1;
-	TestVector* tv = cur_array[i];
-	tvlist.push_back(tv);
-	tv_array[i] = tvmgr.new_vector();
-	++ epat_num;
+    // kPvBitLen 個ずつ結果を調べる．
+    ymuint np = cur_array.size();
+    bool stop = false;
+    ymuint end = 0;
+    while ( !stop && end < np ) {
+      ymuint start = end;
+      end += kPvBitLen;
+      if ( end > np ) {
+	end = np;
       }
-    }
-    cur_array.clear();
 
-    total_det_count += det_count;
+      ymuint det_count = 0;
+      for (ymuint i = start; i < end; ++ i) {
+	ymuint det_count1 = op.count(i);
+	if ( det_count1 > 0 ) {
+	  det_count += det_count1;
+	  TestVector* tv = cur_array[i];
+	  tvlist.push_back(tv);
+	  tv_array[i] = tvmgr.new_vector();
+	  ++ epat_num;
+	}
+      }
 
-    if ( total_det_count == fnum ) {
-      // すべての故障を検出した．
-      break;
-    }
-    if ( det_count < min_f ) {
-      // 検出故障数の下限を下回った
-      break;
-    }
-    if ( det_count > 0 ) {
-      undet_i = 0;
+      total_det_count += det_count;
+
+      if ( total_det_count == fnum ) {
+	// すべての故障を検出した．
+	stop = true;
+      }
+      else if ( det_count < min_f ) {
+	// 検出故障数の下限を下回った
+	stop = true;
+      }
+      else if ( det_count > 0 ) {
+	undet_i = 0;
+      }
+      else {
+	++ undet_i;
+	if ( undet_i > max_i ) {
+	  // 未検出の回数が max_i を越えた．
+	  stop = true;
+	}
+      }
     }
-    else {
-      ++ undet_i;
-      if ( undet_i > max_i ) {
-	// 未検出の回数が max_i を越えた．
-	break;
+    cur_array.clear();
+
+    if ( stop ) {
+      if ( end < np ) {
+	// 打ち切った後のパタンは使わなかったことにする．
+	op.drop_faults(end);
+	pat_num -= np - end;
       }
+      break;
     }
   }
 
   det_fault_list = op.fault_list();
 
-  for (ymuint i = 0; i < kPvBitLen; ++ i) {
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
     tvmgr.delete_vector(tv_array[i]);
   }
 
@@ -49,7 +49,7 @@ RtpgTImpl::init(ymuint32 seed)
 }
 
 // @brief RTPGを行なう．
-// @param[in] fault_list 故障リスト
+// @param[in] fmgr 故障マネージャ
 // @param[in] tvmgr テストベクタマネージャ
 // @param[in] fsim 故障シミュレータ
 // @param[in] min_f 1回のシミュレーションで検出する故障数の下限
@@ -59,7 +59,7 @@ RtpgTImpl::init(ymuint32 seed)
 // @param[out] tvlist テストベクタのリスト
 // @param[out] stats 実行結果の情報を格納する変数
 void
-RtpgTImpl::run(const vector<const TpgFault*>& fault_list,
+RtpgTImpl::run(const FaultMgr& fmgr,
 	       TvMgr& tvmgr,
 	       Fsim& fsim,
 	       ymuint min_f,
@@ -73,7 +73,7 @@ RtpgTImpl::run(const vector<const TpgFault*>& fault_list,
 
   local_timer.start();
 
-  ymuint fnum = fault_list.size();
+  ymuint fnum = fmgr.remain_num();
   ymuint undet_i = 0;
   ymuint epat_num = 0;
   ymuint total_det_count = 0;
@@ -82,7 +82,7 @@ RtpgTImpl::run(const vector<const TpgFault*>& fault_list,
 
   FopRtpg op(fsim);
 
-  fsim.set_faults(fault_list);
+  fsim.set_faults(fmgr);
   op.init();
 
   ymuint pat_num = 0;
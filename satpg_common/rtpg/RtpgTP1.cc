@@ -50,7 +50,7 @@ RtpgTP1::init(ymuint32 seed)
 }
 
 // @brief RTPGを行なう．
-// @param[in] fault_list 故障リスト
+// @param[in] fmgr 故障マネージャ
 // @param[in] tvmgr テストベクタマネージャ
 // @param[in] fsim 故障シミュレータ
 // @param[in] min_f 1回のシミュレーションで検出する故障数の下限
@@ -60,7 +60,7 @@ RtpgTP1::init(ymuint32 seed)
 // @param[out] tvlist テストベクタのリスト
 // @param[out] stats 実行結果の情報を格納する変数
 void
-RtpgTP1::run(const vector<const TpgFault*>& fault_list,
+RtpgTP1::run(const FaultMgr& fmgr,
 	     TvMgr& tvmgr,
 	     Fsim& fsim,
 	     ymuint min_f,
@@ -75,30 +75,46 @@ RtpgTP1::run(const vector<const TpgFault*>& fault_list,
 
   local_timer.start();
 
-  ymuint fnum = fault_list.size();
+  ymuint fnum = fmgr.remain_num();
   ymuint undet_i = 0;
   ymuint epat_num = 0;
   ymuint total_det_count = 0;
 
-  TestVector* tv = tvmgr.new_vector();
+  // 候補のパタンはまとめて生成して WSA を計算する．
+  vector<TestVector*> cand_array(kPvwBitLen);
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+    cand_array[i] = tvmgr.new_vector();
+  }
+  vector<ymuint> wsa_array;
+  ymuint cand_pos = kPvwBitLen;
 
   FopRtpg op(fsim);
 
-  fsim.set_faults(fault_list);
+  fsim.set_faults(fmgr);
   op.init();
 
   ymuint gnum = 0;
   ymuint pat_num = 0;
   while ( pat_num < max_pat ) {
-    tv->set_from_random(mRandGen);
+    if ( cand_pos == kPvwBitLen ) {
+      for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+	cand_array[i]->set_from_random(mRandGen);
+      }
+      fsim.calc_wsa(cand_array, wsa_array);
+      cand_pos = 0;
+    }
+    ymuint pos = cand_pos;
+    ++ cand_pos;
     ++ gnum;
 
-    ymuint wsa = fsim.calc_wsa(tv);
+    ymuint wsa = wsa_array[pos];
     //cout << "wsa = " << wsa << ", # of pat = " << pat_num << endl;
     if ( wsa > wsa_limit ) {
       continue;
     }
 
+    TestVector* tv = cand_array[pos];
+
     op.clear_count();
 
     fsim.sppfp(tv, op);
@@ -107,7 +123,7 @@ RtpgTP1::run(const vector<const TpgFault*>& fault_list,
     ymuint det_count = op.count(0);
     if ( det_count > 0 ) {
       tvlist.push_back(tv);
-      tv = tvmgr.new_vector();
+      cand_array[pos] = tvmgr.new_vector();
       ++ epat_num;
     }
 
@@ -135,7 +151,9 @@ RtpgTP1::run(const vector<const TpgFault*>& fault_list,
 
   det_fault_list = op.fault_list();
 
-  tvmgr.delete_vector(tv);
+  for (ymuint i = 0; i < kPvwBitLen; ++ i) {
+    tvmgr.delete_vector(cand_array[i]);
+  }
 
   local_timer.stop();
   USTime time = local_timer.time();
@@ -50,14 +50,13 @@ evaluate(ymuint sa,
 #endif
 }
 
+// tv1 の近傍のパタンを作るために反転させる入力番号のリストを作る．
 void
 gen_neighbor(const TestVector* tv1,
-	     TestVector* tv2,
 	     RandGen& randgen,
-	     ymuint nbits)
+	     ymuint nbits,
+	     vector<ymuint>& flip_list)
 {
-  tv2->copy(*tv1);
-
   ymuint count = 0;
   for (ymuint i = 0; i < nbits; ++ i) {
     double r = randgen.real1();
@@ -65,13 +64,17 @@ gen_neighbor(const TestVector* tv1,
       ++ count;
     }
   }
+  ymuint ni = tv1->input_num();
+  if ( count > ni ) {
+    count = ni;
+  }
   // count ビットだけ反転する．
-  RandCombiGen rcg(tv1->input_num(), count);
+  RandCombiGen rcg(ni, count);
   rcg.generate(randgen);
-  for (ymuint i = 0; i < nbits; ++ i) {
-    ymuint pos = rcg.elem(i);
-    Val3 val = tv2->val3(pos);
-    tv2->set_val(pos, ~val);
+  flip_list.clear();
+  flip_list.reserve(count);
+  for (ymuint i = 0; i < count; ++ i) {
+    flip_list.push_back(rcg.elem(i));
   }
 }
 
@@ -101,7 +104,7 @@ RtpgTP2::init(ymuint32 seed)
 }
 
 // @brief RTPGを行なう．
-// @param[in] fault_list 故障リスト
+// @param[in] fmgr 故障マネージャ
 // @param[in] tvmgr テストベクタマネージャ
 // @param[in] fsim 故障シミュレータ
 // @param[in] min_f 1回のシミュレーションで検出する故障数の下限
@@ -111,7 +114,7 @@ RtpgTP2::init(ymuint32 seed)
 // @param[out] tvlist テストベクタのリスト
 // @param[out] stats 実行結果の情報を格納する変数
 void
-RtpgTP2::run(const vector<const TpgFault*>& fault_list,
+RtpgTP2::run(const FaultMgr& fmgr,
 	     TvMgr& tvmgr,
 	     Fsim& fsim,
 	     ymuint min_f,
@@ -126,32 +129,31 @@ RtpgTP2::run(const vector<const TpgFault*>& fault_list,
 
   local_timer.start();
 
-  ymuint fnum = fault_list.size();
+  ymuint fnum = fmgr.remain_num();
   ymuint undet_i = 0;
   ymuint epat_num = 0;
   ymuint total_det_count = 0;
 
   TestVector* tv1 = tvmgr.new_vector();
-  TestVector* tv2 = tvmgr.new_vector();
 
   FopRtpg op(fsim);
 
-  fsim.set_faults(fault_list);
+  fsim.set_faults(fmgr);
   op.init();
 
   ymuint gnum = 0;
   ymuint pat_num = 0;
 
   tv1->set_from_random(mRandGen);
-  ymuint wsa0 = fsim.calc_wsa(tv1);
+  ymuint wsa0 = fsim.init_wsa(tv1);
   double val0 = evaluate(wsa0, wsa_limit);
-  ymuint count = 0;
 
+  vector<ymuint> flip_list;
   while ( pat_num < max_pat ) {
-    // tv1 から tv2 を作る．
-    gen_neighbor(tv1, tv2, mRandGen, mNbits);
+    // tv1 の近傍のパタンの WSA を差分で求める．
+    gen_neighbor(tv1, mRandGen, mNbits, flip_list);
     ++ gnum;
-    ymuint wsa1 = fsim.calc_wsa(tv2);
+    ymuint wsa1 = wsa0 + fsim.delta_wsa(flip_list);
     double val1 = evaluate(wsa1, wsa_limit);
     //cout << "wsa = " << wsa1 << ", val = " << val1
     //<< ", # of pat = " << pat_num << endl;
@@ -168,11 +170,14 @@ RtpgTP2::run(const vector<const TpgFault*>& fault_list,
       }
     }
     if ( accept ) {
-      tv1->copy(*tv2);
+      fsim.commit_wsa();
+      for (ymuint i = 0; i < flip_list.size(); ++ i) {
+	ymuint pos = flip_list[i];
+	tv1->set_val(pos, ~tv1->val3(pos));
+      }
       wsa0 = wsa1;
       val0 = val1;
 
-
       if ( wsa1 <= wsa_limit ) {
 	op.clear_count();
 
@@ -182,7 +187,9 @@ RtpgTP2::run(const vector<const TpgFault*>& fault_list,
 	ymuint det_count = op.count(0);
 	if ( det_count > 0 ) {
 	  tvlist.push_back(tv1);
-	  tv1 = tvmgr.new_vector();
+	  TestVector* tv = tvmgr.new_vector();
+	  tv->copy(*tv1);
+	  tv1 = tv;
 	  ++ epat_num;
 	}
 
@@ -206,14 +213,19 @@ RtpgTP2::run(const vector<const TpgFault*>& fault_list,
 	    break;
 	  }
 	}
+
+	// 故障シミュレーションで状態が失われるので作り直す．
+	fsim.init_wsa(tv1);
       }
     }
+    else {
+      fsim.rollback_wsa();
+    }
   }
 
   det_fault_list = op.fault_list();
 
   tvmgr.delete_vector(tv1);
-  tvmgr.delete_vector(tv2);
 
   local_timer.stop();
   USTime time = local_timer.time();
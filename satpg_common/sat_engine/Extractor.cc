@@ -107,6 +107,32 @@ Extractor::operator()(const TpgFault* fault,
   }
 }
 
+// @brief ノードから外部出力までの伝搬条件の値割当を求める．
+// @param[in] root 故障差の生じているノード
+// @param[out] assign_list 値の割当リスト
+void
+Extractor::operator()(const TpgNode* root,
+		      NodeValList& assign_list)
+{
+  // root の TFO (fault cone) に印をつける．
+  mFconeMark.clear();
+  dfs(root, mFconeMark);
+
+  // 故障差の伝搬している経路を探す．
+  const TpgNode* spo = find_sensitized_output(root);
+  ASSERT_COND( spo != nullptr );
+
+  // その経路の side input の値を記録する．
+  mRecorded.clear();
+  assign_list.clear();
+  mRecorded.add(root->id());
+  record_node(root, assign_list);
+
+  record_sensitized_node(spo, assign_list);
+
+  assign_list.sort();
+}
+
 // @brief 故障の影響を伝搬するノードを求める．
 // @param[in] node 対象のノード
 const TpgNode*
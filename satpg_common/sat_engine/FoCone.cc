@@ -22,6 +22,7 @@ BEGIN_NAMESPACE_YM_SATPG
 // @param[in] fnode 故障位置のノード
 // @param[in] bnode ブロックノード
 // @param[in] detect 検出条件
+// @param[in] cvar 検出条件を制御する変数
 //
 // ブロックノードより先のノードは含めない．
 // 通常 bnode は fnode の dominator
@@ -29,7 +30,8 @@ BEGIN_NAMESPACE_YM_SATPG
 FoCone::FoCone(StructSat& struct_sat,
 	       const TpgNode* fnode,
 	       const TpgNode* bnode,
-	       Val3 detect) :
+	       Val3 detect,
+	       SatVarId cvar) :
   ConeBase(struct_sat)
 {
   if ( bnode != nullptr ) {
@@ -64,16 +66,26 @@ FoCone::FoCone(StructSat& struct_sat,
   }
   else if ( detect == kVal1 ) {
     vector<SatLiteral> tmp_lits;
-    tmp_lits.reserve(npo);
+    tmp_lits.reserve(npo + 1);
     for (ymuint i = 0; i < npo; ++ i) {
       const TpgNode* node = output_node(i);
       SatLiteral dlit(dvar(node));
       tmp_lits.push_back(dlit);
     }
-    solver().add_clause(tmp_lits);
 
     SatLiteral dlit(dvar(fnode));
-    solver().add_clause(dlit);
+    if ( cvar == kSatVarIdIllegal ) {
+      solver().add_clause(tmp_lits);
+      solver().add_clause(dlit);
+    }
+    else {
+      // D-Chain 制約は dlit が 0 なら何も制約しないので
+      // ここの2つの節だけを cvar で制御すればよい．
+      SatLiteral clit(cvar);
+      tmp_lits.push_back(~clit);
+      solver().add_clause(tmp_lits);
+      solver().add_clause(~clit, dlit);
+    }
   }
 }
 
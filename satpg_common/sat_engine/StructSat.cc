@@ -150,6 +150,18 @@ StructSat::add_focone(const TpgFault* fault,
   return focone;
 }
 
+// @brief 検出条件を変数で制御する fault cone を追加する．
+// @param[in] fnode 故障のあるノード
+// @param[in] cvar 検出条件を制御する変数
+const FoCone*
+StructSat::add_focone(const TpgNode* fnode,
+		      SatVarId cvar)
+{
+  FoCone* focone = new FoCone(*this, fnode, nullptr, kVal1, cvar);
+  mFoConeList.push_back(focone);
+  return focone;
+}
+
 // @brief fault cone を追加する．
 // @param[in] fnode 故障のあるノード
 //
@@ -21,6 +21,7 @@
 #include "TpgLogicXOR.h"
 #include "TpgLogicXNOR.h"
 #include "TpgMap.h"
+#include "TpgFault.h"
 
 
 BEGIN_NAMESPACE_YM_SATPG
@@ -37,6 +38,31 @@ alloc_array(Alloc& alloc,
   return new (p) T[n];
 }
 
+// node を含む FFR 内の故障を fault_list に入れる．
+// fault_mark が nullptr でない場合は印のついた故障のみを入れる．
+void
+get_ffr_faults_sub(const TpgNode* node,
+		   const vector<bool>* fault_mark,
+		   vector<const TpgFault*>& fault_list)
+{
+  ymuint nf = node->fault_num();
+  for (ymuint i = 0; i < nf; ++ i) {
+    const TpgFault* f = node->fault(i);
+    if ( fault_mark == nullptr || (*fault_mark)[f->id()] ) {
+      fault_list.push_back(f);
+    }
+  }
+
+  // ファンインが同じ FFR のノードなら再帰する．
+  ymuint ni = node->fanin_num();
+  for (ymuint i = 0; i < ni; ++ i) {
+    const TpgNode* inode = node->fanin(i);
+    if ( inode->ffr_root() == node->ffr_root() ) {
+      get_ffr_faults_sub(inode, fault_mark, fault_list);
+    }
+  }
+}
+
 END_NONAMESPACE
 
 // @brief GateType のストリーム演算子
@@ -575,6 +601,24 @@ TpgNode::input_fault(int val,
   return nullptr;
 }
 
+// @brief このノードを根とする FFR に含まれる代表故障を得る．
+// @param[out] fault_list 故障を追加するリスト
+void
+TpgNode::get_ffr_faults(vector<const TpgFault*>& fault_list) const
+{
+  get_ffr_faults_sub(this, nullptr, fault_list);
+}
+
+// @brief このノードを根とする FFR に含まれる印のついた代表故障を得る．
+// @param[in] fault_mark 故障番号をキーにした印の配列
+// @param[out] fault_list 故障を追加するリスト
+void
+TpgNode::get_ffr_faults(const vector<bool>& fault_mark,
+			vector<const TpgFault*>& fault_list) const
+{
+  get_ffr_faults_sub(this, &fault_mark, fault_list);
+}
+
 // @brief 出力番号2をセットする．
 // @param[in] id セットする番号
 //